@@ -14,6 +14,7 @@
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/pool_params.hpp>
 #include <boost/mysql/results.hpp>
+#include <boost/mysql/sharded_connection_pool.hpp>
 #include <boost/mysql/ssl_mode.hpp>
 #include <boost/mysql/statement.hpp>
 #include <boost/mysql/string_view.hpp>
@@ -22,10 +23,16 @@
 #include <boost/asio/coroutine.hpp>
 #include <boost/asio/detached.hpp>
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <functional>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 using boost::mysql::error_code;
 using std::chrono::steady_clock;
@@ -38,17 +45,18 @@ static constexpr std::size_t num_parallel = 100;
 static constexpr std::size_t total = num_parallel * 100;
 static constexpr const char* default_unix_path = "/var/run/mysqld/mysqld.sock";
 
+// Counters are atomic so the coordinator can be used by multi-threaded benchmarks
 class coordinator
 {
-    bool finished_{};
-    std::size_t remaining_queries_{total};
-    std::size_t outstanding_tasks_{num_parallel};
+    std::atomic<bool> finished_{};
+    std::atomic<std::size_t> remaining_queries_{total};
+    std::atomic<std::size_t> outstanding_tasks_{num_parallel};
     steady_clock::time_point tp_start_;
     steady_clock::time_point tp_finish_;
-    mysql::connection_pool* pool_{};
+    std::function<void()> cancel_pool_;
 
 public:
-    coordinator(mysql::connection_pool* pool = nullptr) : pool_(pool) {}
+    coordinator(std::function<void()> cancel_pool = {}) : cancel_pool_(std::move(cancel_pool)) {}
     std::chrono::milliseconds ellapsed() const
     {
         return std::chrono::duration_cast<std::chrono::milliseconds>(tp_finish_ - tp_start_);
@@ -59,8 +67,8 @@ public:
         if (--outstanding_tasks_ == 0)
         {
             tp_finish_ = steady_clock::now();
-            if (pool_)
-                pool_->cancel();
+            if (cancel_pool_)
+                cancel_pool_();
         }
     }
     bool on_loop_finish()
@@ -139,9 +147,11 @@ public:
     }
 };
 
+// Pool can be connection_pool or sharded_connection_pool
+template <class Pool>
 class task_pool
 {
-    mysql::connection_pool* pool_;
+    Pool* pool_;
     mysql::results r_;
     mysql::diagnostics diag_;
     coordinator* coord_{};
@@ -156,7 +166,7 @@ class task_pool
     }
 
 public:
-    task_pool(mysql::connection_pool& pool, coordinator& coord) : pool_(&pool), coord_(&coord) {}
+    task_pool(Pool& pool, coordinator& coord) : pool_(&pool), coord_(&coord) {}
 
     void resume(error_code ec = {})
     {
@@ -231,40 +241,90 @@ void run_nopool(mysql::any_address server_addr, bool use_ssl)
     std::cout << coord.ellapsed().count() << std::flush;
 }
 
-void run_pool(mysql::any_address server_addr, bool use_ssl)
+mysql::pool_params make_pool_params(
+    mysql::any_address server_addr,
+    bool use_ssl,
+    std::size_t max_size = num_parallel
+)
 {
-    // Setup
-    asio::io_context ctx;
     mysql::pool_params params;
     params.server_address = std::move(server_addr);
     params.username = "example_user";
     params.password = "example_password";
     params.database = "boost_mysql_examples";
-    params.max_size = num_parallel;
+    params.max_size = max_size;
     params.ssl = use_ssl ? mysql::ssl_mode::require : mysql::ssl_mode::disable;
+    return params;
+}
 
-    mysql::connection_pool pool(ctx, std::move(params));
+// Launches num_parallel tasks against pool, running ctx in num_threads threads
+template <class Pool>
+void run_pool_tasks(asio::io_context& ctx, Pool& pool, std::size_t num_threads)
+{
     pool.async_run(asio::detached);
 
-    std::vector<task_pool> conns;
-    coordinator coord(&pool);
+    std::vector<task_pool<Pool>> conns;
+    coordinator coord([&pool] { pool.cancel(); });
 
     // Create connections
     for (std::size_t i = 0; i < num_parallel; ++i)
         conns.emplace_back(pool, coord);
 
-    // Launch
+    // Launch. Tasks are posted so they get distributed between threads
     coord.record_start();
     for (auto& conn : conns)
-        conn.resume(error_code());
+        asio::post(ctx, [&conn] { conn.resume(error_code()); });
 
     // Run
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < num_threads; ++i)
+        threads.emplace_back([&ctx] { ctx.run(); });
     ctx.run();
+    for (auto& t : threads)
+        t.join();
 
     // Print ellapsed time
     std::cout << coord.ellapsed().count() << std::flush;
 }
 
+void run_pool(mysql::any_address server_addr, bool use_ssl)
+{
+    asio::io_context ctx;
+    mysql::connection_pool pool(ctx, make_pool_params(std::move(server_addr), use_ssl));
+    run_pool_tasks(ctx, pool, 1);
+}
+
+// The pool is exhausted most of the time, with 10 waiters per connection
+void run_pool_exhausted(mysql::any_address server_addr, bool use_ssl)
+{
+    asio::io_context ctx;
+    mysql::connection_pool pool(ctx, make_pool_params(std::move(server_addr), use_ssl, num_parallel / 10));
+    run_pool_tasks(ctx, pool, 1);
+}
+
+// Multi-threaded scenarios. A thread-safe pool serializes all requests through a single strand,
+// while a sharded pool splits them between num_threads strands
+std::size_t get_num_threads() { return (std::max)(std::thread::hardware_concurrency(), 2u); }
+
+void run_pool_mt(mysql::any_address server_addr, bool use_ssl)
+{
+    const auto num_threads = get_num_threads();
+    asio::io_context ctx(static_cast<int>(num_threads));
+    mysql::connection_pool pool(
+        mysql::pool_executor_params::thread_safe(ctx.get_executor()),
+        make_pool_params(std::move(server_addr), use_ssl)
+    );
+    run_pool_tasks(ctx, pool, num_threads);
+}
+
+void run_sharded_pool_mt(mysql::any_address server_addr, bool use_ssl)
+{
+    const auto num_threads = get_num_threads();
+    asio::io_context ctx(static_cast<int>(num_threads));
+    mysql::sharded_connection_pool pool(ctx, make_pool_params(std::move(server_addr), use_ssl), num_threads);
+    run_pool_tasks(ctx, pool, num_threads);
+}
+
 static constexpr const char* options[] = {
     "nopool-tcp",
     "nopool-tcpssl",
@@ -272,6 +332,12 @@ static constexpr const char* options[] = {
     "pool-tcp",
     "pool-tcpssl",
     "pool-unix",
+    "pool-exhausted-tcp",
+    "pool-exhausted-unix",
+    "pool-mt-tcp",
+    "pool-mt-unix",
+    "sharded-pool-mt-tcp",
+    "sharded-pool-mt-unix",
 };
 
 void usage(const char* progname)
@@ -323,6 +389,33 @@ int main(int argc, char** argv)
     {
         run_pool(mysql::unix_path{default_unix_path}, false);
     }
+    else if (opt == "pool-exhausted-tcp")
+    {
+        tcp_addr.host = addr;
+        run_pool_exhausted(std::move(tcp_addr), false);
+    }
+    else if (opt == "pool-exhausted-unix")
+    {
+        run_pool_exhausted(mysql::unix_path{default_unix_path}, false);
+    }
+    else if (opt == "pool-mt-tcp")
+    {
+        tcp_addr.host = addr;
+        run_pool_mt(std::move(tcp_addr), false);
+    }
+    else if (opt == "pool-mt-unix")
+    {
+        run_pool_mt(mysql::unix_path{default_unix_path}, false);
+    }
+    else if (opt == "sharded-pool-mt-tcp")
+    {
+        tcp_addr.host = addr;
+        run_sharded_pool_mt(std::move(tcp_addr), false);
+    }
+    else if (opt == "sharded-pool-mt-unix")
+    {
+        run_sharded_pool_mt(mysql::unix_path{default_unix_path}, false);
+    }
     else
         usage(argv[0]);
 }
@@ -0,0 +1,139 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/error_code.hpp>
+
+#include <boost/mysql/impl/internal/protocol/frame_header.hpp>
+#include <boost/mysql/impl/internal/sansio/message_reader.hpp>
+
+#include <boost/core/span.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// Measures the time required to parse big, multi-frame messages
+// (like the ones generated by rows containing 64MB+ BLOBs), and the number
+// of bytes the reader moves around its buffer while doing it.
+// This doesn't require a server: the bytes are generated in memory
+// and fed to the reader in chunks, simulating socket reads.
+// Usage: boost_mysql_bench_message_reader <message-size-MB> <read-size-KB>
+// Prints <elapsed-ms>,<bytes-moved-per-message>
+
+using boost::mysql::error_code;
+using std::chrono::steady_clock;
+namespace detail = boost::mysql::detail;
+
+namespace {
+
+static constexpr std::size_t num_iterations = 10;
+
+// Generates a message of the given size, split in frames
+std::vector<std::uint8_t> create_message(std::size_t body_size)
+{
+    std::vector<std::uint8_t> res;
+    res.reserve(body_size + (body_size / detail::max_packet_size + 1) * detail::frame_header_size);
+    std::uint8_t seqnum = 0;
+    std::size_t remaining = body_size;
+    while (true)
+    {
+        std::size_t frame_size = remaining < detail::max_packet_size ? remaining : detail::max_packet_size;
+        std::uint8_t header[detail::frame_header_size]{};
+        detail::serialize_frame_header(
+            boost::span<std::uint8_t, detail::frame_header_size>(header),
+            detail::frame_header{static_cast<std::uint32_t>(frame_size), seqnum++}
+        );
+        res.insert(res.end(), header, header + detail::frame_header_size);
+        res.resize(res.size() + frame_size, 0xab);
+        remaining -= frame_size;
+        if (frame_size < detail::max_packet_size)
+            break;
+    }
+    return res;
+}
+
+// Reads a message, copying at most read_size bytes at a time
+std::size_t read_message(
+    detail::message_reader& reader,
+    const std::vector<std::uint8_t>& contents,
+    std::size_t read_size
+)
+{
+    std::uint8_t seqnum = 0;
+    std::size_t offset = 0;
+    reader.prepare_read(seqnum);
+    while (!reader.done())
+    {
+        error_code ec = reader.prepare_buffer();
+        if (ec)
+        {
+            std::cerr << "Error preparing buffer: " << ec << std::endl;
+            exit(1);
+        }
+        std::size_t to_copy = (std::min)({reader.buffer().size(), contents.size() - offset, read_size});
+        std::memcpy(reader.buffer().data(), contents.data() + offset, to_copy);
+        offset += to_copy;
+        reader.resume(to_copy);
+    }
+    if (reader.error())
+    {
+        std::cerr << "Error parsing message: " << reader.error() << std::endl;
+        exit(1);
+    }
+    return reader.message().size();
+}
+
+void usage(const char* progname)
+{
+    std::cerr << "Usage: " << progname << " <message-size-MB> <read-size-KB>\n";
+    exit(1);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+        usage(argv[0]);
+
+    std::size_t message_size = std::strtoull(argv[1], nullptr, 10) * 1024u * 1024u;
+    std::size_t read_size = std::strtoull(argv[2], nullptr, 10) * 1024u;
+    if (message_size == 0u || read_size == 0u)
+        usage(argv[0]);
+
+    // Setup
+    auto contents = create_message(message_size);
+    detail::message_reader reader(512);
+
+    // Warm up. This makes the buffer grow to its final size
+    read_message(reader, contents, read_size);
+
+    // Run
+    std::size_t initial_bytes_moved = reader.bytes_moved();
+    auto tp_start = steady_clock::now();
+    std::size_t total_bytes = 0;
+    for (std::size_t i = 0; i < num_iterations; ++i)
+        total_bytes += read_message(reader, contents, read_size);
+    auto tp_finish = steady_clock::now();
+    std::size_t bytes_moved = (reader.bytes_moved() - initial_bytes_moved) / num_iterations;
+
+    // Sanity check
+    if (total_bytes != message_size * num_iterations)
+    {
+        std::cerr << "Parsed an unexpected number of bytes: " << total_bytes << std::endl;
+        exit(1);
+    }
+
+    // Print elapsed time and copy volume
+    std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(tp_finish - tp_start).count()
+              << ',' << bytes_moved << std::flush;
+}
@@ -13,6 +13,12 @@ benchs=(
    "pool-tcp"
    "pool-tcpssl"
    "pool-unix"
+   "pool-exhausted-tcp"
+   "pool-exhausted-unix"
+   "pool-mt-tcp"
+   "pool-mt-unix"
+   "sharded-pool-mt-tcp"
+   "sharded-pool-mt-unix"
 )
 
 outfile=private/benchmark-results.txt
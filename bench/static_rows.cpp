@@ -0,0 +1,207 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/coldef_view.hpp>
+#include <boost/mysql/detail/execution_processor/static_execution_state_impl.hpp>
+#include <boost/mysql/detail/flags.hpp>
+#include <boost/mysql/detail/resultset_encoding.hpp>
+#include <boost/mysql/detail/typing/row_traits.hpp>
+
+#include <boost/mysql/impl/internal/protocol/deserialization.hpp>
+
+#include <boost/core/span.hpp>
+#include <boost/endian/conversion.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Measures the time required to parse rows into static types (as static_execution_state does)
+// for wide rows containing integers and strings.
+// This doesn't require a server: row messages are generated in memory.
+// Compares the current implementation (parsing rows directly into the output type)
+// against the old one (deserializing into field_views, then parsing into the output type).
+// Usage: boost_mysql_bench_static_rows <text|binary> <direct|field_view>
+
+using namespace boost::mysql;
+using boost::span;
+using std::chrono::steady_clock;
+
+namespace {
+
+static constexpr std::size_t num_rows = 100000;
+static constexpr std::size_t num_iterations = 20;
+static constexpr std::size_t num_ints = 8;
+static constexpr std::size_t num_strings = 8;
+static constexpr std::size_t num_fields = num_ints + num_strings;
+
+// clang-format off
+using row_t = std::tuple<
+    std::int64_t, std::int64_t, std::int64_t, std::int64_t,
+    std::int64_t, std::int64_t, std::int64_t, std::int64_t,
+    std::string, std::string, std::string, std::string,
+    std::string, std::string, std::string, std::string
+>;
+// clang-format on
+
+const char string_value[] = "a string value of a typical length";
+
+void add_lenenc_string(std::vector<std::uint8_t>& to, string_view value)
+{
+    // All our values are shorter than 251 bytes, so the length takes a single byte
+    to.push_back(static_cast<std::uint8_t>(value.size()));
+    to.insert(to.end(), value.begin(), value.end());
+}
+
+std::vector<std::uint8_t> create_row(detail::resultset_encoding enc, std::int64_t int_value)
+{
+    std::vector<std::uint8_t> res;
+    if (enc == detail::resultset_encoding::text)
+    {
+        auto int_str = std::to_string(int_value);
+        for (std::size_t i = 0; i < num_ints; ++i)
+            add_lenenc_string(res, int_str);
+    }
+    else
+    {
+        // Header and NULL bitmap, with no NULL values
+        res.push_back(0x00);
+        res.resize(res.size() + (num_fields + 7 + 2) / 8, 0x00);
+        for (std::size_t i = 0; i < num_ints; ++i)
+        {
+            std::uint8_t buff[8];
+            boost::endian::endian_store<std::int64_t, 8, boost::endian::order::little>(buff, int_value);
+            res.insert(res.end(), buff, buff + 8);
+        }
+    }
+    for (std::size_t i = 0; i < num_strings; ++i)
+        add_lenenc_string(res, string_value);
+    return res;
+}
+
+detail::coldef_view create_coldef(column_type type, string_view name)
+{
+    detail::coldef_view res{};
+    res.name = name;
+    res.org_name = name;
+    res.collation_id = 45;  // utf8mb4_general_ci
+    res.type = type;
+    res.flags = detail::column_flags::not_null;
+    return res;
+}
+
+void check_error(error_code ec, const char* what)
+{
+    if (ec)
+    {
+        std::cerr << what << ": " << ec << std::endl;
+        exit(1);
+    }
+}
+
+void usage(const char* progname)
+{
+    std::cerr << "Usage: " << progname << " <text|binary> <direct|field_view>\n";
+    exit(1);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+        usage(argv[0]);
+
+    // Parse arguments
+    string_view encoding_arg = argv[1];
+    string_view method_arg = argv[2];
+    detail::resultset_encoding enc{};
+    if (encoding_arg == "text")
+        enc = detail::resultset_encoding::text;
+    else if (encoding_arg == "binary")
+        enc = detail::resultset_encoding::binary;
+    else
+        usage(argv[0]);
+    bool use_direct{};
+    if (method_arg == "direct")
+        use_direct = true;
+    else if (method_arg == "field_view")
+        use_direct = false;
+    else
+        usage(argv[0]);
+
+    // Setup the execution state, as if it had received the metadata
+    const std::string names[num_fields] =
+        {"i0", "i1", "i2", "i3", "i4", "i5", "i6", "i7", "s0", "s1", "s2", "s3", "s4", "s5", "s6", "s7"};
+    detail::static_execution_state_impl<row_t> stp;
+    auto& st = stp.get_interface();
+    diagnostics diag;
+    st.reset(enc, metadata_mode::minimal);
+    st.on_num_meta(num_fields);
+    for (std::size_t i = 0; i < num_fields; ++i)
+    {
+        auto type = i < num_ints ? column_type::bigint : column_type::varchar;
+        check_error(st.on_meta(create_coldef(type, names[i]), diag), "Error processing metadata");
+    }
+
+    // Rows
+    std::vector<std::vector<std::uint8_t>> rows;
+    rows.reserve(num_rows);
+    for (std::size_t i = 0; i < num_rows; ++i)
+        rows.push_back(create_row(enc, static_cast<std::int64_t>(i * 1000)));
+    std::vector<row_t> output(num_rows);
+    std::vector<field_view> fields;
+    std::size_t pos_map[num_fields];
+    for (std::size_t i = 0; i < num_fields; ++i)
+        pos_map[i] = i;
+
+    // Run
+    auto tp_start = steady_clock::now();
+    for (std::size_t it = 0; it < num_iterations; ++it)
+    {
+        for (std::size_t i = 0; i < num_rows; ++i)
+        {
+            if (use_direct)
+            {
+                auto ref = stp.make_output_ref(span<row_t>(output), i);
+                check_error(st.on_row(rows[i], ref, fields), "Error parsing row");
+            }
+            else
+            {
+                fields.resize(num_fields);
+                auto ec = detail::deserialize_row(enc, rows[i], st.meta(), fields);
+                check_error(ec, "Error deserializing row");
+                check_error(detail::parse<row_t>(pos_map, fields, output[i]), "Error parsing row");
+            }
+        }
+    }
+    auto tp_finish = steady_clock::now();
+
+    // Sanity check
+    if (std::get<7>(output[num_rows - 1]) != static_cast<std::int64_t>((num_rows - 1) * 1000) ||
+        std::get<15>(output[num_rows - 1]) != string_value)
+    {
+        std::cerr << "Parsed unexpected values" << std::endl;
+        exit(1);
+    }
+
+    // Print ellapsed time
+    std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(tp_finish - tp_start).count()
+              << std::flush;
+}
@@ -0,0 +1,187 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/coldef_view.hpp>
+#include <boost/mysql/detail/flags.hpp>
+
+#include <boost/mysql/impl/internal/protocol/impl/text_protocol.hpp>
+
+#include <boost/charconv/from_chars.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// Measures the time required to parse integers in text resultsets,
+// using a set of value distributions that resemble real columns.
+// This doesn't require a server: values are generated in memory.
+// Compares the library's implementation against a plain charconv::from_chars loop.
+// Usage: boost_mysql_bench_text_ints <ids|tinyint|timestamps|bigint|mixed> <library|charconv>
+
+using namespace boost::mysql;
+using std::chrono::steady_clock;
+
+namespace {
+
+static constexpr std::size_t num_values = 1000000;
+static constexpr std::size_t num_iterations = 20;
+
+// Generates the string representation of the values to parse
+std::vector<std::string> create_values(string_view distribution, bool& is_unsigned)
+{
+    std::mt19937_64 gen(42);
+    std::vector<std::string> res;
+    res.reserve(num_values);
+    is_unsigned = false;
+
+    for (std::size_t i = 0; i < num_values; ++i)
+    {
+        if (distribution == "ids")
+        {
+            // Auto-incremented primary keys: 1 to 7 digits
+            res.push_back(std::to_string(std::uniform_int_distribution<std::int64_t>(1, 9999999)(gen)));
+        }
+        else if (distribution == "tinyint")
+        {
+            // Small values and flags, including negative ones
+            res.push_back(std::to_string(std::uniform_int_distribution<std::int64_t>(-128, 127)(gen)));
+        }
+        else if (distribution == "timestamps")
+        {
+            // UNIX timestamps in milliseconds: 13 digits
+            res.push_back(std::to_string(
+                std::uniform_int_distribution<std::int64_t>(1500000000000, 1800000000000)(gen)
+            ));
+        }
+        else if (distribution == "bigint")
+        {
+            // Unsigned hashes spanning the full range: mostly 19-20 digits
+            is_unsigned = true;
+            res.push_back(std::to_string(gen()));
+        }
+        else if (distribution == "mixed")
+        {
+            // A mix of all the above
+            switch (gen() % 4u)
+            {
+            case 0: res.push_back(std::to_string(gen() % 10000000u)); break;
+            case 1: res.push_back(std::to_string(static_cast<std::int64_t>(gen() % 256u) - 128)); break;
+            case 2: res.push_back(std::to_string(1500000000000 + gen() % 300000000000)); break;
+            default: res.push_back(std::to_string(static_cast<std::int64_t>(gen() >> 1))); break;
+            }
+        }
+        else
+        {
+            return {};
+        }
+    }
+    return res;
+}
+
+metadata create_int_meta(bool is_unsigned)
+{
+    detail::coldef_view coldef{};
+    coldef.type = column_type::bigint;
+    coldef.flags = static_cast<std::uint16_t>(
+        is_unsigned ? detail::column_flags::not_null | detail::column_flags::unsigned_
+                    : detail::column_flags::not_null
+    );
+    return detail::access::construct<metadata>(coldef, false);
+}
+
+// Parses all values using the library. Returns a checksum, to prevent the compiler from optimizing away
+std::uint64_t parse_library(const std::vector<std::string>& values, const metadata& meta)
+{
+    std::uint64_t res = 0;
+    field_view fv;
+    for (const auto& v : values)
+    {
+        if (detail::deserialize_text_field(v, meta, fv) != detail::deserialize_errc::ok)
+        {
+            std::cerr << "Error parsing value: " << v << std::endl;
+            exit(1);
+        }
+        res += fv.is_int64() ? static_cast<std::uint64_t>(fv.get_int64()) : fv.get_uint64();
+    }
+    return res;
+}
+
+// Parses all values using charconv::from_chars, as a baseline
+template <class T>
+std::uint64_t parse_charconv(const std::vector<std::string>& values)
+{
+    std::uint64_t res = 0;
+    for (const auto& v : values)
+    {
+        T parsed{};
+        auto r = boost::charconv::from_chars(v.data(), v.data() + v.size(), parsed);
+        if (r.ec != std::errc() || r.ptr != v.data() + v.size())
+        {
+            std::cerr << "Error parsing value: " << v << std::endl;
+            exit(1);
+        }
+        res += static_cast<std::uint64_t>(parsed);
+    }
+    return res;
+}
+
+void usage(const char* progname)
+{
+    std::cerr << "Usage: " << progname << " <ids|tinyint|timestamps|bigint|mixed> <library|charconv>\n";
+    exit(1);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+        usage(argv[0]);
+
+    // Setup
+    bool is_unsigned = false;
+    auto values = create_values(argv[1], is_unsigned);
+    if (values.empty())
+        usage(argv[0]);
+    string_view method = argv[2];
+    if (method != "library" && method != "charconv")
+        usage(argv[0]);
+    bool use_library = method == "library";
+    auto meta = create_int_meta(is_unsigned);
+
+    // Run
+    std::uint64_t checksum = 0;
+    auto tp_start = steady_clock::now();
+    for (std::size_t i = 0; i < num_iterations; ++i)
+    {
+        if (use_library)
+            checksum += parse_library(values, meta);
+        else if (is_unsigned)
+            checksum += parse_charconv<std::uint64_t>(values);
+        else
+            checksum += parse_charconv<std::int64_t>(values);
+    }
+    auto tp_finish = steady_clock::now();
+
+    // Print ellapsed time. Printing the checksum to stderr makes sure that
+    // the computation is not optimized away
+    std::cerr << "Checksum: " << checksum << std::endl;
+    std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(tp_finish - tp_start).count()
+              << std::flush;
+}
@@ -10,14 +10,20 @@
 
 #include <boost/mysql/any_address.hpp>
 #include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/arrow_c_data_interface.hpp>
+#include <boost/mysql/arrow_execution_state.hpp>
 #include <boost/mysql/bad_field_access.hpp>
 #include <boost/mysql/blob.hpp>
 #include <boost/mysql/blob_view.hpp>
 #include <boost/mysql/buffer_params.hpp>
+#include <boost/mysql/cached_statement.hpp>
 #include <boost/mysql/character_set.hpp>
 #include <boost/mysql/client_errc.hpp>
 #include <boost/mysql/column_type.hpp>
+#include <boost/mysql/column_view.hpp>
+#include <boost/mysql/columnar_results.hpp>
 #include <boost/mysql/common_server_errc.hpp>
+#include <boost/mysql/compression_algorithm.hpp>
 #include <boost/mysql/connect_params.hpp>
 #include <boost/mysql/connection.hpp>
 #include <boost/mysql/connection_pool.hpp>
@@ -32,12 +38,14 @@
 #include <boost/mysql/error_with_diagnostics.hpp>
 #include <boost/mysql/escape_string.hpp>
 #include <boost/mysql/execution_state.hpp>
+#include <boost/mysql/execution_summary.hpp>
 #include <boost/mysql/field.hpp>
 #include <boost/mysql/field_kind.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/format_sql.hpp>
 #include <boost/mysql/handshake_params.hpp>
 #include <boost/mysql/is_fatal_error.hpp>
+#include <boost/mysql/local_infile.hpp>
 #include <boost/mysql/mariadb_collations.hpp>
 #include <boost/mysql/mariadb_server_errc.hpp>
 #include <boost/mysql/metadata.hpp>
@@ -47,6 +55,7 @@
 #include <boost/mysql/mysql_server_errc.hpp>
 #include <boost/mysql/pipeline.hpp>
 #include <boost/mysql/pool_params.hpp>
+#include <boost/mysql/pool_stats.hpp>
 #include <boost/mysql/results.hpp>
 #include <boost/mysql/resultset.hpp>
 #include <boost/mysql/resultset_view.hpp>
@@ -54,6 +63,9 @@
 #include <boost/mysql/row_view.hpp>
 #include <boost/mysql/rows.hpp>
 #include <boost/mysql/rows_view.hpp>
+#include <boost/mysql/session_track.hpp>
+#include <boost/mysql/session_track_view.hpp>
+#include <boost/mysql/sharded_connection_pool.hpp>
 #include <boost/mysql/ssl_mode.hpp>
 #include <boost/mysql/statement.hpp>
 #include <boost/mysql/static_execution_state.hpp>
@@ -66,6 +78,7 @@
 #include <boost/mysql/underlying_row.hpp>
 #include <boost/mysql/unix.hpp>
 #include <boost/mysql/unix_ssl.hpp>
+#include <boost/mysql/with_cursor.hpp>
 #include <boost/mysql/with_diagnostics.hpp>
 #include <boost/mysql/with_params.hpp>
 
@@ -9,12 +9,16 @@
 #define BOOST_MYSQL_ANY_CONNECTION_HPP
 
 #include <boost/mysql/any_address.hpp>
+#include <boost/mysql/arrow_execution_state.hpp>
+#include <boost/mysql/blob_view.hpp>
 #include <boost/mysql/character_set.hpp>
+#include <boost/mysql/columnar_results.hpp>
 #include <boost/mysql/connect_params.hpp>
 #include <boost/mysql/defaults.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/execution_state.hpp>
+#include <boost/mysql/local_infile.hpp>
 #include <boost/mysql/metadata_mode.hpp>
 #include <boost/mysql/rows_view.hpp>
 #include <boost/mysql/statement.hpp>
@@ -34,9 +38,11 @@
 #include <boost/asio/any_io_executor.hpp>
 #include <boost/asio/deferred.hpp>
 #include <boost/assert.hpp>
+#include <boost/container/container_fwd.hpp>
 #include <boost/system/result.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -107,6 +113,55 @@ struct any_connection_params
      * system variable, too.
      */
     std::size_t max_buffer_size{0x4000000};
+
+    /**
+     * \brief The size above which the connection's buffers are shrunk on session reset (disabled by default).
+     * \details
+     * Reading big rows or sending big requests makes the connection's buffers grow,
+     * up to \ref max_buffer_size. By default, buffers never shrink, so a single big
+     * resultset makes the connection hold that memory for the rest of its life.
+     * \n
+     * If a buffer is bigger than this value when the connection's session is reset
+     * (by \ref any_connection::reset_connection, \ref any_connection::async_reset_connection
+     * or a pipeline containing a reset stage), its memory is released and it goes back to
+     * \ref initial_buffer_size bytes. Connection pools reset connections when they're returned,
+     * so setting this in \ref pool_params::buffer_shrink_threshold shrinks buffers automatically.
+     */
+    std::size_t buffer_shrink_threshold{static_cast<std::size_t>(-1)};
+
+    /**
+     * \brief A memory resource to allocate the connection's read buffer from.
+     * \details
+     * If set to a non-null value, memory for the connection's read buffer (which may grow up to
+     * \ref max_buffer_size) will be obtained from this resource. This allows using
+     * arenas, per-thread pools or huge-page backed allocators for connection buffers.
+     * If `nullptr` (the default), memory is obtained using `std::allocator`.
+     * \n
+     * Only the read buffer (and, when using compression, the buffer for compressed
+     * incoming frames) uses this resource. The buffers used to compose outgoing requests
+     * are usually small, and are always allocated using `std::allocator`.
+     *
+     * \par Object lifetimes
+     * If set to non-null, the pointee object must be kept alive until
+     * all \ref any_connection objects constructed from `*this` are destroyed.
+     */
+    container::pmr::memory_resource* buffer_memory_resource{};
+
+    /**
+     * \brief The maximum number of statements kept by the connection's statement cache.
+     * \details
+     * Executing a \ref cached_statement_t (as created by \ref cached_statement) prepares
+     * the statement the first time it's used, and keeps it in a per-connection cache keyed by
+     * its SQL text. Subsequent executions reuse the prepared statement, saving a round-trip.
+     * When the cache is full, the least recently used statement is closed to make room.
+     * \n
+     * The server deallocates prepared statements when the session is reset or the connection
+     * is re-established, and so the cache is cleared in these cases.
+     * \n
+     * The cache is only populated when using \ref cached_statement_t, so this setting
+     * has no effect otherwise. Must be greater than zero.
+     */
+    std::size_t statement_cache_size{64};
 };
 
 /**
@@ -152,7 +207,14 @@ class any_connection
 
     // Used by tests
     any_connection(std::unique_ptr<detail::engine> eng, any_connection_params params)
-        : impl_(params.initial_buffer_size, params.max_buffer_size, std::move(eng))
+        : impl_(
+              params.initial_buffer_size,
+              params.max_buffer_size,
+              params.buffer_shrink_threshold,
+              params.buffer_memory_resource,
+              params.statement_cache_size,
+              std::move(eng)
+          )
     {
     }
 
@@ -330,6 +392,32 @@ public:
     /// \copydoc connection::set_meta_mode
     void set_meta_mode(metadata_mode v) noexcept { impl_.set_meta_mode(v); }
 
+    /**
+     * \brief (EXPERIMENTAL) Sets the handler that supplies file contents for `LOAD DATA LOCAL INFILE`.
+     * \details
+     * The handler is invoked when the server requests the contents of a file,
+     * as a result of executing a `LOAD DATA LOCAL INFILE` statement. See \ref local_infile_handler
+     * for the semantics. Passing an empty function removes the handler. If no handler is set,
+     * the library tells the server that the file is empty, and the operation fails with
+     * \ref client_errc::local_infile_no_handler.
+     * \n
+     * The handler is kept across reconnections. The server must have the `local_infile` variable
+     * enabled for these statements to work.
+     * \n
+     * `LOAD DATA LOCAL INFILE` statements are not supported in pipelines
+     * (see \ref async_run_pipeline). If the server requests a file while running a pipeline,
+     * the handler is not invoked, and the pipeline fails with the fatal error
+     * \ref client_errc::local_infile_in_pipeline.
+     *
+     * \par Exception safety
+     * Basic guarantee. Memory allocations may throw.
+     *
+     * \par Experimental
+     * This part of the API is experimental, and may change in successive
+     * releases without previous notice.
+     */
+    void set_local_infile_handler(local_infile_handler h) { impl_.set_local_infile_handler(std::move(h)); }
+
     /**
      * \brief Establishes a connection to a MySQL server.
      * \details
@@ -606,6 +694,107 @@ public:
             .async_run(impl_.make_params_close_statement(stmt), diag, std::forward<CompletionToken>(token));
     }
 
+    /**
+     * \brief (EXPERIMENTAL) Sends part of a statement parameter's value to the server.
+     * \details
+     * Appends `data` to the value of the statement parameter with index `param_index`
+     * (zero-based), using `COM_STMT_SEND_LONG_DATA`. The server accumulates the data
+     * sent by successive calls, and uses it as the parameter value when the statement
+     * is next executed. This allows sending big `BLOB` or `TEXT` values in chunks,
+     * without ever holding the complete value in memory. Each call requires a buffer
+     * big enough to hold `data`, bounded by \ref any_connection_params::max_buffer_size.
+     * \n
+     * When executing the statement, you still need to bind a value for the parameter.
+     * Its type is sent to the server, but its value is ignored. Use an empty string for `TEXT`
+     * columns, and an empty blob for `BLOB` columns. Once the statement is executed, the
+     * server discards the accumulated data, and subsequent executions send bound values as usual.
+     * Closing the statement or resetting the session also discards the data.
+     * \n
+     * The server doesn't send any response to this request. Errors, like exceeding the server's
+     * `max_long_data_size`, are reported when the statement is executed.
+     * \n
+     * Statements with accumulated data must be executed using \ref execute or \ref start_execution,
+     * and not as part of a pipeline (see \ref run_pipeline).
+     *
+     * \par Errors
+     * \li \ref client_errc::wrong_num_params if `param_index` is not less than `stmt.num_params()`.
+     * \li \ref client_errc::max_buffer_size_exceeded if `data` doesn't fit in the write buffer.
+     *
+     * \par Preconditions
+     * `stmt.valid() == true`
+     *
+     * \par Object lifetimes
+     * The memory pointed to by `data` must be kept alive until the operation completes.
+     *
+     * \par Experimental
+     * This part of the API is experimental, and may change in successive
+     * releases without previous notice.
+     */
+    void send_long_data(
+        const statement& stmt,
+        std::uint16_t param_index,
+        blob_view data,
+        error_code& err,
+        diagnostics& diag
+    )
+    {
+        impl_.run(impl_.make_params_send_long_data(stmt, param_index, data), err, diag);
+    }
+
+    /// \copydoc send_long_data
+    void send_long_data(const statement& stmt, std::uint16_t param_index, blob_view data)
+    {
+        error_code err;
+        diagnostics diag;
+        send_long_data(stmt, param_index, data, err, diag);
+        detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+    }
+
+    /**
+     * \copydoc send_long_data
+     * \details
+     * \n
+     * \par Handler signature
+     * The handler signature for this operation is `void(boost::mysql::error_code)`.
+     */
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_send_long_data(
+        const statement& stmt,
+        std::uint16_t param_index,
+        blob_view data,
+        CompletionToken&& token = {}
+    ) BOOST_MYSQL_RETURN_TYPE(detail::async_send_long_data_t<CompletionToken&&>)
+    {
+        return async_send_long_data(
+            stmt,
+            param_index,
+            data,
+            impl_.shared_diag(),
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /// \copydoc async_send_long_data
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_send_long_data(
+        const statement& stmt,
+        std::uint16_t param_index,
+        blob_view data,
+        diagnostics& diag,
+        CompletionToken&& token = {}
+    ) BOOST_MYSQL_RETURN_TYPE(detail::async_send_long_data_t<CompletionToken&&>)
+    {
+        return impl_.async_run(
+            impl_.make_params_send_long_data(stmt, param_index, data),
+            diag,
+            std::forward<CompletionToken>(token)
+        );
+    }
+
     /// \copydoc connection::read_some_rows
     rows_view read_some_rows(execution_state& st, error_code& err, diagnostics& diag)
     {
@@ -643,6 +832,126 @@ public:
             .async_run(impl_.make_params_read_some_rows(st), diag, std::forward<CompletionToken>(token));
     }
 
+    /**
+     * \brief Reads a batch of rows into a columnar results object.
+     * \details
+     * Reads a batch of rows of unspecified size, appending their values to the columns
+     * of the resultset currently being processed by `st`. Values are written into the column
+     * arrays while rows are deserialized.
+     * \n
+     * Returns the number of read rows. The total number of rows read for the resultset
+     * is available in `st.num_rows(st.size() - 1)`.
+     * \n
+     * If there are no more rows, or `st.should_read_rows() == false`, this function is a no-op and returns
+     * zero.
+     * \n
+     * The number of rows that will be read depends on the connection's buffer size. The bigger the buffer,
+     * the greater the batch size (up to a maximum).
+     * \n
+     * Values stored in `st` are owning, and don't hold any reference to the connection's internal buffers.
+     */
+    std::size_t read_some_rows(columnar_results& st, error_code& err, diagnostics& diag)
+    {
+        return impl_.run(impl_.make_params_read_some_rows_columnar(st), err, diag);
+    }
+
+    /// \copydoc read_some_rows(columnar_results&,error_code&,diagnostics&)
+    std::size_t read_some_rows(columnar_results& st)
+    {
+        error_code err;
+        diagnostics diag;
+        std::size_t res = read_some_rows(st, err, diag);
+        detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+        return res;
+    }
+
+    /**
+     * \copydoc read_some_rows(columnar_results&,error_code&,diagnostics&)
+     *
+     * \par Handler signature
+     * The handler signature for this operation is
+     * `void(boost::mysql::error_code, std::size_t)`.
+     */
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, std::size_t))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_read_some_rows(columnar_results& st, CompletionToken&& token = {})
+        BOOST_MYSQL_RETURN_TYPE(detail::async_read_some_rows_columnar_t<CompletionToken&&>)
+    {
+        return async_read_some_rows(st, impl_.shared_diag(), std::forward<CompletionToken>(token));
+    }
+
+    /// \copydoc async_read_some_rows(columnar_results&,CompletionToken&&)
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, std::size_t))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_read_some_rows(columnar_results& st, diagnostics& diag, CompletionToken&& token = {})
+        BOOST_MYSQL_RETURN_TYPE(detail::async_read_some_rows_columnar_t<CompletionToken&&>)
+    {
+        return impl_.async_run(
+            impl_.make_params_read_some_rows_columnar(st),
+            diag,
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /**
+     * \brief Reads a batch of rows into the current Arrow record batch.
+     * \details
+     * Reads a batch of rows of unspecified size, appending them to the current record batch in `st`.
+     * At most `st.batch_size() - st.num_buffered_rows()` rows will be read. Use
+     * \ref arrow_execution_state::export_batch to retrieve them.
+     * \n
+     * Returns the number of read rows.
+     * \n
+     * If there are no more rows, `st.should_read_rows() == false` or `st.batch_full() == true`,
+     * this function is a no-op and returns zero.
+     */
+    std::size_t read_some_rows(arrow_execution_state& st, error_code& err, diagnostics& diag)
+    {
+        return impl_.run(impl_.make_params_read_some_rows_arrow(st), err, diag);
+    }
+
+    /// \copydoc read_some_rows(arrow_execution_state&,error_code&,diagnostics&)
+    std::size_t read_some_rows(arrow_execution_state& st)
+    {
+        error_code err;
+        diagnostics diag;
+        std::size_t res = read_some_rows(st, err, diag);
+        detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+        return res;
+    }
+
+    /**
+     * \copydoc read_some_rows(arrow_execution_state&,error_code&,diagnostics&)
+     *
+     * \par Handler signature
+     * The handler signature for this operation is
+     * `void(boost::mysql::error_code, std::size_t)`.
+     */
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, std::size_t))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_read_some_rows(arrow_execution_state& st, CompletionToken&& token = {})
+        BOOST_MYSQL_RETURN_TYPE(detail::async_read_some_rows_arrow_t<CompletionToken&&>)
+    {
+        return async_read_some_rows(st, impl_.shared_diag(), std::forward<CompletionToken>(token));
+    }
+
+    /// \copydoc async_read_some_rows(arrow_execution_state&,CompletionToken&&)
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, std::size_t))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_read_some_rows(arrow_execution_state& st, diagnostics& diag, CompletionToken&& token = {})
+        BOOST_MYSQL_RETURN_TYPE(detail::async_read_some_rows_arrow_t<CompletionToken&&>)
+    {
+        return impl_.async_run(
+            impl_.make_params_read_some_rows_arrow(st),
+            diag,
+            std::forward<CompletionToken>(token)
+        );
+    }
+
 #ifdef BOOST_MYSQL_CXX14
 
     /**
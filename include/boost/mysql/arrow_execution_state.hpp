@@ -0,0 +1,278 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_ARROW_EXECUTION_STATE_HPP
+#define BOOST_MYSQL_ARROW_EXECUTION_STATE_HPP
+
+#include <boost/mysql/arrow_c_data_interface.hpp>
+#include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/execution_processor/arrow_execution_state_impl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief Holds state for multi-function SQL execution operations, producing Apache Arrow record batches.
+ * \details
+ * Use this class with \ref any_connection::start_execution, \ref any_connection::read_some_rows and
+ * \ref any_connection::read_resultset_head to read resultsets into record batches compatible with the
+ * <a href="https://arrow.apache.org/docs/format/CDataInterface.html">Arrow C Data Interface</a>.
+ * No Arrow library is required.
+ * \n
+ * Rows are decoded straight into per-column arrays, which use Arrow's memory layout. Every call to
+ * `read_some_rows` appends rows to the current batch, until it holds \ref batch_size rows.
+ * Calling `read_some_rows` with a full batch is a no-op. Call \ref export_batch to transfer
+ * the buffered rows to an `ArrowArray` and start a new batch. The exported array takes ownership of
+ * the column arrays, so data is not copied. Use \ref export_schema to describe the current resultset.
+ * \n
+ * A typical loop looks like:
+ * \code
+ *   arrow_execution_state st(8192);
+ *   ArrowSchema schema;
+ *   conn.start_execution("SELECT ...", st);
+ *   st.export_schema(schema);
+ *   consume(schema);  // will eventually call schema.release
+ *   while (!st.complete())
+ *   {
+ *       if (st.should_read_head())
+ *       {
+ *           // Multi-resultset operations: the next resultset may have a different schema
+ *           conn.read_resultset_head(st);
+ *           st.export_schema(schema);
+ *           consume(schema);
+ *           continue;
+ *       }
+ *       conn.read_some_rows(st);
+ *       if (st.batch_full() || !st.should_read_rows())
+ *       {
+ *           ArrowArray batch;
+ *           st.export_batch(batch);
+ *           consume(batch);  // will eventually call batch.release
+ *       }
+ *   }
+ * \endcode
+ * \n
+ * Columns are mapped to Arrow types as follows:
+ * \n
+ *   \li Signed integers and `YEAR`: `int64`. Unsigned integers and `BIT`: `uint64`.
+ *   \li `FLOAT`: `float32`. `DOUBLE`: `float64`.
+ *   \li `DATE`: `date32`. `DATETIME` and `TIMESTAMP`: `timestamp[us]`, without timezone.
+ *       Invalid dates and datetimes (e.g. zero dates) are exported as NULL.
+ *   \li `TIME`: `duration[us]`.
+ *   \li `CHAR`, `VARCHAR`, `TEXT`, `ENUM`, `SET`, `JSON` and `DECIMAL`: `large_utf8` (`utf8` on 32-bit
+ *       systems). Use a UTF-8 connection character set to make sure these are valid UTF-8.
+ *   \li Any other type: `large_binary` (`binary` on 32-bit systems).
+ * \n
+ * Column names are only available when using \ref metadata_mode::full. Otherwise, exported
+ * fields have empty names.
+ *
+ * \par Thread safety
+ * Distinct objects: safe. \n
+ * Shared objects: unsafe.
+ */
+class arrow_execution_state
+{
+public:
+    /**
+     * \brief Constructor.
+     * \details The constructed object is guaranteed to have `should_start_op() == true`.
+     *
+     * \par Preconditions
+     * `batch_size > 0`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    explicit arrow_execution_state(std::size_t batch_size = 65536) noexcept : impl_(batch_size) {}
+
+    /**
+     * \brief Returns whether `*this` is in the initial state.
+     * \details
+     * Call \ref any_connection::start_execution or its async counterpart to move forward.
+     * No data is available in this state.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool should_start_op() const noexcept { return impl_.is_reading_first(); }
+
+    /**
+     * \brief Returns whether the next operation should be read resultset head.
+     * \details
+     * Call \ref any_connection::read_resultset_head or its async counterpart to move forward.
+     * Rows that haven't been exported when reading the next resultset's head are discarded.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool should_read_head() const noexcept { return impl_.is_reading_first_subseq(); }
+
+    /**
+     * \brief Returns whether the next operation should be read some rows.
+     * \details
+     * Call \ref any_connection::read_some_rows or its async counterpart to move forward.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool should_read_rows() const noexcept { return impl_.is_reading_rows(); }
+
+    /**
+     * \brief Returns whether all the messages generated by this operation have been read.
+     * \details
+     * The last batch may still hold rows. Call \ref export_batch to retrieve them.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool complete() const noexcept { return impl_.is_complete(); }
+
+    /**
+     * \brief Returns the maximum number of rows per exported batch, as passed to the constructor.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t batch_size() const noexcept { return impl_.batch_size(); }
+
+    /**
+     * \brief Returns the number of rows in the current batch.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t num_buffered_rows() const noexcept { return impl_.num_buffered_rows(); }
+
+    /**
+     * \brief Returns whether the current batch holds \ref batch_size rows.
+     * \details If `true`, call \ref export_batch before reading more rows.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool batch_full() const noexcept { return num_buffered_rows() >= batch_size(); }
+
+    /**
+     * \brief Returns metadata about the columns in the current resultset.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * The returned view points into memory owned by `*this`, and will be valid as long as
+     * `*this` or an object move-constructed from `*this` are alive.
+     */
+    metadata_collection_view meta() const noexcept { return impl_.meta(); }
+
+    /**
+     * \brief Exports the schema of the current resultset.
+     * \details
+     * The schema is a struct (format `"+s"`) with a child per column. Batches produced by
+     * \ref export_batch for this resultset conform to this schema.
+     * \n
+     * The caller takes ownership of `out`, and is responsible for calling its release callback.
+     *
+     * \par Preconditions
+     * `this->should_read_rows() || this->should_read_head() || this->complete()`
+     *
+     * \par Exception safety
+     * Strong guarantee. Memory allocations may throw.
+     */
+    void export_schema(ArrowSchema& out) const { impl_.export_schema(out); }
+
+    /**
+     * \brief Moves the rows in the current batch into an Arrow array.
+     * \details
+     * The array is a struct with a child per column, and \ref num_buffered_rows elements.
+     * Rows are moved, rather than copied. After this function returns, the current batch is empty.
+     * \n
+     * The caller takes ownership of `out`, and is responsible for calling its release callback.
+     * Exported arrays don't reference `*this`, and may outlive it.
+     * \n
+     * Returns the number of exported rows.
+     *
+     * \par Exception safety
+     * Basic guarantee. Memory allocations may throw. If an exception is thrown,
+     * rows in the current batch are discarded.
+     */
+    std::size_t export_batch(ArrowArray& out) { return impl_.export_batch(out); }
+
+    /**
+     * \brief Returns the number of rows affected by the SQL statement associated to this resultset.
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Preconditions
+     * `this->complete() == true || this->should_read_head() == true`
+     */
+    std::uint64_t affected_rows() const noexcept { return impl_.get_affected_rows(); }
+
+    /**
+     * \brief Returns the last insert ID produced by the SQL statement associated to this resultset.
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Preconditions
+     * `this->complete() == true || this->should_read_head() == true`
+     */
+    std::uint64_t last_insert_id() const noexcept { return impl_.get_last_insert_id(); }
+
+    /**
+     * \brief Returns the number of warnings produced by the SQL statement associated to this resultset.
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Preconditions
+     * `this->complete() == true || this->should_read_head() == true`
+     */
+    unsigned warning_count() const noexcept { return impl_.get_warning_count(); }
+
+    /**
+     * \brief Returns additional text information about this resultset.
+     * \details
+     * The returned string always uses ASCII encoding, regardless of the connection's character set.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Preconditions
+     * `this->complete() == true || this->should_read_head() == true`
+     *
+     * \par Object lifetimes
+     * The returned view points into memory owned by `*this`, and will be valid as long as
+     * `*this` or an object move-constructed from `*this` are alive.
+     */
+    string_view info() const noexcept { return impl_.get_info(); }
+
+    /**
+     * \brief Returns whether the current resultset represents a procedure OUT params.
+     *
+     * \par Preconditions
+     * `this->complete() == true || this->should_read_head() == true`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool is_out_params() const noexcept { return impl_.get_is_out_params(); }
+
+private:
+    detail::arrow_execution_state_impl impl_;
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,95 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_CACHED_STATEMENT_HPP
+#define BOOST_MYSQL_CACHED_STATEMENT_HPP
+
+#include <boost/mysql/constant_string_view.hpp>
+#include <boost/mysql/with_params.hpp>
+
+#include <boost/mysql/detail/writable_field_traits.hpp>
+
+#include <tuple>
+#include <utility>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief A prepared statement's SQL and parameters, to be executed using the connection's statement cache.
+ * \details
+ * Satisfies `ExecutionRequest` and can thus be passed to \ref any_connection::execute,
+ * \ref any_connection::start_execution and its async counterparts.
+ * \n
+ * When executed, the connection looks up a prepared statement for `sql` in its statement cache.
+ * If there is none, the statement is prepared first and added to the cache.
+ * The statement is then executed with the supplied parameters, as if it had been
+ * bound using \ref statement::bind. Executing the same SQL again
+ * reuses the cached statement, which saves a round-trip to the server.
+ * \n
+ * The cache has a maximum size, set by \ref any_connection_params::statement_cache_size.
+ * When full, preparing a new statement closes the least recently used one.
+ * The cache is cleared when the connection's session is reset
+ * (e.g. by \ref any_connection::async_reset_connection) or when the connection is re-established,
+ * since these deallocate prepared statements in the server.
+ * \n
+ * Objects of this type are usually created using \ref cached_statement.
+ *
+ * \par Object lifetimes
+ * `sql` is stored as a view, as a compile-time string should be used in most cases.
+ * The cache stores its own copy of the SQL text.
+ * `params` follows the same rules as \ref with_params_t::args.
+ *
+ * \par Errors
+ * When passed to \ref any_connection::execute, \ref any_connection::start_execution or
+ * its async counterparts, in addition to the usual network and server-generated errors,
+ * `cached_statement_t` may generate the following errors: \n
+ *   - Any error generated when preparing the statement (e.g. SQL syntax errors).
+ *   - \ref client_errc::wrong_num_params if the number of parameters doesn't match
+ *     the number of placeholders in the statement.
+ */
+template <BOOST_MYSQL_WRITABLE_FIELD... WritableField>
+struct cached_statement_t
+{
+    /// The statement's SQL text. Used as the key in the statement cache.
+    constant_string_view sql;
+
+    /// The parameters to execute the statement with.
+    std::tuple<WritableField...> params;
+};
+
+/**
+ * \brief Creates a statement that will be executed using the connection's statement cache.
+ * \details
+ * Creates a \ref cached_statement_t object by packing the supplied parameters into a tuple,
+ * calling <a href="https://en.cppreference.com/w/cpp/utility/tuple/make_tuple">`std::make_tuple`</a>.
+ * As per `std::make_tuple`, parameters will be decay-copied into the resulting object.
+ * This behavior can be disabled by passing `std::reference_wrapper` objects, which are
+ * transformed into references.
+ * \n
+ * The passed `params` must either satisfy `WritableField`, or be `std::reference_wrapper<T>`
+ * with `T` satisfying `WritableField`.
+ * \n
+ * See \ref cached_statement_t for details on how the execution request works.
+ * This function does not involve communication with the server.
+ *
+ * \par Exception safety
+ * Strong guarantee. Any exception thrown when copying `params` will be propagated.
+ */
+template <class... WritableFieldOrRefWrapper>
+auto cached_statement(constant_string_view sql, WritableFieldOrRefWrapper&&... params)
+    -> cached_statement_t<make_tuple_element_t<WritableFieldOrRefWrapper>...>
+{
+    return {sql, std::make_tuple(std::forward<WritableFieldOrRefWrapper>(params)...)};
+}
+
+}  // namespace mysql
+}  // namespace boost
+
+#include <boost/mysql/impl/cached_statement.hpp>
+
+#endif
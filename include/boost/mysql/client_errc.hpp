@@ -108,6 +108,22 @@ enum class client_errc : int
     /// (EXPERIMENTAL) An operation attempted to read or write a packet larger than the maximum buffer size.
     /// Try increasing \ref any_connection_params::max_buffer_size.
     max_buffer_size_exceeded,
+
+    /// (EXPERIMENTAL) The server requested a file using `LOAD DATA LOCAL INFILE`, but no handler was set.
+    /// Use \ref any_connection::set_local_infile_handler to supply the file contents.
+    local_infile_no_handler,
+
+    /// (EXPERIMENTAL) A statement executed as a batch (see \ref statement::bind_batch) returned a resultset
+    /// with rows. Batches only support statements that don't return rows, like `INSERT` or `UPDATE`.
+    batch_returned_rows,
+
+    /// (EXPERIMENTAL) The server requested a file using `LOAD DATA LOCAL INFILE` while running a pipeline.
+    /// These statements are not supported in pipelines. The connection must be re-established.
+    local_infile_in_pipeline,
+
+    /// (EXPERIMENTAL) A statement executed as a batch (see \ref statement::bind_batch) has parameters
+    /// that received data via \ref any_connection::send_long_data. Batches don't support long data.
+    batch_with_long_data,
 };
 
 BOOST_MYSQL_DECL
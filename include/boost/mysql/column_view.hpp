@@ -0,0 +1,317 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_COLUMN_VIEW_HPP
+#define BOOST_MYSQL_COLUMN_VIEW_HPP
+
+#include <boost/mysql/blob_view.hpp>
+#include <boost/mysql/date.hpp>
+#include <boost/mysql/datetime.hpp>
+#include <boost/mysql/field_kind.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/string_view.hpp>
+#include <boost/mysql/time.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/execution_processor/columnar_results_impl.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief A read-only view of a column stored by \ref columnar_results.
+ * \details
+ * Values are stored contiguously, in a single array determined by \ref kind. For instance,
+ * if `this->kind() == field_kind::int64`, values are available in \ref int64_values.
+ * The storage kind is determined by the column's type, and never changes between rows.
+ * \n
+ * Strings and blobs are stored in a single contiguous byte array (\ref bytes). Value `i`
+ * spans the range `[offsets()[i], offsets()[i+1])`, so \ref offsets has `this->size() + 1` elements.
+ * \n
+ * NULL values are flagged in a validity bitmap (\ref validity_bitmap), and have a default-constructed
+ * value (or an empty range, for strings and blobs) in the value arrays. This layout is compatible
+ * with the one used by Apache Arrow.
+ *
+ * \par Object lifetimes
+ * This is a view type. Instances point into memory owned by a \ref columnar_results object,
+ * and are valid until it's destroyed or used to execute another operation.
+ */
+class column_view
+{
+public:
+    /**
+     * \brief Returns the kind used to store this column's non-NULL values.
+     * \details This is never \ref field_kind::null.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    field_kind kind() const noexcept { return impl_->kind; }
+
+    /**
+     * \brief Returns the number of values in this column.
+     * \details This is the number of rows in the resultset that this column belongs to.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t size() const noexcept { return impl_->size; }
+
+    /**
+     * \brief Returns the number of NULL values in this column.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t null_count() const noexcept { return impl_->null_count; }
+
+    /**
+     * \brief Returns whether the i-th value is NULL.
+     *
+     * \par Preconditions
+     * `i < this->size()`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool is_null(std::size_t i) const noexcept { return impl_->is_null(i); }
+
+    /**
+     * \brief Returns the validity bitmap.
+     * \details
+     * Contains a bit per value, with bit `i % 8` of byte `i / 8` set if the i-th value is not NULL.
+     * Has `(this->size() + 7) / 8` bytes. Unused bits in the last byte are zero.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    span<const std::uint8_t> validity_bitmap() const noexcept
+    {
+        return {impl_->validity.data(), impl_->validity.size()};
+    }
+
+    /**
+     * \brief Returns the values for a column with signed integer values.
+     * \par Preconditions
+     * `this->kind() == field_kind::int64`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    span<const std::int64_t> int64_values() const noexcept
+    {
+        BOOST_ASSERT(kind() == field_kind::int64);
+        return {impl_->int64_values.data(), impl_->int64_values.size()};
+    }
+
+    /**
+     * \brief Returns the values for a column with unsigned integer values.
+     * \par Preconditions
+     * `this->kind() == field_kind::uint64`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    span<const std::uint64_t> uint64_values() const noexcept
+    {
+        BOOST_ASSERT(kind() == field_kind::uint64);
+        return {impl_->uint64_values.data(), impl_->uint64_values.size()};
+    }
+
+    /**
+     * \brief Returns the values for a column with `float` values.
+     * \par Preconditions
+     * `this->kind() == field_kind::float_`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    span<const float> float_values() const noexcept
+    {
+        BOOST_ASSERT(kind() == field_kind::float_);
+        return {impl_->float_values.data(), impl_->float_values.size()};
+    }
+
+    /**
+     * \brief Returns the values for a column with `double` values.
+     * \par Preconditions
+     * `this->kind() == field_kind::double_`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    span<const double> double_values() const noexcept
+    {
+        BOOST_ASSERT(kind() == field_kind::double_);
+        return {impl_->double_values.data(), impl_->double_values.size()};
+    }
+
+    /**
+     * \brief Returns the values for a column with \ref date values.
+     * \par Preconditions
+     * `this->kind() == field_kind::date`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    span<const date> date_values() const noexcept
+    {
+        BOOST_ASSERT(kind() == field_kind::date);
+        return {impl_->date_values.data(), impl_->date_values.size()};
+    }
+
+    /**
+     * \brief Returns the values for a column with \ref datetime values.
+     * \par Preconditions
+     * `this->kind() == field_kind::datetime`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    span<const datetime> datetime_values() const noexcept
+    {
+        BOOST_ASSERT(kind() == field_kind::datetime);
+        return {impl_->datetime_values.data(), impl_->datetime_values.size()};
+    }
+
+    /**
+     * \brief Returns the values for a column with \ref time values.
+     * \par Preconditions
+     * `this->kind() == field_kind::time`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    span<const time> time_values() const noexcept
+    {
+        BOOST_ASSERT(kind() == field_kind::time);
+        return {impl_->time_values.data(), impl_->time_values.size()};
+    }
+
+    /**
+     * \brief Returns the offsets into \ref bytes for a string or blob column.
+     * \details Contains `this->size() + 1` elements. The first one is always zero.
+     *
+     * \par Preconditions
+     * `this->kind() == field_kind::string || this->kind() == field_kind::blob`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    span<const std::size_t> offsets() const noexcept
+    {
+        BOOST_ASSERT(is_binary_like());
+        return {impl_->offsets.data(), impl_->offsets.size()};
+    }
+
+    /**
+     * \brief Returns the contiguous buffer holding all values for a string or blob column.
+     *
+     * \par Preconditions
+     * `this->kind() == field_kind::string || this->kind() == field_kind::blob`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    blob_view bytes() const noexcept
+    {
+        BOOST_ASSERT(is_binary_like());
+        return {impl_->bytes.data(), impl_->bytes.size()};
+    }
+
+    /**
+     * \brief Returns the i-th value of a string column.
+     * \details If the value is NULL, an empty string is returned.
+     *
+     * \par Preconditions
+     * `this->kind() == field_kind::string && i < this->size()`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    string_view get_string(std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(kind() == field_kind::string && i < size());
+        return string_view(
+            reinterpret_cast<const char*>(impl_->bytes.data()) + impl_->offsets[i],
+            impl_->offsets[i + 1] - impl_->offsets[i]
+        );
+    }
+
+    /**
+     * \brief Returns the i-th value of a blob column.
+     * \details If the value is NULL, an empty blob is returned.
+     *
+     * \par Preconditions
+     * `this->kind() == field_kind::blob && i < this->size()`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    blob_view get_blob(std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(kind() == field_kind::blob && i < size());
+        return blob_view(impl_->bytes.data() + impl_->offsets[i], impl_->offsets[i + 1] - impl_->offsets[i]);
+    }
+
+    /**
+     * \brief Returns the i-th value as a \ref field_view.
+     * \details
+     * Provided for convenience. Prefer accessing the typed arrays directly when
+     * processing many values.
+     *
+     * \par Preconditions
+     * `i < this->size()`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    field_view at(std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(i < size());
+        if (is_null(i))
+            return field_view();
+        switch (kind())
+        {
+        case field_kind::int64: return field_view(impl_->int64_values[i]);
+        case field_kind::uint64: return field_view(impl_->uint64_values[i]);
+        case field_kind::float_: return field_view(impl_->float_values[i]);
+        case field_kind::double_: return field_view(impl_->double_values[i]);
+        case field_kind::date: return field_view(impl_->date_values[i]);
+        case field_kind::datetime: return field_view(impl_->datetime_values[i]);
+        case field_kind::time: return field_view(impl_->time_values[i]);
+        case field_kind::string: return field_view(get_string(i));
+        case field_kind::blob: return field_view(get_blob(i));
+        default: BOOST_ASSERT(false); return field_view();
+        }
+    }
+
+private:
+    const detail::column_data* impl_;
+
+    column_view(const detail::column_data& data) noexcept : impl_(&data) {}
+
+    bool is_binary_like() const noexcept
+    {
+        return kind() == field_kind::string || kind() == field_kind::blob;
+    }
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,262 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_COLUMNAR_RESULTS_HPP
+#define BOOST_MYSQL_COLUMNAR_RESULTS_HPP
+
+#include <boost/mysql/column_view.hpp>
+#include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/execution_processor/columnar_results_impl.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief Holds the results of a SQL query in columnar form (struct-of-arrays).
+ * \details
+ * Rather than storing rows, this object stores a contiguous, typed array per column,
+ * which can be accessed using \ref column. Values are written into these arrays
+ * as rows are deserialized, without creating any intermediate row representation.
+ * This layout is well suited for analytic workloads that process a few columns over many rows,
+ * or to hand data over to columnar libraries (like Apache Arrow).
+ * \n
+ * This object can be used with both the single-function and the multi-function interfaces:
+ * \n
+ *   \li Pass it to \ref any_connection::execute to read a complete operation.
+ *   \li Pass it to \ref any_connection::start_execution, then call \ref any_connection::read_some_rows
+ *       and \ref any_connection::read_resultset_head until \ref complete returns `true`.
+ *       Every batch of rows is appended to the columns of the current resultset.
+ * \n
+ * Multi-resultset operations are supported. Every resultset gets its own columns. Use \ref size to
+ * obtain the number of resultsets that have been read so far. All data accessors take an optional
+ * resultset index, which defaults to the first resultset.
+ *
+ * \par Thread safety
+ * Distinct objects: safe. \n
+ * Shared objects: unsafe. \n
+ */
+class columnar_results
+{
+public:
+    /**
+     * \brief Default constructor.
+     * \details Constructs an empty object, with `this->should_start_op() == true`.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    columnar_results() = default;
+
+    /**
+     * \brief Returns whether the object holds a complete result.
+     * \details
+     * Objects populated by \ref any_connection::execute and \ref any_connection::async_execute
+     * are guaranteed to have `this->has_value() == true`. Equivalent to \ref complete.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool has_value() const noexcept { return impl_.is_complete(); }
+
+    /**
+     * \brief Returns whether `*this` is in the initial state.
+     * \details
+     * Call \ref any_connection::start_execution or \ref any_connection::execute to move
+     * forward. No data is available in this state.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool should_start_op() const noexcept { return impl_.is_reading_first(); }
+
+    /**
+     * \brief Returns whether the next operation should be read resultset head.
+     * \details
+     * Call \ref any_connection::read_resultset_head or its async counterpart to move forward.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool should_read_head() const noexcept { return impl_.is_reading_first_subseq(); }
+
+    /**
+     * \brief Returns whether the next operation should be read some rows.
+     * \details
+     * Call \ref any_connection::read_some_rows or its async counterpart to move forward.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool should_read_rows() const noexcept { return impl_.is_reading_rows(); }
+
+    /**
+     * \brief Returns whether all the messages generated by this operation have been read.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool complete() const noexcept { return impl_.is_complete(); }
+
+    /**
+     * \brief Returns the number of resultsets that have been read so far.
+     * \details
+     * For objects populated by \ref any_connection::execute, this is the number of
+     * resultsets generated by the operation.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t size() const noexcept { return impl_.num_resultsets(); }
+
+    /**
+     * \brief Returns metadata about the columns in a resultset.
+     *
+     * \par Preconditions
+     * `resultset_index < this->size()`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * The returned view points into memory owned by `*this`, and will be valid as long
+     * as `*this` or an object move-constructed from `*this` are alive.
+     */
+    metadata_collection_view meta(std::size_t resultset_index = 0) const noexcept
+    {
+        return impl_.get_meta(resultset_index);
+    }
+
+    /**
+     * \brief Returns the number of rows that have been read for a resultset.
+     *
+     * \par Preconditions
+     * `resultset_index < this->size()`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t num_rows(std::size_t resultset_index = 0) const noexcept
+    {
+        return impl_.get_num_rows(resultset_index);
+    }
+
+    /**
+     * \brief Returns the values of a column in a resultset.
+     * \details
+     * The returned view contains `this->num_rows(resultset_index)` values.
+     *
+     * \par Preconditions
+     * `resultset_index < this->size() && column_index < this->meta(resultset_index).size()`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * The returned view points into memory owned by `*this`, and will be valid as long
+     * as `*this` or an object move-constructed from `*this` are alive, and no more rows are
+     * read into `*this`.
+     */
+    column_view column(std::size_t column_index, std::size_t resultset_index = 0) const noexcept
+    {
+        return detail::access::construct<column_view>(impl_.get_column(resultset_index, column_index));
+    }
+
+    /**
+     * \brief Returns the number of rows affected by the SQL statement associated to a resultset.
+     *
+     * \par Preconditions
+     * `resultset_index < this->size()` and the resultset has been fully read.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::uint64_t affected_rows(std::size_t resultset_index = 0) const noexcept
+    {
+        return impl_.get_affected_rows(resultset_index);
+    }
+
+    /**
+     * \brief Returns the last insert ID produced by the SQL statement associated to a resultset.
+     *
+     * \par Preconditions
+     * `resultset_index < this->size()` and the resultset has been fully read.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::uint64_t last_insert_id(std::size_t resultset_index = 0) const noexcept
+    {
+        return impl_.get_last_insert_id(resultset_index);
+    }
+
+    /**
+     * \brief Returns the number of warnings produced by the SQL statement associated to a resultset.
+     *
+     * \par Preconditions
+     * `resultset_index < this->size()` and the resultset has been fully read.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    unsigned warning_count(std::size_t resultset_index = 0) const noexcept
+    {
+        return impl_.get_warning_count(resultset_index);
+    }
+
+    /**
+     * \brief Returns additional text information about a resultset.
+     * \details
+     * The returned string always uses ASCII encoding, regardless of the connection's character set.
+     *
+     * \par Preconditions
+     * `resultset_index < this->size()` and the resultset has been fully read.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * The returned view points into memory owned by `*this`, and will be valid as long
+     * as `*this` or an object move-constructed from `*this` are alive.
+     */
+    string_view info(std::size_t resultset_index = 0) const noexcept
+    {
+        return impl_.get_info(resultset_index);
+    }
+
+    /**
+     * \brief Returns whether a resultset represents a procedure OUT params.
+     *
+     * \par Preconditions
+     * `resultset_index < this->size()` and the resultset has been fully read.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool is_out_params(std::size_t resultset_index = 0) const noexcept
+    {
+        return impl_.get_is_out_params(resultset_index);
+    }
+
+private:
+    detail::columnar_results_impl impl_;
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
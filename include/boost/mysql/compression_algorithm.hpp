@@ -0,0 +1,40 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_COMPRESSION_ALGORITHM_HPP
+#define BOOST_MYSQL_COMPRESSION_ALGORITHM_HPP
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief Compression algorithms for the MySQL compressed protocol.
+ * \details
+ * Compression is negotiated during connection establishment. If the server doesn't
+ * support the requested algorithm, or the library was built without support for it,
+ * the connection falls back to the uncompressed protocol.
+ * \n
+ * Support for `zlib` is enabled by defining `BOOST_MYSQL_HAS_ZLIB` and linking to zlib.
+ * Support for `zstd` is enabled by defining `BOOST_MYSQL_HAS_ZSTD` and linking to libzstd.
+ * The CMake build does this automatically if these libraries are found.
+ */
+enum class compression_algorithm
+{
+    /// Don't use compression (the default).
+    none,
+
+    /// Use zlib compression. Supported by both MySQL and MariaDB.
+    zlib,
+
+    /// Use zstd compression. Supported by MySQL 8.0.18 and later.
+    zstd,
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
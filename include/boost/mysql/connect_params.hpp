@@ -9,9 +9,12 @@
 #define BOOST_MYSQL_CONNECT_PARAMS_HPP
 
 #include <boost/mysql/any_address.hpp>
+#include <boost/mysql/compression_algorithm.hpp>
+#include <boost/mysql/defaults.hpp>
 #include <boost/mysql/ssl_mode.hpp>
 #include <boost/mysql/string_view.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -70,6 +73,22 @@ struct connect_params
      * \details Disabled by default.
      */
     bool multi_queries{false};
+
+    /**
+     * \brief The compression algorithm to use for the MySQL compressed protocol.
+     * \details
+     * Compression trades CPU for network bandwidth, and may be beneficial when
+     * transferring big resultsets over slow networks. If the server or the library
+     * don't support the requested algorithm, the connection falls back to
+     * the uncompressed protocol. Defaults to \ref compression_algorithm::none.
+     */
+    compression_algorithm compression{compression_algorithm::none};
+
+    /**
+     * \brief When using compression, packets smaller than this number of bytes are sent uncompressed.
+     * \details Defaults to \ref default_compression_threshold.
+     */
+    std::size_t compression_threshold{default_compression_threshold};
 };
 
 }  // namespace mysql
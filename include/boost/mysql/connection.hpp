@@ -104,6 +104,9 @@ public:
         : impl_(
               buff_params.initial_read_size(),
               static_cast<std::size_t>(-1),
+              static_cast<std::size_t>(-1),
+              nullptr,
+              64u,
               detail::make_engine<Stream>(std::forward<Args>(args)...)
           )
     {
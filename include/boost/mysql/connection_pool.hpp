@@ -12,6 +12,8 @@
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/pool_params.hpp>
+#include <boost/mysql/pool_stats.hpp>
+#include <boost/mysql/statement.hpp>
 #include <boost/mysql/with_diagnostics.hpp>
 
 #include <boost/mysql/detail/access.hpp>
@@ -24,6 +26,7 @@
 #include <boost/asio/async_result.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <utility>
 
@@ -174,6 +177,32 @@ public:
     /// \copydoc get
     const any_connection* operator->() const noexcept { return &get(); }
 
+    /**
+     * \brief Retrieves a statement prepared by the pool for this connection.
+     * \details
+     * Returns the statement resulting from preparing `pool_params::prepared_statements[index]`
+     * in the owned connection. The pool prepares these statements every time the connection
+     * is established or reset, so they're ready to be executed without any extra round-trip.
+     * \n
+     * The returned statement must not be closed by the user.
+     * Resetting the owned connection manually deallocates it. In both cases, the statement
+     * remains invalid until the connection is returned to the pool, which then prepares it again
+     * before handing out the connection (even if \ref pool_params::lazy_reset is enabled).
+     *
+     * \par Preconditions
+     * `this->valid() == true` \n
+     * `index < params.prepared_statements.size()`, where `params` is the \ref pool_params
+     * object used to construct the pool.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    statement prepared_statement(std::size_t index) const noexcept
+    {
+        BOOST_ASSERT(valid());
+        return detail::get_prepared_statement(*impl_, index);
+    }
+
     /**
      * \brief Returns the owned connection to the pool and marks it as not requiring reset.
      * \details
@@ -714,6 +743,58 @@ public:
         return async_get_connection_impl(timeout, &diag, std::forward<CompletionToken>(token));
     }
 
+    /**
+     * \brief Retrieves an idle connection from the pool without waiting, if one is available.
+     * \details
+     * If the pool is running and has an idle connection, marks it as in use and returns it.
+     * Otherwise, returns an invalid \ref pooled_connection (`valid() == false`).
+     * This function never waits and never creates new connections.
+     * \n
+     * Unlike \ref async_get_connection, this function doesn't post to the pool's executor,
+     * so it avoids a scheduling round-trip. Use it as a fast path when running within the
+     * pool's executor, falling back to `async_get_connection` if it returns an invalid connection.
+     *
+     * \par Preconditions
+     * `this->valid() == true` \n
+     * This function must be called from within the pool's executor (as given by `this->get_executor()`).
+     * For thread-safe pools, this means running within the pool's strand
+     * (e.g. in a handler bound to `this->get_executor()`). This is checked by an assertion
+     * for pools created with \ref pool_executor_params::thread_safe.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Thead-safety
+     * Only safe to be called concurrently with other functions
+     * if the precondition about running within the pool's executor is met.
+     */
+    BOOST_MYSQL_DECL
+    pooled_connection try_get_connection();
+
+    /**
+     * \brief Returns a snapshot of the pool's state and accumulated counters.
+     * \details
+     * The returned object contains the number of connections in each state
+     * and counters for checkouts, checkout timeouts, connection establishments and
+     * session resets. Comparing the time spent waiting for connections with the
+     * number of waiting requests and idle connections helps telling pool starvation
+     * apart from server-side latency. For latency distributions, use \ref pool_params::latency_observer.
+     * \n
+     * Values are read individually using atomic operations, without locking.
+     * They may be slightly inconsistent with each other while the pool is being used.
+     *
+     * \par Preconditions
+     * `this->valid() == true`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Thead-safety
+     * Safe to be called concurrently with any other function.
+     */
+    BOOST_MYSQL_DECL
+    pool_stats stats() const noexcept;
+
     /**
      * \brief Stops any current outstanding operation and marks the pool as cancelled.
      * \details
@@ -24,6 +24,9 @@ BOOST_INLINE_CONSTEXPR const char* default_port_string = "3306";
 /// The default initial size of the connection's internal buffer, in bytes.
 BOOST_INLINE_CONSTEXPR std::size_t default_initial_read_buffer_size = 1024;
 
+/// The default compression threshold, in bytes. This is the value used by the official clients.
+BOOST_INLINE_CONSTEXPR std::size_t default_compression_threshold = 50;
+
 }  // namespace mysql
 }  // namespace boost
 
@@ -102,6 +102,16 @@ struct close_statement_algo_params
     using result_type = void;
 };
 
+struct send_long_data_algo_params
+{
+    std::uint32_t stmt_id;
+    std::uint16_t num_params;
+    std::uint16_t param_index;
+    span<const std::uint8_t> data;
+
+    using result_type = void;
+};
+
 struct ping_algo_params
 {
     using result_type = void;
@@ -134,6 +144,7 @@ struct run_pipeline_algo_params
     span<const std::uint8_t> request_buffer;
     span<const pipeline_request_stage> request_stages;
     std::vector<stage_response>* response;
+    bool execution_summaries;  // If true, execution stages store summaries rather than results
 
     using result_type = void;
 };
@@ -31,7 +31,9 @@ struct any_execution_request
     {
         query,
         query_with_params,
-        stmt
+        stmt,
+        cached_stmt,
+        stmt_batch
     };
 
     union data_t
@@ -47,11 +49,25 @@ struct any_execution_request
             std::uint32_t stmt_id;
             std::uint16_t num_params;
             span<const field_view> params;
+            std::uint32_t fetch_size;  // if not zero, rows are read using a cursor, fetch_size rows at a time
         } stmt;
+        struct cached_stmt_t
+        {
+            string_view sql;  // prepared if not in the connection's statement cache
+            span<const field_view> params;
+        } cached_stmt;
+        struct stmt_batch_t
+        {
+            std::uint32_t stmt_id;
+            std::uint16_t num_params;
+            span<const field_view> params;  // row-major, one row per execution
+        } stmt_batch;
 
         data_t(string_view q) noexcept : query(q) {}
         data_t(query_with_params_t v) noexcept : query_with_params(v) {}
         data_t(stmt_t v) noexcept : stmt(v) {}
+        data_t(cached_stmt_t v) noexcept : cached_stmt(v) {}
+        data_t(stmt_batch_t v) noexcept : stmt_batch(v) {}
     };
 
     type_t type;
@@ -62,6 +78,8 @@ struct any_execution_request
     {
     }
     any_execution_request(data_t::stmt_t v) noexcept : type(type_t::stmt), data(v) {}
+    any_execution_request(data_t::cached_stmt_t v) noexcept : type(type_t::cached_stmt), data(v) {}
+    any_execution_request(data_t::stmt_batch_t v) noexcept : type(type_t::stmt_batch), data(v) {}
 };
 
 struct no_execution_request_traits
@@ -24,7 +24,7 @@ inline ssl_mode adjust_ssl_mode(ssl_mode input, address_type addr_type)
 
 inline handshake_params make_hparams(const connect_params& input)
 {
-    return handshake_params(
+    handshake_params res(
         input.username,
         input.password,
         input.database,
@@ -32,6 +32,9 @@ inline handshake_params make_hparams(const connect_params& input)
         adjust_ssl_mode(input.ssl, input.server_address.type()),
         input.multi_queries
     );
+    res.set_compression(input.compression);
+    res.set_compression_threshold(input.compression_threshold);
+    return res;
 }
 
 }  // namespace detail
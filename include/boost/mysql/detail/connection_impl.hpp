@@ -15,6 +15,7 @@
 #include <boost/mysql/execution_state.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/handshake_params.hpp>
+#include <boost/mysql/local_infile.hpp>
 #include <boost/mysql/metadata_mode.hpp>
 #include <boost/mysql/rows_view.hpp>
 #include <boost/mysql/statement.hpp>
@@ -30,9 +31,12 @@
 #include <boost/mysql/detail/intermediate_handler.hpp>
 
 #include <boost/asio/any_io_executor.hpp>
+#include <boost/container/container_fwd.hpp>
+#include <boost/core/span.hpp>
 #include <boost/system/result.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <type_traits>
@@ -326,16 +330,24 @@ public:
     BOOST_MYSQL_DECL connection_impl(
         std::size_t read_buff_size,
         std::size_t max_buffer_size,
+        std::size_t buffer_shrink_threshold,
+        container::pmr::memory_resource* buffer_resource,
+        std::size_t statement_cache_size,
         std::unique_ptr<engine> eng
     );
 
     BOOST_MYSQL_DECL metadata_mode meta_mode() const;
     BOOST_MYSQL_DECL void set_meta_mode(metadata_mode m);
+    BOOST_MYSQL_DECL void set_local_infile_handler(local_infile_handler h);
     BOOST_MYSQL_DECL bool ssl_active() const;
     BOOST_MYSQL_DECL bool backslash_escapes() const;
     BOOST_MYSQL_DECL system::result<character_set> current_character_set() const;
     BOOST_MYSQL_DECL diagnostics& shared_diag();
 
+    // Session state tracking, used by connection pools to skip unnecessary resets
+    BOOST_MYSQL_DECL bool session_reset_required() const;
+    BOOST_MYSQL_DECL void mark_session_clean();
+
     engine& get_engine()
     {
         BOOST_ASSERT(engine_);
@@ -558,6 +570,21 @@ public:
         };
     }
 
+    // Read some rows (columnar). Rows are appended to the columns, so there is no limit on the batch size
+    template <class ColumnarResults>
+    read_some_rows_algo_params make_params_read_some_rows_columnar(ColumnarResults& st) const
+    {
+        return {&access::get_impl(st).get_interface(), output_ref()};
+    }
+
+    // Read some rows (Arrow). Limited by the space left in the current batch
+    template <class ArrowExecutionState>
+    read_some_rows_algo_params make_params_read_some_rows_arrow(ArrowExecutionState& st) const
+    {
+        auto& impl = access::get_impl(st);
+        return {&impl.get_interface(), impl.make_output_ref()};
+    }
+
     // Read resultset head
     template <class ExecutionStateType>
     read_resultset_head_algo_params make_params_read_resultset_head(ExecutionStateType& st) const
@@ -568,6 +595,16 @@ public:
     // Close statement
     close_statement_algo_params make_params_close_statement(statement stmt) const { return {stmt.id()}; }
 
+    // Send long data
+    send_long_data_algo_params make_params_send_long_data(
+        statement stmt,
+        std::uint16_t param_index,
+        span<const std::uint8_t> data
+    ) const
+    {
+        return {stmt.id(), static_cast<std::uint16_t>(stmt.num_params()), param_index, data};
+    }
+
     // Run pipeline. Separately compiled to avoid including the pipeline header here
     BOOST_MYSQL_DECL
     static run_pipeline_algo_params make_params_pipeline(
@@ -626,12 +663,21 @@ using async_read_resultset_head_t = async_run_t<read_resultset_head_algo_params,
 template <class CompletionToken>
 using async_read_some_rows_dynamic_t = async_run_t<read_some_rows_dynamic_algo_params, CompletionToken>;
 
+template <class CompletionToken>
+using async_read_some_rows_columnar_t = async_run_t<read_some_rows_algo_params, CompletionToken>;
+
+template <class CompletionToken>
+using async_read_some_rows_arrow_t = async_run_t<read_some_rows_algo_params, CompletionToken>;
+
 template <class CompletionToken>
 using async_prepare_statement_t = async_run_t<prepare_statement_algo_params, CompletionToken>;
 
 template <class CompletionToken>
 using async_close_statement_t = async_run_t<close_statement_algo_params, CompletionToken>;
 
+template <class CompletionToken>
+using async_send_long_data_t = async_run_t<send_long_data_algo_params, CompletionToken>;
+
 template <class CompletionToken>
 using async_set_character_set_t = async_run_t<set_character_set_algo_params, CompletionToken>;
 
@@ -10,6 +10,7 @@
 
 #include <boost/mysql/detail/config.hpp>
 
+#include <cstddef>
 #include <memory>
 
 namespace boost {
@@ -17,6 +18,7 @@ namespace mysql {
 
 class pooled_connection;
 class any_connection;
+class statement;
 
 namespace detail {
 
@@ -28,8 +30,12 @@ class basic_connection_node;
 template <class IoTraits, class ConnectionWrapper>
 class basic_pool_impl;
 
+template <class IoTraits, class ConnectionWrapper>
+class basic_sharded_pool_impl;
+
 using connection_node = basic_connection_node<io_traits>;
 using pool_impl = basic_pool_impl<io_traits, pooled_connection>;
+using sharded_pool_impl = basic_sharded_pool_impl<io_traits, pooled_connection>;
 
 BOOST_MYSQL_DECL void return_connection(
     std::shared_ptr<pool_impl> pool,
@@ -37,6 +43,7 @@ BOOST_MYSQL_DECL void return_connection(
     bool should_reset
 ) noexcept;
 BOOST_MYSQL_DECL any_connection& get_connection(connection_node& node) noexcept;
+BOOST_MYSQL_DECL statement get_prepared_statement(const connection_node& node, std::size_t index) noexcept;
 
 }  // namespace detail
 }  // namespace mysql
@@ -29,6 +29,8 @@ class static_results;
 
 class execution_state;
 class results;
+class columnar_results;
+class arrow_execution_state;
 
 namespace detail {
 
@@ -44,7 +46,8 @@ struct is_static_execution_state<static_execution_state<T...>> : std::true_type
 };
 
 template <class T>
-concept execution_state_type = std::is_same_v<T, execution_state> || is_static_execution_state<T>::value;
+concept execution_state_type = std::is_same_v<T, execution_state> || std::is_same_v<T, columnar_results> ||
+                               std::is_same_v<T, arrow_execution_state> || is_static_execution_state<T>::value;
 
 // Results
 template <class T>
@@ -58,7 +61,8 @@ struct is_static_results<static_results<T...>> : std::true_type
 };
 
 template <class T>
-concept results_type = std::is_same_v<T, results> || is_static_results<T>::value;
+concept results_type = std::is_same_v<T, results> || std::is_same_v<T, columnar_results> ||
+                       is_static_results<T>::value;
 
 // Execution request
 template <class T>
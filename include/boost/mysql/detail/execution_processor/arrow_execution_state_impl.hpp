@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_EXECUTION_PROCESSOR_ARROW_EXECUTION_STATE_IMPL_HPP
+#define BOOST_MYSQL_DETAIL_EXECUTION_PROCESSOR_ARROW_EXECUTION_STATE_IMPL_HPP
+
+#include <boost/mysql/arrow_c_data_interface.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/metadata.hpp>
+#include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/execution_processor/columnar_results_impl.hpp>
+#include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Arrow format string for a column, as per the C data interface
+BOOST_MYSQL_DECL
+const char* get_arrow_format(field_kind column_kind) noexcept;
+
+class arrow_execution_state_impl final : public execution_processor
+{
+    struct ok_data
+    {
+        bool has_value{false};           // The OK packet information is default constructed, or actual data?
+        std::uint64_t affected_rows{};   // OK packet data
+        std::uint64_t last_insert_id{};  // OK packet data
+        std::uint16_t warnings{};        // OK packet data
+        bool is_out_params{false};       // Does this resultset contain OUT param information?
+    };
+
+    std::size_t batch_size_;
+    std::vector<metadata> meta_;
+    std::vector<column_data> columns_;  // rows in the current batch, one per column
+    std::size_t num_rows_{};            // number of rows in the current batch
+    ok_data eof_data_;
+    std::vector<char> info_;
+
+    BOOST_MYSQL_DECL
+    void on_new_resultset() noexcept;
+
+    BOOST_MYSQL_DECL
+    void on_ok_packet_impl(const ok_view& pack);
+
+    BOOST_MYSQL_DECL
+    void reset_impl() noexcept override final;
+
+    BOOST_MYSQL_DECL
+    error_code on_head_ok_packet_impl(const ok_view& pack, diagnostics&) override final;
+
+    BOOST_MYSQL_DECL
+    void on_num_meta_impl(std::size_t num_columns) override final;
+
+    BOOST_MYSQL_DECL
+    error_code on_meta_impl(const coldef_view&, bool, diagnostics&) override final;
+
+    BOOST_MYSQL_DECL
+    error_code on_row_impl(span<const std::uint8_t> msg, const output_ref&, std::vector<field_view>&)
+        override final;
+
+    BOOST_MYSQL_DECL
+    error_code on_row_ok_packet_impl(const ok_view& pack) override final;
+
+    void on_row_batch_start_impl() noexcept override final {}
+
+    void on_row_batch_finish_impl() noexcept override final {}
+
+public:
+    explicit arrow_execution_state_impl(std::size_t batch_size) noexcept : batch_size_(batch_size)
+    {
+        BOOST_ASSERT(batch_size > 0u);
+    }
+
+    std::size_t batch_size() const noexcept { return batch_size_; }
+    std::size_t num_buffered_rows() const noexcept { return num_rows_; }
+
+    // Limits the number of rows that a read_some_rows operation may read
+    // so we never exceed the batch size
+    output_ref make_output_ref() const noexcept
+    {
+        return output_ref(num_rows_ >= batch_size_ ? 0u : batch_size_ - num_rows_);
+    }
+
+    metadata_collection_view meta() const noexcept { return meta_; }
+
+    std::uint64_t get_affected_rows() const noexcept
+    {
+        BOOST_ASSERT(eof_data_.has_value);
+        return eof_data_.affected_rows;
+    }
+
+    std::uint64_t get_last_insert_id() const noexcept
+    {
+        BOOST_ASSERT(eof_data_.has_value);
+        return eof_data_.last_insert_id;
+    }
+
+    unsigned get_warning_count() const noexcept
+    {
+        BOOST_ASSERT(eof_data_.has_value);
+        return eof_data_.warnings;
+    }
+
+    string_view get_info() const noexcept
+    {
+        BOOST_ASSERT(eof_data_.has_value);
+        return string_view(info_.data(), info_.size());
+    }
+
+    bool get_is_out_params() const noexcept
+    {
+        BOOST_ASSERT(eof_data_.has_value);
+        return eof_data_.is_out_params;
+    }
+
+    // Exports the current resultset's schema, as a struct with a child per column
+    BOOST_MYSQL_DECL
+    void export_schema(ArrowSchema& out) const;
+
+    // Moves the rows in the current batch into out, as a struct array
+    // with a child per column. Returns the number of exported rows
+    BOOST_MYSQL_DECL
+    std::size_t export_batch(ArrowArray& out);
+
+    arrow_execution_state_impl& get_interface() noexcept { return *this; }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/arrow_execution_state_impl.ipp>
+#endif
+
+#endif
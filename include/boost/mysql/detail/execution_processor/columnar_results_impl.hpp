@@ -0,0 +1,193 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_EXECUTION_PROCESSOR_COLUMNAR_RESULTS_IMPL_HPP
+#define BOOST_MYSQL_DETAIL_EXECUTION_PROCESSOR_COLUMNAR_RESULTS_IMPL_HPP
+
+#include <boost/mysql/date.hpp>
+#include <boost/mysql/datetime.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_kind.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata.hpp>
+#include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/string_view.hpp>
+#include <boost/mysql/time.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Storage for a single column, in struct-of-arrays form. Values are stored
+// in the vector matching kind, only. Strings and blobs are stored contiguously in bytes,
+// with value i spanning [offsets[i], offsets[i+1]). NULL values hold a default value
+// (or an empty range) and have their bit cleared in the validity bitmap (LSB first).
+// This layout is compatible with Apache Arrow's.
+struct column_data
+{
+    field_kind kind{field_kind::null};
+    std::size_t size{};
+    std::size_t null_count{};
+    std::vector<std::uint8_t> validity;
+    std::vector<std::int64_t> int64_values;
+    std::vector<std::uint64_t> uint64_values;
+    std::vector<float> float_values;
+    std::vector<double> double_values;
+    std::vector<date> date_values;
+    std::vector<datetime> datetime_values;
+    std::vector<time> time_values;
+    std::vector<std::size_t> offsets;
+    std::vector<unsigned char> bytes;
+
+    column_data() = default;
+    explicit column_data(field_kind kind) : kind(kind)
+    {
+        if (kind == field_kind::string || kind == field_kind::blob)
+            offsets.push_back(0u);
+    }
+
+    bool is_null(std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(i < size);
+        return !(validity[i / 8u] & (1u << (i % 8u)));
+    }
+
+    BOOST_MYSQL_DECL
+    void append(field_view value);
+
+    BOOST_MYSQL_DECL
+    void truncate(std::size_t new_size) noexcept;
+};
+
+// The field_kind used to store non-NULL values for a column
+BOOST_MYSQL_DECL
+field_kind get_column_kind(const metadata& meta) noexcept;
+
+struct columnar_resultset_data
+{
+    std::size_t meta_offset{};       // Offset into the vectors of metadata and columns
+    std::size_t num_columns{};       // Number of columns this resultset has
+    std::size_t num_rows{};          // Number of rows this resultset has
+    std::uint64_t affected_rows{};   // OK packet data
+    std::uint64_t last_insert_id{};  // OK packet data
+    std::uint16_t warnings{};        // OK packet data
+    std::size_t info_offset{};       // Offset into the vector of info characters
+    std::size_t info_size{};         // Number of characters that this resultset's info string has
+    bool has_ok_packet_data{false};  // The OK packet information is default constructed, or actual data?
+    bool is_out_params{false};       // Does this resultset contain OUT param information?
+};
+
+class columnar_results_impl final : public execution_processor
+{
+public:
+    columnar_results_impl() = default;
+
+    columnar_results_impl& get_interface() noexcept { return *this; }
+
+    std::size_t num_resultsets() const noexcept { return per_result_.size(); }
+
+    metadata_collection_view get_meta(std::size_t index) const noexcept
+    {
+        const auto& resultset_data = get_resultset(index);
+        return metadata_collection_view(
+            meta_.data() + resultset_data.meta_offset,
+            resultset_data.num_columns
+        );
+    }
+
+    std::size_t get_num_rows(std::size_t index) const noexcept { return get_resultset(index).num_rows; }
+
+    const column_data& get_column(std::size_t index, std::size_t column) const noexcept
+    {
+        const auto& resultset_data = get_resultset(index);
+        BOOST_ASSERT(column < resultset_data.num_columns);
+        return columns_[resultset_data.meta_offset + column];
+    }
+
+    std::uint64_t get_affected_rows(std::size_t index) const noexcept
+    {
+        return get_resultset(index).affected_rows;
+    }
+
+    std::uint64_t get_last_insert_id(std::size_t index) const noexcept
+    {
+        return get_resultset(index).last_insert_id;
+    }
+
+    unsigned get_warning_count(std::size_t index) const noexcept { return get_resultset(index).warnings; }
+
+    string_view get_info(std::size_t index) const noexcept
+    {
+        const auto& resultset_data = get_resultset(index);
+        return string_view(info_.data() + resultset_data.info_offset, resultset_data.info_size);
+    }
+
+    bool get_is_out_params(std::size_t index) const noexcept { return get_resultset(index).is_out_params; }
+
+private:
+    // Virtual implementations
+    BOOST_MYSQL_DECL
+    void reset_impl() noexcept override final;
+
+    BOOST_MYSQL_DECL
+    error_code on_head_ok_packet_impl(const ok_view& pack, diagnostics& diag) override final;
+
+    BOOST_MYSQL_DECL
+    void on_num_meta_impl(std::size_t num_columns) override final;
+
+    BOOST_MYSQL_DECL
+    error_code on_meta_impl(const coldef_view&, bool is_last, diagnostics&) override final;
+
+    BOOST_MYSQL_DECL
+    error_code on_row_impl(span<const std::uint8_t> msg, const output_ref&, std::vector<field_view>&)
+        override final;
+
+    BOOST_MYSQL_DECL
+    error_code on_row_ok_packet_impl(const ok_view& pack) override final;
+
+    void on_row_batch_start_impl() noexcept override final {}
+    void on_row_batch_finish_impl() noexcept override final {}
+
+    // Data
+    std::vector<metadata> meta_;
+    std::vector<column_data> columns_;
+    std::vector<columnar_resultset_data> per_result_;
+    std::vector<char> info_;
+
+    // Helpers
+    const columnar_resultset_data& get_resultset(std::size_t index) const noexcept
+    {
+        BOOST_ASSERT(index < per_result_.size());
+        return per_result_[index];
+    }
+
+    BOOST_MYSQL_DECL
+    columnar_resultset_data& add_resultset();
+
+    BOOST_MYSQL_DECL
+    void on_ok_packet_impl(const ok_view& pack);
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/columnar_results_impl.ipp>
+#endif
+
+#endif
@@ -50,6 +50,9 @@ class output_ref
 public:
     constexpr output_ref() noexcept = default;
 
+    // Limits the number of rows to read, without providing any storage (e.g. for processors that own it)
+    constexpr explicit output_ref(std::size_t max_size) noexcept : max_size_(max_size) {}
+
     template <class T>
     constexpr output_ref(boost::span<T> span, std::size_t type_index, std::size_t offset = 0) noexcept
         : data_(span.data()), max_size_(span.size()), type_index_(type_index), offset_(offset)
@@ -13,8 +13,10 @@
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/metadata.hpp>
 #include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/session_track_view.hpp>
 #include <boost/mysql/string_view.hpp>
 
+#include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/config.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
 
@@ -40,12 +42,14 @@ class execution_state_impl final : public execution_processor
     std::vector<metadata> meta_;
     ok_data eof_data_;
     std::vector<char> info_;
+    std::vector<std::uint8_t> session_track_;
 
     void on_new_resultset() noexcept
     {
         meta_.clear();
         eof_data_ = ok_data{};
         info_.clear();
+        session_track_.clear();
     }
 
     BOOST_MYSQL_DECL
@@ -103,6 +107,12 @@ public:
         return string_view(info_.data(), info_.size());
     }
 
+    session_track_view get_session_track() const noexcept
+    {
+        BOOST_ASSERT(eof_data_.has_value);
+        return access::construct<session_track_view>(session_track_.data(), session_track_.size());
+    }
+
     bool get_is_out_params() const noexcept
     {
         BOOST_ASSERT(eof_data_.has_value);
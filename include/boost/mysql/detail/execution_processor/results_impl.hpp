@@ -14,6 +14,7 @@
 #include <boost/mysql/metadata.hpp>
 #include <boost/mysql/metadata_collection_view.hpp>
 #include <boost/mysql/rows_view.hpp>
+#include <boost/mysql/session_track_view.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/config.hpp>
@@ -28,17 +29,19 @@ namespace detail {
 
 struct per_resultset_data
 {
-    std::size_t num_columns{};       // Number of columns this resultset has
-    std::size_t meta_offset{};       // Offset into the vector of metadata
-    std::size_t field_offset;        // Offset into the vector of fields (append mode only)
-    std::size_t num_rows{};          // Number of rows this resultset has (append mode only)
-    std::uint64_t affected_rows{};   // OK packet data
-    std::uint64_t last_insert_id{};  // OK packet data
-    std::uint16_t warnings{};        // OK packet data
-    std::size_t info_offset{};       // Offset into the vector of info characters
-    std::size_t info_size{};         // Number of characters that this resultset's info string has
-    bool has_ok_packet_data{false};  // The OK packet information is default constructed, or actual data?
-    bool is_out_params{false};       // Does this resultset contain OUT param information?
+    std::size_t num_columns{};           // Number of columns this resultset has
+    std::size_t meta_offset{};           // Offset into the vector of metadata
+    std::size_t field_offset;            // Offset into the vector of fields (append mode only)
+    std::size_t num_rows{};              // Number of rows this resultset has (append mode only)
+    std::uint64_t affected_rows{};       // OK packet data
+    std::uint64_t last_insert_id{};      // OK packet data
+    std::uint16_t warnings{};            // OK packet data
+    std::size_t info_offset{};           // Offset into the vector of info characters
+    std::size_t info_size{};             // Number of characters that this resultset's info string has
+    std::size_t session_track_offset{};  // Offset into the vector of session state bytes
+    std::size_t session_track_size{};    // Number of bytes of session state information
+    bool has_ok_packet_data{false};      // The OK packet information is default constructed, or actual data?
+    bool is_out_params{false};           // Does this resultset contain OUT param information?
 };
 
 // A container similar to a vector with SBO. To avoid depending on Boost.Container
@@ -132,6 +135,15 @@ public:
         return string_view(info_.data() + resultset_data.info_offset, resultset_data.info_size);
     }
 
+    session_track_view get_session_track(std::size_t index) const noexcept
+    {
+        const auto& resultset_data = get_resultset(index);
+        return access::construct<session_track_view>(
+            session_track_.data() + resultset_data.session_track_offset,
+            resultset_data.session_track_size
+        );
+    }
+
     bool get_is_out_params(std::size_t index) const noexcept { return get_resultset(index).is_out_params; }
 
     results_impl& get_interface() noexcept { return *this; }
@@ -167,6 +179,7 @@ private:
     std::vector<metadata> meta_;
     resultset_container per_result_;
     std::vector<char> info_;
+    std::vector<std::uint8_t> session_track_;
     row_impl rows_;
     std::size_t num_fields_at_batch_start_{no_batch};
 
@@ -32,15 +32,15 @@ namespace boost {
 namespace mysql {
 namespace detail {
 
-using execst_parse_fn_t =
-    error_code (*)(span<const std::size_t> pos_map, span<const field_view> from, const output_ref& ref);
+using execst_members_fn_t = void (*)(const output_ref& ref, span<void*> output);
 
 struct execst_resultset_descriptor
 {
     std::size_t num_columns;
     name_table_t name_table;
     meta_check_fn_t meta_check;
-    execst_parse_fn_t parse_fn;
+    span<const field_parse_fn_t> field_parse_fns;
+    execst_members_fn_t members_fn;
     std::size_t type_index;
 };
 
@@ -50,6 +50,7 @@ public:
     struct ptr_data
     {
         std::size_t* pos_map;
+        void** members;
     };
 
     execst_external_data(span<const execst_resultset_descriptor> desc, ptr_data ptr) noexcept
@@ -73,10 +74,15 @@ public:
         BOOST_ASSERT(idx < num_resultsets());
         return desc_[idx].meta_check;
     }
-    execst_parse_fn_t parse_fn(std::size_t idx) const noexcept
+    span<const field_parse_fn_t> field_parse_fns(std::size_t idx) const noexcept
     {
         BOOST_ASSERT(idx < num_resultsets());
-        return desc_[idx].parse_fn;
+        return desc_[idx].field_parse_fns;
+    }
+    execst_members_fn_t members_fn(std::size_t idx) const noexcept
+    {
+        BOOST_ASSERT(idx < num_resultsets());
+        return desc_[idx].members_fn;
     }
     std::size_t type_index(std::size_t idx) const noexcept
     {
@@ -87,6 +93,10 @@ public:
     {
         return span<std::size_t>(ptr_.pos_map, num_columns(idx));
     }
+    span<void*> members(std::size_t idx) const noexcept
+    {
+        return span<void*>(ptr_.members, num_columns(idx));
+    }
 
     void set_pointers(ptr_data ptr) noexcept { ptr_ = ptr; }
 
@@ -150,6 +160,7 @@ private:
     ok_packet_data ok_data_;
     std::vector<char> info_;
     std::vector<metadata> meta_;
+    std::vector<std::size_t> db_to_cpp_;  // inverse of pos_map, indexed by DB position
 
     // Virtual impls
     BOOST_MYSQL_DECL
@@ -188,6 +199,9 @@ private:
         return ext_.meta_check_fn(resultset_index_ - 1)(current_pos_map(), meta_, diag);
     }
 
+    BOOST_MYSQL_DECL
+    void compute_db_to_cpp();
+
     BOOST_MYSQL_DECL
     void on_new_resultset() noexcept;
 
@@ -196,13 +210,9 @@ private:
 };
 
 template <class StaticRow>
-static error_code execst_parse_fn(
-    span<const std::size_t> pos_map,
-    span<const field_view> from,
-    const output_ref& ref
-)
+static void execst_members_fn(const output_ref& ref, span<void*> output)
 {
-    return parse<StaticRow>(pos_map, from, ref.span_element<underlying_row_t<StaticRow>>());
+    get_member_addresses<StaticRow>(ref.span_element<underlying_row_t<StaticRow>>(), output);
 }
 
 template <class... StaticRow>
@@ -212,7 +222,8 @@ constexpr std::array<execst_resultset_descriptor, sizeof...(StaticRow)> create_e
         get_row_size<StaticRow>(),
         get_row_name_table<StaticRow>(),
         &meta_check<StaticRow>,
-        &execst_parse_fn<StaticRow>,
+        get_field_parse_fns<StaticRow>(),
+        &execst_members_fn<StaticRow>,
         get_type_index<underlying_row_t<StaticRow>, StaticRow...>(),
     }...}};
 }
@@ -228,6 +239,7 @@ class static_execution_state_impl
     struct
     {
         std::array<std::size_t, max_num_columns<StaticRow...>> pos_map{};
+        std::array<void*, max_num_columns<StaticRow...>> members{};
     } data_;
 
     // The type-erased impl, that will use pointers to the above storage
@@ -237,6 +249,7 @@ class static_execution_state_impl
     {
         return {
             data_.pos_map.data(),
+            data_.members.data(),
         };
     }
 
@@ -34,15 +34,15 @@ namespace mysql {
 namespace detail {
 
 using results_reset_fn_t = void (*)(void*);
-using results_parse_fn_t =
-    error_code (*)(span<const std::size_t> pos_map, span<const field_view> from, void* to);
+using results_add_row_fn_t = void (*)(void* rows, span<void*> members);
 
 struct results_resultset_descriptor
 {
     std::size_t num_columns;
     name_table_t name_table;
     meta_check_fn_t meta_check;
-    results_parse_fn_t parse_fn;
+    span<const field_parse_fn_t> field_parse_fns;
+    results_add_row_fn_t add_row_fn;
 };
 
 struct static_per_resultset_data
@@ -65,6 +65,7 @@ public:
     {
         void* rows;
         std::size_t* pos_map;
+        void** members;
         static_per_resultset_data* per_resultset;
     };
 
@@ -95,10 +96,15 @@ public:
         BOOST_ASSERT(idx < num_resultsets());
         return desc_[idx].meta_check;
     }
-    results_parse_fn_t parse_fn(std::size_t idx) const noexcept
+    span<const field_parse_fn_t> field_parse_fns(std::size_t idx) const noexcept
     {
         BOOST_ASSERT(idx < num_resultsets());
-        return desc_[idx].parse_fn;
+        return desc_[idx].field_parse_fns;
+    }
+    results_add_row_fn_t add_row_fn(std::size_t idx) const noexcept
+    {
+        BOOST_ASSERT(idx < num_resultsets());
+        return desc_[idx].add_row_fn;
     }
     results_reset_fn_t reset_fn() const noexcept { return reset_; }
     void* rows() const noexcept { return ptr_.rows; }
@@ -106,6 +112,10 @@ public:
     {
         return span<std::size_t>(ptr_.pos_map, num_columns(idx));
     }
+    span<void*> members(std::size_t idx) const noexcept
+    {
+        return span<void*>(ptr_.members, num_columns(idx));
+    }
     static_per_resultset_data& per_result(std::size_t idx) const noexcept
     {
         BOOST_ASSERT(idx < num_resultsets());
@@ -179,6 +189,7 @@ private:
     results_external_data ext_;
     std::vector<metadata> meta_;
     std::vector<char> info_;
+    std::vector<std::size_t> db_to_cpp_;  // inverse of the current pos_map, indexed by DB position
     std::size_t resultset_index_{0};
 
     // Helpers
@@ -194,6 +205,9 @@ private:
     BOOST_MYSQL_DECL
     static_per_resultset_data& add_resultset();
 
+    BOOST_MYSQL_DECL
+    void compute_db_to_cpp();
+
     BOOST_MYSQL_DECL
     error_code on_ok_packet_impl(const ok_view& pack);
 
@@ -228,13 +242,14 @@ struct results_fns
         boost::mp11::mp_for_each<boost::mp11::mp_iota_c<sizeof...(StaticRow)>>(reset_fn{rows});
     }
 
+    // Adds an empty row to the I-th vector and retrieves pointers to its members
     template <std::size_t I>
-    static error_code do_parse(span<const std::size_t> pos_map, span<const field_view> from, void* to)
+    static void do_add_row(void* rows, span<void*> members)
     {
         using StaticRowT = mp11::mp_at_c<mp11::mp_list<StaticRow...>, I>;
-        auto& v = std::get<I>(*static_cast<rows_t*>(to));
+        auto& v = std::get<I>(*static_cast<rows_t*>(rows));
         v.emplace_back();
-        return parse<StaticRowT>(pos_map, from, v.back());
+        get_member_addresses<StaticRowT>(v.back(), members);
     }
 
     template <std::size_t I>
@@ -245,7 +260,8 @@ struct results_fns
             get_row_size<StaticRowT>(),
             get_row_name_table<StaticRowT>(),
             &meta_check<StaticRowT>,
-            &do_parse<I>,
+            get_field_parse_fns<StaticRowT>(),
+            &do_add_row<I>,
         };
     }
 
@@ -275,6 +291,7 @@ class static_results_impl
     {
         results_rows_t<StaticRow...> rows;
         std::array<std::size_t, max_num_columns<StaticRow...>> pos_map{};
+        std::array<void*, max_num_columns<StaticRow...>> members{};
         std::array<static_per_resultset_data, sizeof...(StaticRow)> per_resultset{};
     } data_;
 
@@ -286,6 +303,7 @@ class static_results_impl
         return {
             &data_.rows,
             data_.pos_map.data(),
+            data_.members.data(),
             data_.per_resultset.data(),
         };
     }
@@ -39,9 +39,13 @@ BOOST_INLINE_CONSTEXPR std::uint16_t num = 32768;              // Field is num (
 
 namespace status_flags {
 
+BOOST_INLINE_CONSTEXPR std::uint32_t in_trans = 1;
 BOOST_INLINE_CONSTEXPR std::uint32_t more_results = 8;
+BOOST_INLINE_CONSTEXPR std::uint32_t cursor_exists = 64;
+BOOST_INLINE_CONSTEXPR std::uint32_t last_row_sent = 128;
 BOOST_INLINE_CONSTEXPR std::uint32_t no_backslash_escapes = 512;
 BOOST_INLINE_CONSTEXPR std::uint32_t out_params = 4096;
+BOOST_INLINE_CONSTEXPR std::uint32_t session_state_changed = 16384;
 
 }  // namespace status_flags
 
@@ -25,10 +25,18 @@ struct ok_view
     std::uint16_t status_flags;
     std::uint16_t warnings;
     string_view info;
+    string_view session_state_info;  // Raw session state changes. Empty unless session tracking is enabled
 
     bool more_results() const noexcept { return status_flags & status_flags::more_results; }
     bool backslash_escapes() const noexcept { return !(status_flags & status_flags::no_backslash_escapes); }
     bool is_out_params() const noexcept { return status_flags & status_flags::out_params; }
+    bool cursor_exists() const noexcept { return status_flags & status_flags::cursor_exists; }
+    bool last_row_sent() const noexcept { return status_flags & status_flags::last_row_sent; }
+    bool in_transaction() const noexcept { return status_flags & status_flags::in_trans; }
+    bool session_state_changed() const noexcept
+    {
+        return status_flags & status_flags::session_state_changed;
+    }
 };
 
 }  // namespace detail
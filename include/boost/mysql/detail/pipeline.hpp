@@ -29,6 +29,7 @@ enum class pipeline_stage_kind
     reset_connection,
     set_character_set,
     ping,
+    execute_batch,
 };
 
 struct pipeline_request_stage
@@ -40,10 +41,12 @@ struct pipeline_request_stage
         std::nullptr_t nothing;
         resultset_encoding enc;
         character_set charset;
+        std::size_t num_requests;
 
         stage_specific_t() noexcept : nothing() {}
         stage_specific_t(resultset_encoding v) noexcept : enc(v) {}
         stage_specific_t(character_set v) noexcept : charset(v) {}
+        stage_specific_t(std::size_t v) noexcept : num_requests(v) {}
     } stage_specific;
 };
 
@@ -0,0 +1,76 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_SESSION_TRACK_ITERATOR_HPP
+#define BOOST_MYSQL_DETAIL_SESSION_TRACK_ITERATOR_HPP
+
+#include <boost/mysql/session_track.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Iterates over the session state information contained in an OK packet.
+// Items are parsed lazily, as the iterator advances. If the data is malformed,
+// iteration stops at the first item that can't be parsed
+class session_track_iterator
+{
+    const std::uint8_t* first_{nullptr};  // Start of the current item
+    const std::uint8_t* last_{nullptr};   // End of the session state information
+    const std::uint8_t* next_{nullptr};   // Start of the next item
+    session_track_item current_{};
+
+    BOOST_MYSQL_DECL
+    void parse_current() noexcept;
+
+public:
+    using value_type = session_track_item;
+    using reference = const session_track_item&;
+    using pointer = const session_track_item*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    session_track_iterator() = default;
+    session_track_iterator(const std::uint8_t* first, const std::uint8_t* last) noexcept
+        : first_(first), last_(last)
+    {
+        parse_current();
+    }
+
+    session_track_iterator& operator++() noexcept
+    {
+        first_ = next_;
+        parse_current();
+        return *this;
+    }
+    session_track_iterator operator++(int) noexcept
+    {
+        auto res = *this;
+        ++(*this);
+        return res;
+    }
+    reference operator*() const noexcept { return current_; }
+    pointer operator->() const noexcept { return &current_; }
+    bool operator==(const session_track_iterator& rhs) const noexcept { return first_ == rhs.first_; }
+    bool operator!=(const session_track_iterator& rhs) const noexcept { return first_ != rhs.first_; }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/session_track_iterator.ipp>
+#endif
+
+#endif
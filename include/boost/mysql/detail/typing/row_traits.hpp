@@ -256,6 +256,40 @@ struct parse_functor
     }
 };
 
+// Field-by-field parsing. Allows parsing fields as they are deserialized,
+// without an intermediate array of field_views. Fields are identified by their C++ index.
+using field_parse_fn_t = error_code (*)(field_view input, void* output);
+
+template <class ReadableField>
+error_code parse_field_erased(field_view input, void* output)
+{
+    return readable_field_traits<ReadableField>::parse(input, *static_cast<ReadableField*>(output));
+}
+
+template <template <class...> class ListType, class... ReadableField>
+constexpr array_wrapper<field_parse_fn_t, sizeof...(ReadableField)> get_field_parse_fns(ListType<
+                                                                                       ReadableField...>*)
+{
+    return {{&parse_field_erased<ReadableField>...}};
+}
+
+template <class StaticRow>
+BOOST_INLINE_CONSTEXPR auto field_parse_fns_storage = get_field_parse_fns(
+    static_cast<typename row_traits_with_check<StaticRow>::field_types*>(nullptr)
+);
+
+struct member_address_functor
+{
+    void** output;
+    std::size_t& index;
+
+    template <class ReadableField>
+    void operator()(ReadableField& member) const
+    {
+        output[index++] = &member;
+    }
+};
+
 //
 // External interface. Other Boost.MySQL components should never use row_traits
 // directly, but the functions below, instead.
@@ -315,6 +349,21 @@ error_code parse(
     return ctx.error();
 }
 
+// The parse function for the field at position i, to be used with get_member_addresses()[i]
+template <BOOST_MYSQL_STATIC_ROW StaticRow>
+constexpr span<const field_parse_fn_t> get_field_parse_fns() noexcept
+{
+    return field_parse_fns_storage<StaticRow>.span();
+}
+
+template <BOOST_MYSQL_STATIC_ROW StaticRow>
+void get_member_addresses(underlying_row_t<StaticRow>& row, span<void*> output)
+{
+    BOOST_ASSERT(output.size() >= get_row_size<StaticRow>());
+    std::size_t index = 0;
+    row_traits_with_check<StaticRow>::for_each_member(row, member_address_functor{output.data(), index});
+}
+
 using meta_check_fn_t =
     error_code (*)(span<const std::size_t> field_map, metadata_collection_view meta, diagnostics& diag);
 
@@ -9,6 +9,7 @@
 #define BOOST_MYSQL_EXECUTION_STATE_HPP
 
 #include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/session_track_view.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/access.hpp>
@@ -197,6 +198,26 @@ public:
      */
     string_view info() const noexcept { return impl_.get_info(); }
 
+    /**
+     * \brief Returns the session state changes reported by the server for this resultset.
+     * \details
+     * Session state changes are only reported if the server supports session tracking
+     * and the relevant `session_track_xxx` system variables are enabled. Otherwise,
+     * the returned view is empty. See \ref session_track_view for more info.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Preconditions
+     * `this->complete() == true || this->should_read_head() == true`
+     *
+     * \par Object lifetimes
+     * This function returns a view object, with reference semantics. The returned view points into
+     * memory owned by `*this`, and will be valid as long as `*this` or an object move-constructed
+     * from `*this` are alive.
+     */
+    session_track_view session_track() const noexcept { return impl_.get_session_track(); }
+
     /**
      * \brief Returns whether the current resultset represents a procedure OUT params.
      * \par Preconditions
@@ -0,0 +1,43 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_EXECUTION_SUMMARY_HPP
+#define BOOST_MYSQL_EXECUTION_SUMMARY_HPP
+
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) The counters reported by the server after one or more executions.
+ * \details
+ * Contains the information in the OK packets sent by the server, aggregated
+ * over all the executions it describes. Rows and metadata are not included.
+ * Obtained from pipeline stages that don't allocate a \ref results object,
+ * like the ones created by \ref pipeline_request::add_execute_batch.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+struct execution_summary
+{
+    /// The sum of the number of rows affected by each execution.
+    std::uint64_t affected_rows{};
+
+    /// The first non-zero last insert ID reported by the executions, or zero if there is none.
+    std::uint64_t last_insert_id{};
+
+    /// The sum of the number of warnings generated by each execution.
+    unsigned warning_count{};
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
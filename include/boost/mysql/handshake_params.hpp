@@ -9,9 +9,12 @@
 #define BOOST_MYSQL_HANDSHAKE_PARAMS_HPP
 
 #include <boost/mysql/buffer_params.hpp>
+#include <boost/mysql/compression_algorithm.hpp>
+#include <boost/mysql/defaults.hpp>
 #include <boost/mysql/ssl_mode.hpp>
 #include <boost/mysql/string_view.hpp>
 
+#include <cstddef>
 #include <cstdint>
 
 namespace boost {
@@ -31,6 +34,8 @@ class handshake_params
     std::uint16_t connection_collation_;
     ssl_mode ssl_;
     bool multi_queries_;
+    compression_algorithm compression_{compression_algorithm::none};
+    std::size_t compression_threshold_{default_compression_threshold};
 
 public:
     /// The default collation to use with the connection (`utf8mb4_general_ci` on both MySQL and MariaDB).
@@ -152,6 +157,42 @@ public:
      * No-throw guarantee.
      */
     void set_multi_queries(bool v) noexcept { multi_queries_ = v; }
+
+    /**
+     * \brief Retrieves the compression algorithm to request to the server.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    compression_algorithm compression() const noexcept { return compression_; }
+
+    /**
+     * \brief Sets the compression algorithm to request to the server.
+     * \details
+     * Defaults to \ref compression_algorithm::none. If the server or the library
+     * don't support the requested algorithm, the connection is not compressed.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    void set_compression(compression_algorithm value) noexcept { compression_ = value; }
+
+    /**
+     * \brief Retrieves the compression threshold.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t compression_threshold() const noexcept { return compression_threshold_; }
+
+    /**
+     * \brief Sets the compression threshold.
+     * \details
+     * When compression is in use, packets smaller than this number of bytes are sent uncompressed.
+     * Defaults to \ref default_compression_threshold.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    void set_compression_threshold(std::size_t value) noexcept { compression_threshold_ = value; }
 };
 
 }  // namespace mysql
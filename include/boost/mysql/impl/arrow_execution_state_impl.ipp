@@ -0,0 +1,347 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_ARROW_EXECUTION_STATE_IMPL_IPP
+#define BOOST_MYSQL_IMPL_ARROW_EXECUTION_STATE_IMPL_IPP
+
+#pragma once
+
+#include <boost/mysql/detail/execution_processor/arrow_execution_state_impl.hpp>
+
+#include <boost/mysql/impl/internal/protocol/deserialization.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Owns the memory for a column exported as an ArrowArray.
+// Most column types are exported without copying. Types
+// without an equivalent Arrow representation are converted
+struct arrow_column_holder
+{
+    column_data data;
+    std::vector<std::int32_t> int32_values;  // dates, as days since the epoch
+    std::vector<std::int64_t> int64_values;  // datetimes and times, as microseconds
+    const void* buffers[3]{};
+
+    explicit arrow_column_holder(column_data&& d) noexcept : data(std::move(d)) {}
+};
+
+// Owns the children of an exported struct array. Children may be moved
+// out by the consumer (setting their release callback to NULL), so
+// children are released individually
+struct arrow_struct_holder
+{
+    std::vector<ArrowArray> children;
+    std::vector<ArrowArray*> children_ptrs;
+    const void* buffers[1]{};
+
+    ~arrow_struct_holder()
+    {
+        for (ArrowArray& child : children)
+        {
+            if (child.release)
+                child.release(&child);
+        }
+    }
+};
+
+// Owns the memory for an exported schema (either the top-level struct or a column)
+struct arrow_schema_holder
+{
+    std::string name;
+    std::vector<ArrowSchema> children;
+    std::vector<ArrowSchema*> children_ptrs;
+
+    ~arrow_schema_holder()
+    {
+        for (ArrowSchema& child : children)
+        {
+            if (child.release)
+                child.release(&child);
+        }
+    }
+};
+
+inline void release_arrow_column(ArrowArray* arr)
+{
+    delete static_cast<arrow_column_holder*>(arr->private_data);
+    arr->release = nullptr;
+}
+
+inline void release_arrow_struct(ArrowArray* arr)
+{
+    delete static_cast<arrow_struct_holder*>(arr->private_data);
+    arr->release = nullptr;
+}
+
+inline void release_arrow_schema(ArrowSchema* schema)
+{
+    delete static_cast<arrow_schema_holder*>(schema->private_data);
+    schema->release = nullptr;
+}
+
+// Marks a value that can't be represented in Arrow (e.g. a zero date) as NULL
+inline void arrow_set_null(column_data& data, std::size_t i)
+{
+    BOOST_ASSERT(!data.is_null(i));
+    data.validity[i / 8u] = static_cast<std::uint8_t>(data.validity[i / 8u] & ~(1u << (i % 8u)));
+    ++data.null_count;
+}
+
+inline const void* arrow_convert_values(arrow_column_holder& holder)
+{
+    auto& data = holder.data;
+    switch (data.kind)
+    {
+    case field_kind::int64: return data.int64_values.data();
+    case field_kind::uint64: return data.uint64_values.data();
+    case field_kind::float_: return data.float_values.data();
+    case field_kind::double_: return data.double_values.data();
+    case field_kind::string:
+    case field_kind::blob: return data.offsets.data();
+    case field_kind::date:
+        holder.int32_values.resize(data.size);
+        for (std::size_t i = 0; i < data.size; ++i)
+        {
+            if (data.is_null(i))
+                continue;
+            if (data.date_values[i].valid())
+                holder.int32_values[i] = data.date_values[i].get_time_point().time_since_epoch().count();
+            else
+                arrow_set_null(data, i);
+        }
+        return holder.int32_values.data();
+    case field_kind::datetime:
+        holder.int64_values.resize(data.size);
+        for (std::size_t i = 0; i < data.size; ++i)
+        {
+            if (data.is_null(i))
+                continue;
+            if (data.datetime_values[i].valid())
+                holder.int64_values[i] = data.datetime_values[i].get_time_point().time_since_epoch().count();
+            else
+                arrow_set_null(data, i);
+        }
+        return holder.int64_values.data();
+    case field_kind::time:
+        holder.int64_values.resize(data.size);
+        for (std::size_t i = 0; i < data.size; ++i)
+            holder.int64_values[i] = data.time_values[i].count();
+        return holder.int64_values.data();
+    default: BOOST_ASSERT(false); return nullptr;
+    }
+}
+
+inline void arrow_export_column(column_data&& col, ArrowArray& out)
+{
+    std::unique_ptr<arrow_column_holder> holder(new arrow_column_holder(std::move(col)));
+    const void* values = arrow_convert_values(*holder);
+    const auto& data = holder->data;
+    bool is_binary_like = data.kind == field_kind::string || data.kind == field_kind::blob;
+
+    // A NULL validity buffer means that there are no NULLs
+    holder->buffers[0] = data.null_count ? data.validity.data() : nullptr;
+    holder->buffers[1] = values;
+    holder->buffers[2] = is_binary_like ? data.bytes.data() : nullptr;
+
+    out.length = static_cast<int64_t>(data.size);
+    out.null_count = static_cast<int64_t>(data.null_count);
+    out.offset = 0;
+    out.n_buffers = is_binary_like ? 3 : 2;
+    out.n_children = 0;
+    out.buffers = holder->buffers;
+    out.children = nullptr;
+    out.dictionary = nullptr;
+    out.release = &release_arrow_column;
+    out.private_data = holder.release();
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+const char* boost::mysql::detail::get_arrow_format(field_kind column_kind) noexcept
+{
+    // Strings and blobs are exported with size_t offsets, which requires choosing
+    // between the regular and the large variants
+    constexpr bool large_offsets = sizeof(std::size_t) == 8u;
+    static_assert(large_offsets || sizeof(std::size_t) == 4u, "Unsupported size_t size");
+
+    switch (column_kind)
+    {
+    case field_kind::int64: return "l";
+    case field_kind::uint64: return "L";
+    case field_kind::float_: return "f";
+    case field_kind::double_: return "g";
+    case field_kind::date: return "tdD";         // date32 (days since the epoch)
+    case field_kind::datetime: return "tsu:";    // timestamp (microseconds), no timezone
+    case field_kind::time: return "tDu";         // duration (microseconds)
+    case field_kind::string: return large_offsets ? "U" : "u";
+    case field_kind::blob: return large_offsets ? "Z" : "z";
+    default: BOOST_ASSERT(false); return "n";
+    }
+}
+
+void boost::mysql::detail::arrow_execution_state_impl::on_new_resultset() noexcept
+{
+    meta_.clear();
+    columns_.clear();
+    num_rows_ = 0;
+    eof_data_ = ok_data{};
+    info_.clear();
+}
+
+void boost::mysql::detail::arrow_execution_state_impl::on_ok_packet_impl(const ok_view& pack)
+{
+    eof_data_.has_value = true;
+    eof_data_.affected_rows = pack.affected_rows;
+    eof_data_.last_insert_id = pack.last_insert_id;
+    eof_data_.warnings = pack.warnings;
+    eof_data_.is_out_params = pack.is_out_params();
+    info_.assign(pack.info.begin(), pack.info.end());
+}
+
+void boost::mysql::detail::arrow_execution_state_impl::reset_impl() noexcept { on_new_resultset(); }
+
+boost::mysql::error_code boost::mysql::detail::arrow_execution_state_impl::
+    on_head_ok_packet_impl(const ok_view& pack, diagnostics&)
+{
+    on_new_resultset();
+    on_ok_packet_impl(pack);
+    return error_code();
+}
+
+void boost::mysql::detail::arrow_execution_state_impl::on_num_meta_impl(std::size_t num_columns)
+{
+    on_new_resultset();
+    meta_.reserve(num_columns);
+    columns_.reserve(num_columns);
+}
+
+boost::mysql::error_code boost::mysql::detail::arrow_execution_state_impl::
+    on_meta_impl(const coldef_view& coldef, bool, diagnostics&)
+{
+    meta_.push_back(create_meta(coldef));
+    columns_.emplace_back(get_column_kind(meta_.back()));
+    return error_code();
+}
+
+boost::mysql::error_code boost::mysql::detail::arrow_execution_state_impl::
+    on_row_impl(span<const std::uint8_t> msg, const output_ref&, std::vector<field_view>&)
+{
+    column_data* cols = columns_.data();
+
+    // Append each field to its column as it gets deserialized
+    auto err = deserialize_row_fields(
+        encoding(),
+        msg,
+        meta_,
+        [cols](std::size_t i, field_view fv) { cols[i].append(fv); }
+    );
+
+    if (err)
+    {
+        // Leave all columns with the same number of values
+        for (auto& col : columns_)
+            col.truncate(num_rows_);
+        return err;
+    }
+
+    ++num_rows_;
+    return error_code();
+}
+
+boost::mysql::error_code boost::mysql::detail::arrow_execution_state_impl::on_row_ok_packet_impl(
+    const ok_view& pack
+)
+{
+    on_ok_packet_impl(pack);
+    return error_code();
+}
+
+void boost::mysql::detail::arrow_execution_state_impl::export_schema(ArrowSchema& out) const
+{
+    std::unique_ptr<arrow_schema_holder> holder(new arrow_schema_holder);
+    holder->children.resize(meta_.size(), ArrowSchema{});
+    holder->children_ptrs.reserve(meta_.size());
+
+    for (std::size_t i = 0; i < meta_.size(); ++i)
+    {
+        const auto& meta = meta_[i];
+        auto kind = columns_[i].kind;
+        std::unique_ptr<arrow_schema_holder> child_holder(new arrow_schema_holder);
+        child_holder->name.assign(meta.column_name().data(), meta.column_name().size());
+
+        // Invalid dates and datetimes are exported as NULLs, so these are always nullable
+        bool nullable = !meta.is_not_null() || kind == field_kind::date || kind == field_kind::datetime;
+
+        ArrowSchema& child = holder->children[i];
+        child.format = get_arrow_format(kind);
+        child.name = child_holder->name.c_str();
+        child.metadata = nullptr;
+        child.flags = nullable ? ARROW_FLAG_NULLABLE : 0;
+        child.n_children = 0;
+        child.children = nullptr;
+        child.dictionary = nullptr;
+        child.release = &release_arrow_schema;
+        child.private_data = child_holder.release();
+        holder->children_ptrs.push_back(&child);
+    }
+
+    out.format = "+s";
+    out.name = "";
+    out.metadata = nullptr;
+    out.flags = 0;
+    out.n_children = static_cast<int64_t>(meta_.size());
+    out.children = holder->children_ptrs.data();
+    out.dictionary = nullptr;
+    out.release = &release_arrow_schema;
+    out.private_data = holder.release();
+}
+
+std::size_t boost::mysql::detail::arrow_execution_state_impl::export_batch(ArrowArray& out)
+{
+    // Move the current batch out, leaving empty columns in place. If anything below throws,
+    // the batch is lost, but *this remains usable
+    std::vector<column_data> batch;
+    batch.reserve(columns_.size());
+    for (const auto& col : columns_)
+        batch.emplace_back(col.kind);
+    batch.swap(columns_);
+    std::size_t num_rows = num_rows_;
+    num_rows_ = 0;
+
+    std::unique_ptr<arrow_struct_holder> holder(new arrow_struct_holder);
+    holder->children.resize(batch.size(), ArrowArray{});
+    holder->children_ptrs.reserve(batch.size());
+    for (std::size_t i = 0; i < batch.size(); ++i)
+    {
+        arrow_export_column(std::move(batch[i]), holder->children[i]);
+        holder->children_ptrs.push_back(&holder->children[i]);
+    }
+
+    // The top-level struct never contains NULLs
+    out.length = static_cast<int64_t>(num_rows);
+    out.null_count = 0;
+    out.offset = 0;
+    out.n_buffers = 1;
+    out.n_children = static_cast<int64_t>(batch.size());
+    out.buffers = holder->buffers;
+    out.children = holder->children_ptrs.data();
+    out.dictionary = nullptr;
+    out.release = &release_arrow_struct;
+    out.private_data = holder.release();
+
+    return num_rows;
+}
+
+#endif
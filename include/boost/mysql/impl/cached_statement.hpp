@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_CACHED_STATEMENT_HPP
+#define BOOST_MYSQL_IMPL_CACHED_STATEMENT_HPP
+
+#pragma once
+
+#include <boost/mysql/cached_statement.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/any_execution_request.hpp>
+#include <boost/mysql/detail/writable_field_traits.hpp>
+
+#include <boost/core/ignore_unused.hpp>
+#include <boost/mp11/integer_sequence.hpp>
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+// Execution request traits
+namespace boost {
+namespace mysql {
+namespace detail {
+
+template <std::size_t N>
+struct cached_statement_proxy
+{
+    string_view sql;
+    std::array<field_view, N> params;
+
+    operator any_execution_request() const
+    {
+        return any_execution_request(any_execution_request::data_t::cached_stmt_t{sql, params});
+    }
+};
+
+template <class... T>
+struct execution_request_traits<cached_statement_t<T...>>
+{
+    template <std::size_t... I>
+    static cached_statement_proxy<sizeof...(T)> make_request_impl(
+        const cached_statement_t<T...>& input,
+        mp11::index_sequence<I...>
+    )
+    {
+        boost::ignore_unused(input);  // MSVC gets confused for tuples of size 0
+        return {input.sql, {{to_field(std::get<I>(input.params))...}}};
+    }
+
+    static cached_statement_proxy<sizeof...(T)> make_request(
+        const cached_statement_t<T...>& input,
+        std::vector<field_view>&
+    )
+    {
+        return make_request_impl(input, mp11::make_index_sequence<sizeof...(T)>());
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,214 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_COLUMNAR_RESULTS_IMPL_IPP
+#define BOOST_MYSQL_IMPL_COLUMNAR_RESULTS_IMPL_IPP
+
+#pragma once
+
+#include <boost/mysql/column_type.hpp>
+
+#include <boost/mysql/detail/execution_processor/columnar_results_impl.hpp>
+
+#include <boost/mysql/impl/internal/protocol/deserialization.hpp>
+
+void boost::mysql::detail::column_data::append(field_view value)
+{
+    // Validity bitmap
+    if (size % 8u == 0u)
+        validity.push_back(0u);
+    bool is_null = value.is_null();
+    if (is_null)
+        ++null_count;
+    else
+        validity.back() = static_cast<std::uint8_t>(validity.back() | (1u << (size % 8u)));
+    ++size;
+
+    // Values. The deserialization functions always produce the kind that corresponds
+    // to the column type, so only NULLs may differ
+    BOOST_ASSERT(is_null || value.kind() == kind);
+    switch (kind)
+    {
+    case field_kind::int64: int64_values.push_back(is_null ? 0 : value.get_int64()); break;
+    case field_kind::uint64: uint64_values.push_back(is_null ? 0u : value.get_uint64()); break;
+    case field_kind::float_: float_values.push_back(is_null ? 0.0f : value.get_float()); break;
+    case field_kind::double_: double_values.push_back(is_null ? 0.0 : value.get_double()); break;
+    case field_kind::date: date_values.push_back(is_null ? date() : value.get_date()); break;
+    case field_kind::datetime: datetime_values.push_back(is_null ? datetime() : value.get_datetime()); break;
+    case field_kind::time: time_values.push_back(is_null ? time() : value.get_time()); break;
+    case field_kind::string:
+        if (!is_null)
+        {
+            auto str = value.get_string();
+            bytes.insert(bytes.end(), str.begin(), str.end());
+        }
+        offsets.push_back(bytes.size());
+        break;
+    case field_kind::blob:
+        if (!is_null)
+        {
+            auto b = value.get_blob();
+            bytes.insert(bytes.end(), b.begin(), b.end());
+        }
+        offsets.push_back(bytes.size());
+        break;
+    default: BOOST_ASSERT(false);
+    }
+}
+
+void boost::mysql::detail::column_data::truncate(std::size_t new_size) noexcept
+{
+    BOOST_ASSERT(new_size <= size);
+
+    // Recompute the null count and clear the bits past the end
+    for (std::size_t i = new_size; i < size; ++i)
+    {
+        if (is_null(i))
+            --null_count;
+    }
+    validity.resize((new_size + 7u) / 8u);
+    if (new_size % 8u)
+        validity.back() = static_cast<std::uint8_t>(validity.back() & ((1u << (new_size % 8u)) - 1u));
+
+    // Values
+    switch (kind)
+    {
+    case field_kind::int64: int64_values.resize(new_size); break;
+    case field_kind::uint64: uint64_values.resize(new_size); break;
+    case field_kind::float_: float_values.resize(new_size); break;
+    case field_kind::double_: double_values.resize(new_size); break;
+    case field_kind::date: date_values.resize(new_size); break;
+    case field_kind::datetime: datetime_values.resize(new_size); break;
+    case field_kind::time: time_values.resize(new_size); break;
+    case field_kind::string:
+    case field_kind::blob:
+        bytes.resize(offsets[new_size]);
+        offsets.resize(new_size + 1u);
+        break;
+    default: break;
+    }
+    size = new_size;
+}
+
+boost::mysql::field_kind boost::mysql::detail::get_column_kind(const metadata& meta) noexcept
+{
+    // This mirrors what the text and binary deserialization functions do
+    switch (meta.type())
+    {
+    case column_type::tinyint:
+    case column_type::smallint:
+    case column_type::mediumint:
+    case column_type::int_:
+    case column_type::bigint:
+    case column_type::year: return meta.is_unsigned() ? field_kind::uint64 : field_kind::int64;
+    case column_type::bit: return field_kind::uint64;
+    case column_type::float_: return field_kind::float_;
+    case column_type::double_: return field_kind::double_;
+    case column_type::date: return field_kind::date;
+    case column_type::datetime:
+    case column_type::timestamp: return field_kind::datetime;
+    case column_type::time: return field_kind::time;
+    case column_type::char_:
+    case column_type::varchar:
+    case column_type::text:
+    case column_type::enum_:
+    case column_type::set:
+    case column_type::decimal:
+    case column_type::json: return field_kind::string;
+    default: return field_kind::blob;
+    }
+}
+
+void boost::mysql::detail::columnar_results_impl::reset_impl() noexcept
+{
+    meta_.clear();
+    columns_.clear();
+    per_result_.clear();
+    info_.clear();
+}
+
+void boost::mysql::detail::columnar_results_impl::on_num_meta_impl(std::size_t num_columns)
+{
+    auto& resultset_data = add_resultset();
+    meta_.reserve(meta_.size() + num_columns);
+    columns_.reserve(columns_.size() + num_columns);
+    resultset_data.num_columns = num_columns;
+}
+
+boost::mysql::error_code boost::mysql::detail::columnar_results_impl::
+    on_head_ok_packet_impl(const ok_view& pack, diagnostics&)
+{
+    add_resultset();
+    on_ok_packet_impl(pack);
+    return error_code();
+}
+
+boost::mysql::error_code boost::mysql::detail::columnar_results_impl::
+    on_meta_impl(const coldef_view& coldef, bool, diagnostics&)
+{
+    meta_.push_back(create_meta(coldef));
+    columns_.emplace_back(get_column_kind(meta_.back()));
+    return error_code();
+}
+
+boost::mysql::error_code boost::mysql::detail::columnar_results_impl::
+    on_row_impl(span<const std::uint8_t> msg, const output_ref&, std::vector<field_view>&)
+{
+    auto& resultset_data = per_result_.back();
+    column_data* cols = columns_.data() + resultset_data.meta_offset;
+    auto meta = get_meta(per_result_.size() - 1u);
+
+    // Append each field to its column as it gets deserialized
+    auto err = deserialize_row_fields(
+        encoding(),
+        msg,
+        meta,
+        [cols](std::size_t i, field_view fv) { cols[i].append(fv); }
+    );
+
+    if (err)
+    {
+        // Leave all columns with the same number of values
+        for (std::size_t i = 0; i < resultset_data.num_columns; ++i)
+            cols[i].truncate(resultset_data.num_rows);
+        return err;
+    }
+
+    ++resultset_data.num_rows;
+    return error_code();
+}
+
+boost::mysql::error_code boost::mysql::detail::columnar_results_impl::on_row_ok_packet_impl(
+    const ok_view& pack
+)
+{
+    on_ok_packet_impl(pack);
+    return error_code();
+}
+
+boost::mysql::detail::columnar_resultset_data& boost::mysql::detail::columnar_results_impl::add_resultset()
+{
+    per_result_.emplace_back();
+    auto& resultset_data = per_result_.back();
+    resultset_data.meta_offset = meta_.size();
+    resultset_data.info_offset = info_.size();
+    return resultset_data;
+}
+
+void boost::mysql::detail::columnar_results_impl::on_ok_packet_impl(const ok_view& pack)
+{
+    auto& resultset_data = per_result_.back();
+    resultset_data.affected_rows = pack.affected_rows;
+    resultset_data.last_insert_id = pack.last_insert_id;
+    resultset_data.warnings = pack.warnings;
+    resultset_data.info_size = pack.info.size();
+    resultset_data.has_ok_packet_data = true;
+    resultset_data.is_out_params = pack.is_out_params();
+    info_.insert(info_.end(), pack.info.begin(), pack.info.end());
+}
+
+#endif
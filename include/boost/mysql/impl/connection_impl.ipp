@@ -18,6 +18,7 @@
 
 #include <boost/mysql/impl/internal/sansio/connection_state.hpp>
 
+#include <boost/container/pmr/memory_resource.hpp>
 #include <boost/throw_exception.hpp>
 
 #include <cstddef>
@@ -30,6 +31,9 @@ namespace detail {
 inline connection_state* new_connection_state(
     std::size_t initial_buffer_size,
     std::size_t max_buffer_size,
+    std::size_t buffer_shrink_threshold,
+    container::pmr::memory_resource* buffer_resource,
+    std::size_t statement_cache_size,
     bool engine_supports_ssl
 )
 {
@@ -39,7 +43,21 @@ inline connection_state* new_connection_state(
             "any_connection::any_connection: initial_buffer_size should be <= max_buffer_size"
         ));
     }
-    return new connection_state(initial_buffer_size, max_buffer_size, engine_supports_ssl);
+    if (statement_cache_size == 0u)
+    {
+        BOOST_THROW_EXCEPTION(
+            std::invalid_argument("any_connection::any_connection: statement_cache_size should be > 0")
+        );
+    }
+    auto* res = new connection_state(
+        initial_buffer_size,
+        max_buffer_size,
+        engine_supports_ssl,
+        buffer_resource
+    );
+    res->data().buffer_shrink_threshold = buffer_shrink_threshold;
+    res->data().stmt_cache = statement_cache(statement_cache_size);
+    return res;
 }
 
 }  // namespace detail
@@ -56,10 +74,20 @@ std::vector<boost::mysql::field_view>& boost::mysql::detail::get_shared_fields(c
 boost::mysql::detail::connection_impl::connection_impl(
     std::size_t read_buff_size,
     std::size_t max_buffer_size,
+    std::size_t buffer_shrink_threshold,
+    container::pmr::memory_resource* buffer_resource,
+    std::size_t statement_cache_size,
     std::unique_ptr<engine> eng
 )
     : engine_(std::move(eng)),
-      st_(new_connection_state(read_buff_size, max_buffer_size, engine_->supports_ssl()))
+      st_(new_connection_state(
+          read_buff_size,
+          max_buffer_size,
+          buffer_shrink_threshold,
+          buffer_resource,
+          statement_cache_size,
+          engine_->supports_ssl()
+      ))
 {
 }
 
@@ -70,6 +98,11 @@ boost::mysql::metadata_mode boost::mysql::detail::connection_impl::meta_mode() c
 
 void boost::mysql::detail::connection_impl::set_meta_mode(metadata_mode v) { st_->data().meta_mode = v; }
 
+void boost::mysql::detail::connection_impl::set_local_infile_handler(local_infile_handler h)
+{
+    st_->data().local_infile = std::move(h);
+}
+
 bool boost::mysql::detail::connection_impl::ssl_active() const { return st_->data().ssl_active(); }
 
 bool boost::mysql::detail::connection_impl::backslash_escapes() const
@@ -82,6 +115,16 @@ boost::mysql::diagnostics& boost::mysql::detail::connection_impl::shared_diag()
     return st_->data().shared_diag;
 }
 
+bool boost::mysql::detail::connection_impl::session_reset_required() const
+{
+    return st_->data().session_reset_required();
+}
+
+void boost::mysql::detail::connection_impl::mark_session_clean()
+{
+    st_->data().session_state_changed = false;
+}
+
 boost::system::result<boost::mysql::character_set> boost::mysql::detail::connection_impl::
     current_character_set() const
 {
@@ -97,7 +140,12 @@ boost::mysql::detail::run_pipeline_algo_params boost::mysql::detail::connection_
 )
 {
     const auto& req_impl = access::get_impl(req);
-    return {req_impl.buffer_, req_impl.stages_, &response};
+    return {
+        req_impl.buffer_,
+        req_impl.stages_,
+        &response,
+        req_impl.response_mode_ == pipeline_response_mode::summary,
+    };
 }
 
 template <class AlgoParams>
@@ -137,6 +185,7 @@ BOOST_MYSQL_INSTANTIATE_SETUP(read_some_rows_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(read_some_rows_dynamic_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(prepare_statement_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(close_statement_algo_params)
+BOOST_MYSQL_INSTANTIATE_SETUP(send_long_data_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(set_character_set_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(ping_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(reset_connection_algo_params)
@@ -16,6 +16,7 @@
 
 #include <boost/mysql/impl/internal/connection_pool/connection_pool_impl.hpp>
 
+#include <cstddef>
 #include <memory>
 
 void boost::mysql::detail::return_connection(
@@ -57,6 +58,14 @@ boost::mysql::any_connection& boost::mysql::detail::get_connection(boost::mysql:
     return node.connection();
 }
 
+boost::mysql::statement boost::mysql::detail::get_prepared_statement(
+    const connection_node& node,
+    std::size_t index
+) noexcept
+{
+    return node.prepared_statement(index);
+}
+
 boost::mysql::connection_pool::connection_pool(pool_executor_params&& ex_params, pool_params&& params, int)
     : impl_(std::make_shared<detail::pool_impl>(std::move(ex_params), std::move(params)))
 {
@@ -85,6 +94,19 @@ void boost::mysql::connection_pool::async_get_connection_erased(
     pool->async_get_connection(timeout, diag, std::move(handler));
 }
 
+boost::mysql::pooled_connection boost::mysql::connection_pool::try_get_connection()
+{
+    BOOST_ASSERT(valid());
+    BOOST_ASSERT(impl_->running_in_pool_executor());
+    return impl_->try_get_connection_unsafe();
+}
+
+boost::mysql::pool_stats boost::mysql::connection_pool::stats() const noexcept
+{
+    BOOST_ASSERT(valid());
+    return impl_->stats();
+}
+
 void boost::mysql::connection_pool::cancel()
 {
     BOOST_ASSERT(valid());
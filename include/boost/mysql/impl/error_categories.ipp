@@ -83,6 +83,18 @@ inline const char* error_to_string(client_errc error)
     case client_errc::max_buffer_size_exceeded:
         return "An operation attempted to read or write a packet larger than the maximum buffer size. "
                "Try increasing any_connection_params::max_buffer_size.";
+    case client_errc::local_infile_no_handler:
+        return "The server requested a file using LOAD DATA LOCAL INFILE, but no handler was set. "
+               "Use any_connection::set_local_infile_handler to supply the file contents.";
+    case client_errc::batch_returned_rows:
+        return "A statement executed as a batch returned a resultset with rows. Batches only support "
+               "statements that don't return rows, like INSERT or UPDATE.";
+    case client_errc::local_infile_in_pipeline:
+        return "The server requested a file using LOAD DATA LOCAL INFILE while running a pipeline. "
+               "These statements are not supported in pipelines.";
+    case client_errc::batch_with_long_data:
+        return "A statement executed as a batch has parameters that received data via send_long_data. "
+               "Batches don't support long data.";
 
     default: return "<unknown MySQL client error>";
     }
@@ -23,6 +23,10 @@ void boost::mysql::detail::execution_state_impl::on_ok_packet_impl(const ok_view
     eof_data_.warnings = pack.warnings;
     eof_data_.is_out_params = pack.is_out_params();
     info_.assign(pack.info.begin(), pack.info.end());
+    session_track_.assign(
+        pack.session_state_info.data(),
+        pack.session_state_info.data() + pack.session_state_info.size()
+    );
 }
 
 void boost::mysql::detail::execution_state_impl::reset_impl() noexcept
@@ -30,6 +34,7 @@ void boost::mysql::detail::execution_state_impl::reset_impl() noexcept
     meta_.clear();
     eof_data_ = ok_data();
     info_.clear();
+    session_track_.clear();
 }
 
 boost::mysql::error_code boost::mysql::detail::execution_state_impl::
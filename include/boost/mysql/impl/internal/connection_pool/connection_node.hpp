@@ -14,7 +14,10 @@
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/pipeline.hpp>
+#include <boost/mysql/pool_stats.hpp>
+#include <boost/mysql/statement.hpp>
 
+#include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/connection_pool_fwd.hpp>
 
 #include <boost/mysql/impl/internal/connection_pool/internal_pool_params.hpp>
@@ -29,7 +32,12 @@
 #include <boost/intrusive/list.hpp>
 #include <boost/intrusive/list_hook.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
 #include <utility>
 #include <vector>
 
@@ -46,6 +54,89 @@ struct io_traits
 {
     using connection_type = any_connection;
     using timer_type = asio::steady_timer;
+
+    // The current time, as used by timer_type
+    static std::chrono::steady_clock::time_point now(const asio::any_io_executor&)
+    {
+        return std::chrono::steady_clock::now();
+    }
+
+    // Whether the connection requires a reset to get a clean session. Used by lazy resets
+    static bool session_reset_required(const connection_type& conn)
+    {
+        return access::get_impl(conn).session_reset_required();
+    }
+
+    // Marks the current session state as clean. Used after running the reset pipeline
+    static void mark_session_clean(connection_type& conn) { access::get_impl(conn).mark_session_clean(); }
+};
+
+// The reset pipeline contains a reset and a set character set stage,
+// followed by a prepare statement stage for every statement in pool_params::prepared_statements
+// and, if lazy resets are enabled, a stage enabling session state tracking
+constexpr std::size_t reset_pipeline_num_fixed_stages = 2u;
+
+// Adds a non-negative duration to a time point, without overflowing
+inline std::chrono::steady_clock::time_point saturating_add(
+    std::chrono::steady_clock::time_point tp,
+    std::chrono::steady_clock::duration dur
+) noexcept
+{
+    constexpr auto max_tp = (std::chrono::steady_clock::time_point::max)();
+    return dur > max_tp - tp ? max_tp : tp + dur;
+}
+
+// Counters backing connection_pool::stats(). Only written from within the pool's executor,
+// but may be read from any thread
+struct pool_counters
+{
+    using rep = std::chrono::steady_clock::duration::rep;
+
+    std::atomic<std::size_t> num_connections{0};
+    std::atomic<std::size_t> num_in_use{0};
+    std::atomic<std::size_t> num_pending{0};
+    std::atomic<std::size_t> num_waiting_requests{0};
+    std::atomic<std::uint64_t> total_checkouts{0};
+    std::atomic<std::uint64_t> total_checkout_timeouts{0};
+    std::atomic<rep> total_checkout_wait_time{0};
+    std::atomic<std::uint64_t> total_connects{0};
+    std::atomic<std::uint64_t> total_connect_errors{0};
+    std::atomic<std::uint64_t> total_resets{0};
+    std::atomic<std::uint64_t> total_reset_errors{0};
+    std::atomic<std::uint64_t> total_skipped_resets{0};
+    std::atomic<rep> total_reset_time{0};
+
+    template <class T>
+    static void add(std::atomic<T>& counter, T value) noexcept
+    {
+        counter.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    template <class T>
+    static T get(const std::atomic<T>& counter) noexcept
+    {
+        return counter.load(std::memory_order_relaxed);
+    }
+
+    pool_stats snapshot(std::size_t num_idle) const noexcept
+    {
+        pool_stats res;
+        res.num_connections = get(num_connections);
+        res.num_idle = num_idle;
+        res.num_in_use = get(num_in_use);
+        res.num_pending = get(num_pending);
+        res.num_waiting_requests = get(num_waiting_requests);
+        res.total_checkouts = get(total_checkouts);
+        res.total_checkout_timeouts = get(total_checkout_timeouts);
+        res.total_checkout_wait_time = std::chrono::steady_clock::duration(get(total_checkout_wait_time));
+        res.total_connects = get(total_connects);
+        res.total_connect_errors = get(total_connect_errors);
+        res.total_resets = get(total_resets);
+        res.total_reset_errors = get(total_reset_errors);
+        res.total_skipped_resets = get(total_skipped_resets);
+        res.total_reset_time = std::chrono::steady_clock::duration(get(total_reset_time));
+        return res;
+    }
 };
 
 // State shared between connection tasks
@@ -55,6 +146,14 @@ struct conn_shared_state
     intrusive::list<basic_connection_node<IoTraits>> idle_list;
     timer_list<typename IoTraits::timer_type> pending_requests;
     std::size_t num_pending_connections{0};
+    std::atomic<std::size_t> num_idle{0};  // Same as idle_list.size(), but can be read from any thread
+    std::size_t num_connections{0};  // Connections not being closed because of the idle timeout
+
+    // Generates jitter for max_lifetime. Seeded once per pool, so that different pools
+    // (e.g. processes in a fleet or shards in a sharded pool) don't recycle connections in lockstep
+    std::minstd_rand lifetime_rng{std::random_device{}()};
+
+    pool_counters counters;
     error_code last_ec;
     diagnostics last_diag;
 };
@@ -74,11 +173,14 @@ class basic_connection_node : public intrusive::list_base_hook<>,
     conn_shared_state<IoTraits>* shared_st_;
     connection_type conn_;
     timer_type timer_;
-    diagnostics connect_diag_;
+    diagnostics connect_diag_;  // Used by connects and resets
     timer_type collection_timer_;  // Notifications about collections. A separate timer makes potential race
                                    // conditions not harmful
     const pipeline_request* reset_pipeline_req_;
     std::vector<stage_response> reset_pipeline_res_;
+    std::chrono::steady_clock::time_point last_used_;          // Last connect or collection
+    std::chrono::steady_clock::time_point lifetime_deadline_;  // When to recycle the connection
+    std::chrono::steady_clock::time_point action_start_;       // When the last connect or reset started
 
     // Thread-safe
     std::atomic<collection_state> collection_state_{collection_state::none};
@@ -88,11 +190,24 @@ class basic_connection_node : public intrusive::list_base_hook<>,
     void entering_idle()
     {
         shared_st_->idle_list.push_back(*this);
+        shared_st_->num_idle.store(shared_st_->idle_list.size(), std::memory_order_relaxed);
         shared_st_->pending_requests.notify_one();
     }
-    void exiting_idle() { shared_st_->idle_list.erase(shared_st_->idle_list.iterator_to(*this)); }
-    void entering_pending() { ++shared_st_->num_pending_connections; }
-    void exiting_pending() { --shared_st_->num_pending_connections; }
+    void exiting_idle()
+    {
+        shared_st_->idle_list.erase(shared_st_->idle_list.iterator_to(*this));
+        shared_st_->num_idle.store(shared_st_->idle_list.size(), std::memory_order_relaxed);
+    }
+    void entering_pending()
+    {
+        auto num_pending = ++shared_st_->num_pending_connections;
+        shared_st_->counters.num_pending.store(num_pending, std::memory_order_relaxed);
+    }
+    void exiting_pending()
+    {
+        auto num_pending = --shared_st_->num_pending_connections;
+        shared_st_->counters.num_pending.store(num_pending, std::memory_order_relaxed);
+    }
 
     // Helpers
     void propagate_connect_diag(error_code ec)
@@ -101,6 +216,99 @@ class basic_connection_node : public intrusive::list_base_hook<>,
         shared_st_->last_diag = connect_diag_;
     }
 
+    std::chrono::steady_clock::time_point now() { return IoTraits::now(timer_.get_executor()); }
+
+    void on_connected()
+    {
+        last_used_ = now();
+        if (params_->max_lifetime.count() > 0)
+        {
+            // Shorten the lifetime by up to 1/8, so connections created at the same time
+            // don't get recycled at the same time
+            using rep = std::chrono::steady_clock::duration::rep;
+            rep max_jitter = params_->max_lifetime.count() / 8;
+            rep jitter = 0;
+            if (max_jitter > 0)
+                jitter = std::uniform_int_distribution<rep>(0, max_jitter - 1)(shared_st_->lifetime_rng);
+            lifetime_deadline_ = saturating_add(
+                last_used_,
+                params_->max_lifetime - std::chrono::steady_clock::duration(jitter)
+            );
+        }
+    }
+
+    void exiting_in_use() { shared_st_->counters.num_in_use.fetch_sub(1u, std::memory_order_relaxed); }
+
+    // Updates counters and reports latency after a connect or reset
+    void record_action(pool_latency_kind kind, error_code ec)
+    {
+        auto& counters = shared_st_->counters;
+        auto elapsed = now() - action_start_;
+        if (kind == pool_latency_kind::connect)
+        {
+            auto& counter = ec ? counters.total_connect_errors : counters.total_connects;
+            pool_counters::add(counter, std::uint64_t(1));
+            params_->observe_latency(pool_latency_kind::connect, elapsed);
+        }
+        else
+        {
+            pool_counters::add(counters.total_resets, std::uint64_t(1));
+            if (ec)
+                pool_counters::add(counters.total_reset_errors, std::uint64_t(1));
+            pool_counters::add(counters.total_reset_time, elapsed.count());
+            params_->observe_latency(pool_latency_kind::reset, elapsed);
+        }
+    }
+
+    // Idle connections may only be closed if this doesn't make the pool shrink below its minimum size
+    bool can_shrink() const noexcept
+    {
+        return params_->idle_timeout.count() > 0 &&
+               shared_st_->num_connections > (std::max)(params_->initial_size, params_->min_idle);
+    }
+
+    // Only idle connections may expire. Connections in use are recycled when returned to the pool.
+    // If the connection is to be closed because of the idle timeout,
+    // it stops counting towards the pool's size.
+    connection_expiry check_expiry(collection_state col_st)
+    {
+        auto st = this->status();
+        bool collected = st == connection_status::in_use && col_st != collection_state::none;
+        if (st != connection_status::idle && !collected)
+            return connection_expiry::none;
+        auto tp = now();
+        if (params_->max_lifetime.count() > 0 && tp >= lifetime_deadline_)
+            return connection_expiry::max_lifetime;
+        if (st == connection_status::idle && can_shrink() &&
+            tp >= saturating_add(last_used_, params_->idle_timeout))
+        {
+            --shared_st_->num_connections;
+            return connection_expiry::idle_timeout;
+        }
+        return connection_expiry::none;
+    }
+
+    // How long to wait for a collection notification before checking the connection again.
+    // Zero means waiting forever
+    std::chrono::steady_clock::duration idle_wait_timeout()
+    {
+        auto res = params_->ping_interval;
+        if (this->status() != connection_status::idle)
+            return res;
+        auto tp = now();
+        auto consider = [&res, tp](std::chrono::steady_clock::time_point deadline) {
+            // Zero means no timeout, so deadlines in the past are rounded up
+            auto timeout = (std::max)(deadline - tp, std::chrono::steady_clock::duration(1));
+            if (res.count() == 0 || timeout < res)
+                res = timeout;
+        };
+        if (params_->max_lifetime.count() > 0)
+            consider(lifetime_deadline_);
+        if (can_shrink())
+            consider(saturating_add(last_used_, params_->idle_timeout));
+        return res;
+    }
+
     struct connection_task_op
     {
         this_type& node_;
@@ -119,10 +327,53 @@ class basic_connection_node : public intrusive::list_base_hook<>,
             // Connect actions should set the shared diagnostics, so these
             // get reported to the user
             if (last_act_ == next_connection_action::connect)
+            {
                 node_.propagate_connect_diag(ec);
+                node_.record_action(pool_latency_kind::connect, ec);
+                if (!ec)
+                    node_.on_connected();
+            }
+            else if (last_act_ == next_connection_action::reset)
+            {
+                node_.record_action(pool_latency_kind::reset, ec);
+
+                // Resets that are part of connection establishment report errors like connects do
+                if (ec && node_.reset_follows_connect())
+                    node_.propagate_connect_diag(ec);
+
+                // Changes caused by the reset pipeline itself are part of the clean state
+                if (!ec && node_.params_->lazy_reset)
+                    IoTraits::mark_session_clean(node_.conn_);
+            }
+
+            // With lazy resets, clean sessions are not reset. Lazy resets cause
+            // a reset after connect, so session tracking is always enabled at this point
+            if (col_st == collection_state::needs_collect_with_reset && node_.params_->lazy_reset &&
+                !IoTraits::session_reset_required(node_.conn_))
+            {
+                col_st = collection_state::needs_collect;
+                pool_counters::add(node_.shared_st_->counters.total_skipped_resets, std::uint64_t(1));
+            }
+
+            // Connections stop being in use once collected
+            bool was_in_use = node_.status() == connection_status::in_use;
+
+            // Collections count as uses for the idle timeout
+            if (col_st != collection_state::none)
+                node_.last_used_ = node_.now();
+
+            // Check whether the connection should be closed
+            auto exp = last_act_ == next_connection_action::idle_wait ? node_.check_expiry(col_st)
+                                                                       : connection_expiry::none;
 
             // Invoke the sans-io algorithm
-            last_act_ = node_.resume(ec, col_st);
+            last_act_ = node_.resume(ec, col_st, exp);
+            if (was_in_use && node_.status() != connection_status::in_use)
+                node_.exiting_in_use();
+
+            // Connects and resets are timed
+            if (last_act_ == next_connection_action::connect || last_act_ == next_connection_action::reset)
+                node_.action_start_ = node_.now();
 
             // Apply the next action. run_with_timeout makes sure that all handlers
             // are dispatched using the timer's executor (that is, the pool executor)
@@ -154,6 +405,7 @@ class basic_connection_node : public intrusive::list_base_hook<>,
                     node_.conn_.async_run_pipeline(
                         *node_.reset_pipeline_req_,
                         node_.reset_pipeline_res_,
+                        node_.connect_diag_,
                         asio::deferred
                     ),
                     node_.timer_,
@@ -161,11 +413,19 @@ class basic_connection_node : public intrusive::list_base_hook<>,
                     std::move(self)
                 );
                 break;
+            case next_connection_action::close:
+                run_with_timeout(
+                    node_.conn_.async_close(asio::deferred),
+                    node_.timer_,
+                    node_.params_->ping_timeout,
+                    std::move(self)
+                );
+                break;
             case next_connection_action::idle_wait:
                 run_with_timeout(
                     node_.collection_timer_.async_wait(asio::deferred),
                     node_.timer_,
-                    node_.params_->ping_interval,
+                    node_.idle_wait_timeout(),
                     std::move(self)
                 );
                 break;
@@ -183,7 +443,11 @@ public:
         conn_shared_state<IoTraits>& shared_st,
         const pipeline_request* reset_pipeline_req
     )
-        : params_(&params),
+        : sansio_connection_node<this_type>(
+              connection_status::initial,
+              !params.prepared_statements.empty() || params.lazy_reset
+          ),
+          params_(&params),
           shared_st_(&shared_st),
           conn_(std::move(conn_ex), params.make_ctor_params()),
           timer_(ex),
@@ -192,8 +456,17 @@ public:
     {
     }
 
+    // Must be called instead of the base class version, to keep counters up to date
+    void mark_as_in_use() noexcept
+    {
+        sansio_connection_node<this_type>::mark_as_in_use();
+        pool_counters::add(shared_st_->counters.num_in_use, std::size_t(1));
+    }
+
     void cancel()
     {
+        if (this->status() == connection_status::in_use)
+            exiting_in_use();
         sansio_connection_node<this_type>::cancel();
         timer_.cancel();
         collection_timer_.cancel();
@@ -210,6 +483,14 @@ public:
     connection_type& connection() noexcept { return conn_; }
     const connection_type& connection() const noexcept { return conn_; }
 
+    // Retrieves a statement prepared by the last reset pipeline.
+    // Must only be called while the connection is in use
+    statement prepared_statement(std::size_t index) const noexcept
+    {
+        BOOST_ASSERT(index + reset_pipeline_num_fixed_stages < reset_pipeline_res_.size());
+        return reset_pipeline_res_[index + reset_pipeline_num_fixed_stages].get_statement();
+    }
+
     // Not thread-safe, must be called within the pool's executor
     void notify_collectable() { collection_timer_.cancel(); }
 
@@ -14,6 +14,7 @@
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/pool_params.hpp>
+#include <boost/mysql/pool_stats.hpp>
 
 #include <boost/mysql/detail/config.hpp>
 
@@ -31,21 +32,33 @@
 #include <boost/asio/dispatch.hpp>
 #include <boost/asio/error.hpp>
 #include <boost/asio/post.hpp>
+#include <boost/asio/strand.hpp>
 #include <boost/core/ignore_unused.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <iterator>
 #include <list>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace boost {
 namespace mysql {
 namespace detail {
 
-inline pipeline_request make_reset_pipeline()
+// Resets session state and prepares the statements registered in the pool.
+// Statements come after the first reset_pipeline_num_fixed_stages stages.
+// If lazy_reset is enabled, session state tracking is enabled last
+inline pipeline_request make_reset_pipeline(const internal_pool_params& params)
 {
     pipeline_request req;
     req.add_reset_connection().add_set_character_set(utf8mb4_charset);
+    for (const auto& sql : params.prepared_statements)
+        req.add_prepare_statement(sql);
+    if (params.lazy_reset)
+        req.add_execute("SET session_track_state_change = ON");
     return req;
 }
 
@@ -75,7 +88,8 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
     shared_state_type shared_st_;
     wait_group wait_gp_;
     timer_type cancel_timer_;
-    const pipeline_request reset_pipeline_req_{make_reset_pipeline()};
+    timer_block_pool<timer_type> timer_pool_{params_.max_size};
+    const pipeline_request reset_pipeline_req_{make_reset_pipeline(params_)};
 
     std::shared_ptr<this_type> shared_from_this_wrapper()
     {
@@ -86,7 +100,48 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
     void create_connection()
     {
         all_conns_.emplace_back(params_, ex_, conn_ex_, shared_st_, &reset_pipeline_req_);
-        wait_gp_.run_task(all_conns_.back().async_run(asio::deferred));
+        ++shared_st_.num_connections;
+        shared_st_.counters.num_connections.store(all_conns_.size(), std::memory_order_relaxed);
+        auto it = std::prev(all_conns_.end());
+        wait_gp_.on_task_start();
+        it->async_run(asio::bind_executor(wait_gp_.get_executor(), [this, it](error_code) {
+            // While the pool is running, connections only exit after being closed
+            // because of the idle timeout. Remove them, so their slot can be reused
+            if (state_ == state_t::running)
+            {
+                all_conns_.erase(it);
+                shared_st_.counters.num_connections.store(all_conns_.size(), std::memory_order_relaxed);
+            }
+            wait_gp_.on_task_finish();
+        }));
+    }
+
+    // Creates connections concurrently until there are at least min_idle connections
+    // that are idle or pending (i.e. being established, reset or pinged), respecting max_size.
+    // Pending connections count because they're expected to become idle soon
+    void maintain_min_idle()
+    {
+        while (all_conns_.size() < params_.max_size &&
+               shared_st_.idle_list.size() + shared_st_.num_pending_connections < params_.min_idle)
+        {
+            create_connection();
+        }
+    }
+
+    // Records a connection being handed to the user, after waiting for wait_time
+    void record_checkout(std::chrono::steady_clock::duration wait_time)
+    {
+        pool_counters::add(shared_st_.counters.total_checkouts, std::uint64_t(1));
+        pool_counters::add(shared_st_.counters.total_checkout_wait_time, wait_time.count());
+        params_.observe_latency(pool_latency_kind::checkout_wait, wait_time);
+    }
+
+    void update_num_waiting_requests()
+    {
+        shared_st_.counters.num_waiting_requests.store(
+            shared_st_.pending_requests.size(),
+            std::memory_order_relaxed
+        );
     }
 
     error_code get_diagnostics(diagnostics* diag) const
@@ -133,6 +188,7 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
                 // Create the initial connections
                 for (std::size_t i = 0; i < obj_->params_.initial_size; ++i)
                     obj_->create_connection();
+                obj_->maintain_min_idle();
 
                 // Wait for the cancel notification to arrive.
                 BOOST_MYSQL_YIELD(resume_point_, 2, obj_->cancel_timer_.async_wait(std::move(self)))
@@ -166,6 +222,7 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
         diagnostics* diag_;
         std::unique_ptr<timer_block_type> timer_;
         error_code stored_ec_;
+        std::chrono::steady_clock::time_point start_;
 
         get_connection_op(
             std::shared_ptr<this_type> obj,
@@ -179,8 +236,12 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
         template <class Self>
         void do_complete(Self& self, error_code ec, ConnectionWrapper conn)
         {
-            // Resetting the timer will remove it from the list thanks to the auto-unlink feature
-            timer_.reset();
+            // Releasing the timer removes it from the list and makes it available for other requests
+            if (timer_)
+            {
+                obj_->timer_pool_.release(std::move(timer_));
+                obj_->update_num_waiting_requests();
+            }
             obj_.reset();
             self.complete(ec, std::move(conn));
         }
@@ -189,6 +250,8 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
         void complete_success(Self& self, node_type& node)
         {
             node.mark_as_in_use();
+            obj_->record_checkout(IoTraits::now(obj_->ex_) - start_);
+            obj_->maintain_min_idle();
             do_complete(self, error_code(), ConnectionWrapper(node, std::move(obj_)));
         }
 
@@ -205,6 +268,7 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
 
                 // Ensure we run within the pool's executor (or the handler's) (possibly a strand)
                 BOOST_MYSQL_YIELD(resume_point_, 1, asio::post(obj_->ex_, std::move(self)))
+                start_ = IoTraits::now(obj_->ex_);
 
                 // This loop guards us against possible race conditions
                 // between waiting on the pending request timer and getting the connection
@@ -240,11 +304,12 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
                         obj_->create_connection();
                     }
 
-                    // Allocate a timer to perform waits.
+                    // Get a timer to perform waits. This only allocates if no recycled timer is available
                     if (!timer_)
                     {
-                        timer_.reset(new timer_block_type(obj_->ex_));
+                        timer_ = obj_->timer_pool_.acquire(obj_->ex_);
                         obj_->shared_st_.pending_requests.push_back(*timer_);
+                        obj_->update_num_waiting_requests();
                     }
 
                     // Wait to be notified, or until a timeout happens
@@ -260,6 +325,8 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
                     if (!stored_ec_)
                     {
                         // We've got a timeout. Try to give as much info as possible
+                        auto& num_timeouts = obj_->shared_st_.counters.total_checkout_timeouts;
+                        pool_counters::add(num_timeouts, std::uint64_t(1));
                         do_complete(self, obj_->get_diagnostics(diag_), ConnectionWrapper());
                         return;
                     }
@@ -270,7 +337,12 @@ class basic_pool_impl : public std::enable_shared_from_this<basic_pool_impl<IoTr
 
 public:
     basic_pool_impl(pool_executor_params&& ex_params, pool_params&& params)
-        : params_(make_internal_pool_params(std::move(params))),
+        : basic_pool_impl(std::move(ex_params), make_internal_pool_params(std::move(params)))
+    {
+    }
+
+    basic_pool_impl(pool_executor_params&& ex_params, internal_pool_params&& params)
+        : params_(std::move(params)),
           ex_(std::move(ex_params.pool_executor)),
           conn_ex_(std::move(ex_params.connection_executor)),
           wait_gp_(ex_),
@@ -293,6 +365,43 @@ public:
         );
     }
 
+    // Whether the calling thread may access the pool's state without synchronization.
+    // We can only tell for strands, like the ones created by pool_executor_params::thread_safe.
+    // For any other executor, we assume the caller knows what they're doing.
+    bool running_in_pool_executor() const noexcept
+    {
+        const auto* strand = ex_.template target<asio::strand<asio::any_io_executor>>();
+        return strand == nullptr || strand->running_in_this_thread();
+    }
+
+    // Not thread-safe. Returns an idle connection, if any, without waiting or creating connections
+    ConnectionWrapper try_get_connection_unsafe()
+    {
+        if (state_ != state_t::running || shared_st_.idle_list.empty())
+            return ConnectionWrapper();
+        auto& node = shared_st_.idle_list.front();
+        node.mark_as_in_use();
+        record_checkout(std::chrono::steady_clock::duration(0));
+        maintain_min_idle();
+        return ConnectionWrapper(node, shared_from_this_wrapper());
+    }
+
+    // Thread-safe. The returned value may be outdated by the time it's used
+    std::size_t num_idle_hint() const noexcept
+    {
+        return shared_st_.num_idle.load(std::memory_order_relaxed);
+    }
+
+    // Thread-safe. Whether the pool can create more connections.
+    // The returned value may be outdated by the time it's used
+    bool has_capacity_hint() const noexcept
+    {
+        return pool_counters::get(shared_st_.counters.num_connections) < params_.max_size;
+    }
+
+    // Thread-safe. Values are read individually, so they may be slightly inconsistent
+    pool_stats stats() const noexcept { return shared_st_.counters.snapshot(num_idle_hint()); }
+
     // Not thread-safe
     void cancel_unsafe() { cancel_timer_.expires_at((std::chrono::steady_clock::time_point::min)()); }
 
@@ -330,6 +439,7 @@ public:
     // Exposed for testing
     std::list<node_type>& nodes() noexcept { return all_conns_; }
     shared_state_type& shared_state() noexcept { return shared_st_; }
+    timer_block_pool<timer_type>& timer_pool() noexcept { return timer_pool_; }
     internal_pool_params& params() noexcept { return params_; }
     asio::any_io_executor connection_ex() noexcept { return conn_ex_; }
     const pipeline_request& reset_pipeline_request() const { return reset_pipeline_req_; }
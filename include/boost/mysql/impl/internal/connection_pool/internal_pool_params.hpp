@@ -12,16 +12,19 @@
 #include <boost/mysql/connect_params.hpp>
 #include <boost/mysql/handshake_params.hpp>
 #include <boost/mysql/pool_params.hpp>
+#include <boost/mysql/pool_stats.hpp>
 #include <boost/mysql/ssl_mode.hpp>
 
 #include <boost/asio/ssl/context.hpp>
-#include <boost/optional/optional.hpp>
 #include <boost/throw_exception.hpp>
 
 #include <chrono>
 #include <cstddef>
+#include <functional>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace boost {
 namespace mysql {
@@ -31,22 +34,40 @@ namespace detail {
 struct internal_pool_params
 {
     connect_params connect_config;
-    optional<asio::ssl::context> ssl_ctx;
+    std::shared_ptr<asio::ssl::context> ssl_ctx;  // shared between shards in sharded pools
     std::size_t initial_buffer_size;
+    std::size_t buffer_shrink_threshold;
+    container::pmr::memory_resource* buffer_memory_resource;
+    std::size_t statement_cache_size;
+    std::vector<std::string> prepared_statements;
+    bool lazy_reset;
     std::size_t initial_size;
     std::size_t max_size;
+    std::size_t min_idle;
     std::chrono::steady_clock::duration connect_timeout;
     std::chrono::steady_clock::duration ping_timeout;
     std::chrono::steady_clock::duration retry_interval;
     std::chrono::steady_clock::duration ping_interval;
+    std::chrono::steady_clock::duration idle_timeout;
+    std::chrono::steady_clock::duration max_lifetime;
+    std::function<void(pool_latency_kind, std::chrono::steady_clock::duration)> latency_observer;
 
     any_connection_params make_ctor_params() noexcept
     {
         any_connection_params res;
-        res.ssl_context = ssl_ctx.get_ptr();
+        res.ssl_context = ssl_ctx.get();
         res.initial_buffer_size = initial_buffer_size;
+        res.buffer_shrink_threshold = buffer_shrink_threshold;
+        res.buffer_memory_resource = buffer_memory_resource;
+        res.statement_cache_size = statement_cache_size;
         return res;
     }
+
+    void observe_latency(pool_latency_kind kind, std::chrono::steady_clock::duration dur) const
+    {
+        if (latency_observer)
+            latency_observer(kind, dur);
+    }
 };
 
 inline void check_validity(const pool_params& params)
@@ -56,6 +77,10 @@ inline void check_validity(const pool_params& params)
         msg = "pool_params::max_size must be greater than zero";
     else if (params.max_size < params.initial_size)
         msg = "pool_params::max_size must be greater than pool_params::initial_size";
+    else if (params.max_size < params.min_idle)
+        msg = "pool_params::max_size must be greater than pool_params::min_idle";
+    else if (params.statement_cache_size == 0)
+        msg = "pool_params::statement_cache_size must be greater than zero";
     else if (params.connect_timeout.count() < 0)
         msg = "pool_params::connect_timeout must not be negative";
     else if (params.retry_interval.count() <= 0)
@@ -64,6 +89,10 @@ inline void check_validity(const pool_params& params)
         msg = "pool_params::ping_interval must not be negative";
     else if (params.ping_timeout.count() < 0)
         msg = "pool_params::ping_timeout must not be negative";
+    else if (params.idle_timeout.count() < 0)
+        msg = "pool_params::idle_timeout must not be negative";
+    else if (params.max_lifetime.count() < 0)
+        msg = "pool_params::max_lifetime must not be negative";
 
     if (msg != nullptr)
     {
@@ -85,15 +114,42 @@ inline internal_pool_params make_internal_pool_params(pool_params&& params)
 
     return {
         std::move(connect_prms),
-        std::move(params.ssl_ctx),
+        params.ssl_ctx ? std::make_shared<asio::ssl::context>(std::move(*params.ssl_ctx))
+                       : std::shared_ptr<asio::ssl::context>(),
         params.initial_buffer_size,
+        params.buffer_shrink_threshold,
+        params.buffer_memory_resource,
+        params.statement_cache_size,
+        std::move(params.prepared_statements),
+        params.lazy_reset,
         params.initial_size,
         params.max_size,
+        params.min_idle,
         params.connect_timeout,
         params.ping_timeout,
         params.retry_interval,
         params.ping_interval,
+        params.idle_timeout,
+        params.max_lifetime,
+        std::move(params.latency_observer),
+    };
+}
+
+// Sharded pools split their sizes between shards. Shards are otherwise configured like the pool
+inline internal_pool_params make_shard_params(
+    const internal_pool_params& params,
+    std::size_t num_shards,
+    std::size_t shard_index
+)
+{
+    auto split = [=](std::size_t value) {
+        return value / num_shards + (shard_index < value % num_shards ? 1u : 0u);
     };
+    internal_pool_params res = params;
+    res.initial_size = split(params.initial_size);
+    res.max_size = split(params.max_size);
+    res.min_idle = split(params.min_idle);
+    return res;
 }
 
 }  // namespace detail
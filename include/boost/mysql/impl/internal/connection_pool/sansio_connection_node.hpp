@@ -42,7 +42,14 @@ enum class connection_status
     // Connection has been handed to the user
     in_use,
 
-    // After cancel
+    // Connection exceeded its max lifetime and is being closed, to be re-established afterwards
+    recycle_in_progress,
+
+    // Connection exceeded its idle timeout and is being closed, to be removed from the pool.
+    // This status doesn't count as pending, since the connection won't become idle again
+    close_in_progress,
+
+    // After cancel, or after closing the connection because it exceeded its idle timeout
     terminated,
 };
 
@@ -67,6 +74,9 @@ enum class next_connection_action
 
     // Issue a ping
     ping,
+
+    // Issue a close
+    close,
 };
 
 // A collection_state represents the possibility that a connection
@@ -83,17 +93,34 @@ enum class collection_state
     needs_collect_with_reset
 };
 
+// Whether a connection has been alive or idle for too long
+enum class connection_expiry
+{
+    // The connection is within its limits
+    none,
+
+    // The connection has been idle for longer than the idle timeout, and the pool
+    // has more connections than required
+    idle_timeout,
+
+    // The connection has been alive for longer than its max lifetime
+    max_lifetime,
+};
+
 // CRTP. Derived should implement the entering_xxx and exiting_xxx hook functions.
 // Derived must derive from this class
 template <class Derived>
 class sansio_connection_node
 {
     connection_status status_;
+    bool reset_after_connect_;
+    bool reset_follows_connect_{false};  // Is the current reset part of connection establishment?
 
     inline bool is_pending(connection_status status) noexcept
     {
         return status != connection_status::initial && status != connection_status::idle &&
-               status != connection_status::in_use && status != connection_status::terminated;
+               status != connection_status::in_use && status != connection_status::close_in_progress &&
+               status != connection_status::terminated;
     }
 
     inline static next_connection_action status_to_action(connection_status status) noexcept
@@ -105,6 +132,8 @@ class sansio_connection_node
             return next_connection_action::sleep_connect_failed;
         case connection_status::ping_in_progress: return next_connection_action::ping;
         case connection_status::reset_in_progress: return next_connection_action::reset;
+        case connection_status::recycle_in_progress:
+        case connection_status::close_in_progress: return next_connection_action::close;
         case connection_status::idle:
         case connection_status::in_use: return next_connection_action::idle_wait;
         default: return next_connection_action::none;
@@ -134,8 +163,13 @@ class sansio_connection_node
     }
 
 public:
-    sansio_connection_node(connection_status initial_status = connection_status::initial) noexcept
-        : status_(initial_status)
+    // If reset_after_connect is true, a reset will be issued after every successful connect.
+    // This is required when the reset pipeline prepares statements
+    sansio_connection_node(
+        connection_status initial_status = connection_status::initial,
+        bool reset_after_connect = false
+    ) noexcept
+        : status_(initial_status), reset_after_connect_(reset_after_connect)
     {
     }
 
@@ -147,31 +181,55 @@ public:
 
     void cancel() { set_status(connection_status::terminated); }
 
-    next_connection_action resume(error_code ec, collection_state col_st)
+    // exp should reflect the connection's current expiry state. It's only taken into account
+    // when the connection is idle or has just been returned by the user
+    next_connection_action resume(
+        error_code ec,
+        collection_state col_st,
+        connection_expiry exp = connection_expiry::none
+    )
     {
         switch (status_)
         {
         case connection_status::initial: return set_status(connection_status::connect_in_progress);
         case connection_status::connect_in_progress:
-            return ec ? set_status(connection_status::sleep_connect_failed_in_progress)
-                      : set_status(connection_status::idle);
+            if (ec)
+                return set_status(connection_status::sleep_connect_failed_in_progress);
+            else if (reset_after_connect_)
+            {
+                reset_follows_connect_ = true;
+                return set_status(connection_status::reset_in_progress);
+            }
+            else
+                return set_status(connection_status::idle);
         case connection_status::sleep_connect_failed_in_progress:
             return set_status(connection_status::connect_in_progress);
         case connection_status::idle:
             // The wait finished with no interruptions, and the connection
-            // is still idle. Time to ping.
-            return set_status(connection_status::ping_in_progress);
+            // is still idle. Close it if it expired. Otherwise, time to ping.
+            if (exp == connection_expiry::max_lifetime)
+                return set_status(connection_status::recycle_in_progress);
+            else if (exp == connection_expiry::idle_timeout)
+                return set_status(connection_status::close_in_progress);
+            else
+                return set_status(connection_status::ping_in_progress);
         case connection_status::in_use:
             // If col_st != none, the user has notified us to collect the connection.
             // This happens after they return the connection to the pool.
             // Update status and continue
-            if (col_st == collection_state::needs_collect)
+            if (col_st != collection_state::none && exp == connection_expiry::max_lifetime)
+            {
+                // No need to reset connections that will be re-established
+                return set_status(connection_status::recycle_in_progress);
+            }
+            else if (col_st == collection_state::needs_collect)
             {
                 // No reset needed, we're idle
                 return set_status(connection_status::idle);
             }
             else if (col_st == collection_state::needs_collect_with_reset)
             {
+                reset_follows_connect_ = false;
                 return set_status(connection_status::reset_in_progress);
             }
             else
@@ -181,15 +239,35 @@ public:
                 return next_connection_action::idle_wait;
             }
         case connection_status::ping_in_progress:
-        case connection_status::reset_in_progress:
             // Reconnect if there was an error. Otherwise, we're idle
             return ec ? set_status(connection_status::connect_in_progress)
                       : set_status(connection_status::idle);
+        case connection_status::reset_in_progress:
+            // If the reset was part of connection establishment, it failed as a connect would.
+            // Sleep before retrying, or errors in the reset pipeline would cause a tight reconnection loop
+            if (ec && reset_follows_connect_)
+                return set_status(connection_status::sleep_connect_failed_in_progress);
+            return ec ? set_status(connection_status::connect_in_progress)
+                      : set_status(connection_status::idle);
+        case connection_status::recycle_in_progress:
+            // Errors closing are ignored, since the connection is re-established anyway
+            return set_status(connection_status::connect_in_progress);
+        case connection_status::close_in_progress:
+            // Errors closing are ignored. We're done
+            set_status(connection_status::terminated);
+            return next_connection_action::none;
         case connection_status::terminated:
         default: return next_connection_action::none;
         }
     }
 
+    // Whether the reset in progress is part of connection establishment.
+    // Errors in such resets should be reported as connect errors
+    bool reset_follows_connect() const noexcept
+    {
+        return status_ == connection_status::reset_in_progress && reset_follows_connect_;
+    }
+
     // Exposed for testing
     connection_status status() const noexcept { return status_; }
 };
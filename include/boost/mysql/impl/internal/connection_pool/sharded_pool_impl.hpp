@@ -0,0 +1,226 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_CONNECTION_POOL_SHARDED_POOL_IMPL_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_CONNECTION_POOL_SHARDED_POOL_IMPL_HPP
+
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/pool_params.hpp>
+#include <boost/mysql/pool_stats.hpp>
+
+#include <boost/mysql/impl/internal/connection_pool/connection_pool_impl.hpp>
+#include <boost/mysql/impl/internal/connection_pool/internal_pool_params.hpp>
+#include <boost/mysql/impl/internal/connection_pool/wait_group.hpp>
+#include <boost/mysql/impl/internal/coroutine.hpp>
+
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/compose.hpp>
+#include <boost/asio/deferred.hpp>
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+inline void check_sharding_validity(const pool_params& params, std::size_t num_shards)
+{
+    const char* msg = nullptr;
+    if (num_shards == 0u)
+        msg = "sharded_connection_pool: num_shards must be greater than zero";
+    else if (params.max_size < num_shards)
+        msg = "sharded_connection_pool: pool_params::max_size must be greater or equal than num_shards";
+
+    if (msg != nullptr)
+    {
+        BOOST_THROW_EXCEPTION(std::invalid_argument(msg));
+    }
+}
+
+// A set of independent pools (shards), each one running within its own strand.
+// Connection requests are routed to the shard associated to the requesting thread.
+// If that shard has no idle connections, they are routed to any shard with idle connections
+// (work stealing). If no shard has idle connections, they are routed to a shard that can
+// still create connections, so the pool can grow up to its max_size.
+// Shards are selected using atomic loads only, without locks.
+// Templating on ConnectionWrapper is useful for mocking in tests.
+template <class IoTraits, class ConnectionWrapper>
+class basic_sharded_pool_impl
+    : public std::enable_shared_from_this<basic_sharded_pool_impl<IoTraits, ConnectionWrapper>>
+{
+    using this_type = basic_sharded_pool_impl<IoTraits, ConnectionWrapper>;
+    using shard_type = basic_pool_impl<IoTraits, ConnectionWrapper>;
+
+    asio::any_io_executor ex_;  // A strand, used to coordinate the shards' run operations
+    std::vector<std::shared_ptr<shard_type>> shards_;
+    wait_group wait_gp_;
+
+    std::shared_ptr<this_type> shared_from_this_wrapper()
+    {
+        // Some compilers get confused without this explicit cast
+        return static_cast<std::enable_shared_from_this<this_type>*>(this)->shared_from_this();
+    }
+
+    struct run_op
+    {
+        int resume_point_{0};
+        std::shared_ptr<this_type> obj_;
+
+        run_op(std::shared_ptr<this_type> obj) noexcept : obj_(std::move(obj)) {}
+
+        template <class Self>
+        void operator()(Self& self, error_code = {})
+        {
+            switch (resume_point_)
+            {
+            case 0:
+
+                // Ensure we run within our strand, since wait_group is not thread-safe
+                BOOST_MYSQL_YIELD(resume_point_, 1, asio::dispatch(obj_->ex_, std::move(self)))
+
+                // Run all shards
+                for (auto& shard : obj_->shards_)
+                    obj_->wait_gp_.run_task(shard->async_run(asio::deferred));
+
+                // Wait for all of them to exit. This happens after cancel() is called
+                BOOST_MYSQL_YIELD(resume_point_, 2, obj_->wait_gp_.async_wait(std::move(self)))
+
+                // Done
+                obj_.reset();
+                self.complete(error_code());
+            }
+        }
+    };
+
+public:
+    basic_sharded_pool_impl(asio::any_io_executor ex, pool_params&& params, std::size_t num_shards)
+        : ex_(asio::make_strand(ex)), wait_gp_(ex_)
+    {
+        check_sharding_validity(params, num_shards);
+        auto internal_params = make_internal_pool_params(std::move(params));
+        shards_.reserve(num_shards);
+        for (std::size_t i = 0; i < num_shards; ++i)
+        {
+            shards_.push_back(std::make_shared<shard_type>(
+                pool_executor_params::thread_safe(ex),
+                make_shard_params(internal_params, num_shards, i)
+            ));
+        }
+    }
+
+    using executor_type = asio::any_io_executor;
+
+    executor_type get_executor() { return ex_; }
+
+    std::size_t num_shards() const noexcept { return shards_.size(); }
+
+    // The shard with index home is preferred. If it has no idle connections,
+    // the first shard with idle connections is selected, instead. If there is none,
+    // the first shard below its max_size is selected. If all shards are full, home is used.
+    // Thread-safe.
+    std::size_t select_shard(std::size_t home) const noexcept
+    {
+        for (std::size_t i = 0; i < shards_.size(); ++i)
+        {
+            std::size_t idx = (home + i) % shards_.size();
+            if (shards_[idx]->num_idle_hint() > 0u)
+                return idx;
+        }
+        for (std::size_t i = 0; i < shards_.size(); ++i)
+        {
+            std::size_t idx = (home + i) % shards_.size();
+            if (shards_[idx]->has_capacity_hint())
+                return idx;
+        }
+        return home;
+    }
+
+    // Selects a shard, using the current thread's home shard. Thread-safe.
+    shard_type& select_shard() noexcept
+    {
+        std::size_t home = std::hash<std::thread::id>{}(std::this_thread::get_id()) % shards_.size();
+        return *shards_[select_shard(home)];
+    }
+
+    template <class CompletionToken>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void(error_code))
+    async_run(CompletionToken&& token)
+    {
+        return asio::async_compose<CompletionToken, void(error_code)>(
+            run_op(shared_from_this_wrapper()),
+            token,
+            ex_
+        );
+    }
+
+    template <class CompletionToken>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void(error_code, ConnectionWrapper))
+    async_get_connection(
+        std::chrono::steady_clock::duration timeout,
+        diagnostics* diag,
+        CompletionToken&& token
+    )
+    {
+        // The selected shard keeps itself alive while the operation is outstanding.
+        // Connections keep a reference to the shard that created them, so they're returned there
+        return select_shard().async_get_connection(timeout, diag, std::forward<CompletionToken>(token));
+    }
+
+    // Thread-safe. Adds the stats of all shards
+    pool_stats stats() const noexcept
+    {
+        pool_stats res;
+        for (const auto& shard : shards_)
+        {
+            pool_stats st = shard->stats();
+            res.num_connections += st.num_connections;
+            res.num_idle += st.num_idle;
+            res.num_in_use += st.num_in_use;
+            res.num_pending += st.num_pending;
+            res.num_waiting_requests += st.num_waiting_requests;
+            res.total_checkouts += st.total_checkouts;
+            res.total_checkout_timeouts += st.total_checkout_timeouts;
+            res.total_checkout_wait_time += st.total_checkout_wait_time;
+            res.total_connects += st.total_connects;
+            res.total_connect_errors += st.total_connect_errors;
+            res.total_resets += st.total_resets;
+            res.total_reset_errors += st.total_reset_errors;
+            res.total_skipped_resets += st.total_skipped_resets;
+            res.total_reset_time += st.total_reset_time;
+        }
+        return res;
+    }
+
+    // Thread-safe
+    void cancel()
+    {
+        for (auto& shard : shards_)
+        {
+            std::shared_ptr<shard_type> shard_ptr = shard;
+            asio::dispatch(shard->get_executor(), [shard_ptr]() { shard_ptr->cancel_unsafe(); });
+        }
+    }
+
+    // Exposed for testing
+    shard_type& shard(std::size_t idx) noexcept { return *shards_[idx]; }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -13,6 +13,7 @@
 #include <boost/intrusive/list_hook.hpp>
 
 #include <cstddef>
+#include <memory>
 
 namespace boost {
 namespace mysql {
@@ -50,6 +51,53 @@ public:
     std::size_t size() const noexcept { return requests_.size(); }
 };
 
+// A free list of timer blocks. Requests waiting for a connection need a timer block.
+// Recycling them avoids allocating when the pool is exhausted, which is when allocations are most expensive.
+// Free blocks are linked using the same hook as timer_list, since a block is never in both lists.
+// At most max_free blocks are kept, so memory is returned after spikes of waiting requests.
+template <class TimerType>
+class timer_block_pool
+{
+    using block_type = timer_block<TimerType>;
+
+    intrusive::list<block_type, intrusive::constant_time_size<false>> free_;
+    std::size_t num_free_{0};
+    std::size_t max_free_;
+
+public:
+    explicit timer_block_pool(std::size_t max_free) noexcept : max_free_(max_free) {}
+    timer_block_pool(const timer_block_pool&) = delete;
+    timer_block_pool& operator=(const timer_block_pool&) = delete;
+    ~timer_block_pool() { free_.clear_and_dispose(std::default_delete<block_type>()); }
+
+    // Returns a free block, or allocates a new one if there is none.
+    // ex should be the same for all calls
+    std::unique_ptr<block_type> acquire(asio::any_io_executor ex)
+    {
+        if (free_.empty())
+            return std::unique_ptr<block_type>(new block_type(std::move(ex)));
+        block_type& res = free_.front();
+        free_.pop_front();
+        --num_free_;
+        return std::unique_ptr<block_type>(&res);
+    }
+
+    // Removes the block from any timer_list it's in and makes it available for reuse.
+    // If the free list is full, the block is deallocated, instead.
+    // The block's timer must not have outstanding waits
+    void release(std::unique_ptr<block_type> blk) noexcept
+    {
+        blk->unlink();
+        if (num_free_ < max_free_)
+        {
+            free_.push_back(*blk.release());
+            ++num_free_;
+        }
+    }
+
+    std::size_t size() const noexcept { return num_free_; }
+};
+
 }  // namespace detail
 }  // namespace mysql
 }  // namespace boost
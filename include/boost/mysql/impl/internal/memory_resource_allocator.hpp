@@ -0,0 +1,76 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_MEMORY_RESOURCE_ALLOCATOR_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_MEMORY_RESOURCE_ALLOCATOR_HPP
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// A minimal allocator that gets memory from a memory_resource, if one was provided,
+// and from std::allocator otherwise. We don't use container::pmr::polymorphic_allocator
+// because it falls back to Boost.Container's default resource, rather than to std::allocator.
+template <class T>
+class memory_resource_allocator
+{
+    container::pmr::memory_resource* res_{};
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    memory_resource_allocator() = default;
+    explicit memory_resource_allocator(container::pmr::memory_resource* res) noexcept : res_(res) {}
+
+    template <class U>
+    memory_resource_allocator(const memory_resource_allocator<U>& other) noexcept : res_(other.resource())
+    {
+    }
+
+    container::pmr::memory_resource* resource() const noexcept { return res_; }
+
+    T* allocate(std::size_t n)
+    {
+        return res_ ? static_cast<T*>(res_->allocate(n * sizeof(T), alignof(T)))
+                    : std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        if (res_)
+            res_->deallocate(p, n * sizeof(T), alignof(T));
+        else
+            std::allocator<T>().deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const memory_resource_allocator<U>& rhs) const noexcept
+    {
+        return res_ == rhs.resource() || (res_ && rhs.resource() && res_->is_equal(*rhs.resource()));
+    }
+
+    template <class U>
+    bool operator!=(const memory_resource_allocator<U>& rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -45,9 +45,19 @@ BOOST_INLINE_CONSTEXPR std::uint32_t CLIENT_SESSION_TRACK = (1UL << 23); // Capa
 BOOST_INLINE_CONSTEXPR std::uint32_t CLIENT_DEPRECATE_EOF = (1UL << 24); // Client no longer needs EOF_Packet and will use OK_Packet instead
 BOOST_INLINE_CONSTEXPR std::uint32_t CLIENT_SSL_VERIFY_SERVER_CERT = (1UL << 30); // Verify server certificate
 BOOST_INLINE_CONSTEXPR std::uint32_t CLIENT_OPTIONAL_RESULTSET_METADATA = (1UL << 25); // The client can handle optional metadata information in the resultset
+BOOST_INLINE_CONSTEXPR std::uint32_t CLIENT_ZSTD_COMPRESSION_ALGORITHM = (1UL << 26); // Compression protocol extended to support zstd (MySQL only)
 BOOST_INLINE_CONSTEXPR std::uint32_t CLIENT_REMEMBER_OPTIONS = (1UL << 31); // Don't reset the options after an unsuccessful connect
 // clang-format on
 
+// MariaDB extended capabilities. These are the upper 32 bits of MariaDB's 64-bit capabilities,
+// sent in the reserved bytes of the server hello and the login request. They're only
+// exchanged if CLIENT_LONG_PASSWORD is not set by both parties (MariaDB servers don't set it)
+// clang-format off
+BOOST_INLINE_CONSTEXPR std::uint32_t MARIADB_CLIENT_PROGRESS = 1; // Client supports progress indicator
+BOOST_INLINE_CONSTEXPR std::uint32_t MARIADB_CLIENT_COM_MULTI = 2; // Unused
+BOOST_INLINE_CONSTEXPR std::uint32_t MARIADB_CLIENT_STMT_BULK_OPERATIONS = 4; // Support COM_STMT_BULK_EXECUTE
+// clang-format on
+
 class capabilities
 {
     std::uint32_t value_;
@@ -79,9 +89,9 @@ public:
  * CLIENT_LONG_FLAG: unset //  Get all column flags
  * CLIENT_CONNECT_WITH_DB: optional //  Database (schema) name can be specified on connect in
  * Handshake Response Packet CLIENT_NO_SCHEMA: unset //  Don't allow database.table.column
- * CLIENT_COMPRESS: unset //  Compression protocol supported
+ * CLIENT_COMPRESS: optional //  Compression protocol supported
  * CLIENT_ODBC: unset //  Special handling of ODBC behavior
- * CLIENT_LOCAL_FILES: unset //  Can use LOAD DATA LOCAL
+ * CLIENT_LOCAL_FILES: optional //  Can use LOAD DATA LOCAL
  * CLIENT_IGNORE_SPACE: unset //  Ignore spaces before '('
  * CLIENT_PROTOCOL_41: mandatory //  New 4.1 protocol
  * CLIENT_INTERACTIVE: unset //  This is an interactive client
@@ -97,11 +107,12 @@ public:
  * CLIENT_CONNECT_ATTRS: unset //  Client supports connection attributes
  * CLIENT_PLUGIN_AUTH_LENENC_CLIENT_DATA: mandatory //  Enable authentication response packet to be
  * larger than 255 bytes CLIENT_CAN_HANDLE_EXPIRED_PASSWORDS: unset //  Don't close the connection
- * for a user account with expired password CLIENT_SESSION_TRACK: unset //  Capable of handling
+ * for a user account with expired password CLIENT_SESSION_TRACK: optional //  Capable of handling
  * server state change information CLIENT_DEPRECATE_EOF: mandatory //  Client no longer needs
  * EOF_Packet and will use OK_Packet instead CLIENT_SSL_VERIFY_SERVER_CERT: unset //  Verify server
  * certificate CLIENT_OPTIONAL_RESULTSET_METADATA: unset //  The client can handle optional metadata
- * information in the resultset CLIENT_REMEMBER_OPTIONS: unset //  Don't reset the options after an
+ * information in the resultset CLIENT_ZSTD_COMPRESSION_ALGORITHM: optional //  Compression protocol
+ * extended to support zstd CLIENT_REMEMBER_OPTIONS: unset //  Don't reset the options after an
  * unsuccessful connect
  *
  * We pay attention to:
@@ -111,6 +122,14 @@ public:
  * mandatory //  Enable authentication response packet to be larger than 255 bytes
  * CLIENT_DEPRECATE_EOF: mandatory //  Client no longer needs EOF_Packet and will use OK_Packet
  * instead
+ * CLIENT_COMPRESS, CLIENT_ZSTD_COMPRESSION_ALGORITHM: optional // Requested if the user enabled
+ * compression. At most one of them is set
+ * CLIENT_LOCAL_FILES: optional // File contents are supplied by a user-provided handler, never read from
+ * disk. If no handler is set, requests are rejected
+ * CLIENT_SESSION_TRACK: optional // Requested by every connection, regardless of whether it belongs
+ * to a pool using lazy resets. Session state change flags and information in OK packets are parsed
+ * and exposed to the user (results::session_track). Servers only send tracking information
+ * for the session_track_xxx system variables that are enabled, none by default in MySQL
  */
 
 // clang-format off
@@ -123,7 +142,13 @@ BOOST_INLINE_CONSTEXPR capabilities mandatory_capabilities{
 };
 // clang-format on
 
-BOOST_INLINE_CONSTEXPR capabilities optional_capabilities{CLIENT_MULTI_RESULTS | CLIENT_PS_MULTI_RESULTS};
+BOOST_INLINE_CONSTEXPR capabilities optional_capabilities{
+    CLIENT_MULTI_RESULTS | CLIENT_PS_MULTI_RESULTS | CLIENT_SESSION_TRACK | CLIENT_LOCAL_FILES
+};
+
+// MariaDB extended capabilities we request, if the server supports them.
+// MARIADB_CLIENT_STMT_BULK_OPERATIONS is used to execute statement batches
+BOOST_INLINE_CONSTEXPR std::uint32_t mariadb_optional_ext_capabilities = MARIADB_CLIENT_STMT_BULK_OPERATIONS;
 
 }  // namespace detail
 }  // namespace mysql
@@ -0,0 +1,352 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_PROTOCOL_COMPRESSION_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_PROTOCOL_COMPRESSION_HPP
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/compression_algorithm.hpp>
+#include <boost/mysql/defaults.hpp>
+#include <boost/mysql/error_code.hpp>
+
+#include <boost/mysql/impl/internal/protocol/capabilities.hpp>
+#include <boost/mysql/impl/internal/protocol/frame_header.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/core/span.hpp>
+#include <boost/endian/conversion.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifdef BOOST_MYSQL_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef BOOST_MYSQL_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+// The compressed protocol wraps the regular protocol frames into compressed frames.
+// Compressed frames have a 7 byte header, followed by the (maybe) compressed payload.
+// A compressed frame may contain several regular frames, and a regular frame
+// may be split between several compressed frames.
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+BOOST_INLINE_CONSTEXPR std::size_t compressed_frame_header_size = 7;
+
+// The level used to compress with zstd. Sent to the server during the handshake
+BOOST_INLINE_CONSTEXPR std::uint8_t zstd_compression_level = 3;
+
+struct compressed_frame_header
+{
+    std::uint32_t compressed_size;    // payload size, as transmitted
+    std::uint8_t sequence_number;     // compressed sequence number, independent of the regular one
+    std::uint32_t uncompressed_size;  // payload size after decompressing, or 0 if not compressed
+};
+
+inline void serialize_compressed_frame_header(
+    span<std::uint8_t, compressed_frame_header_size> to,
+    compressed_frame_header header
+)
+{
+    BOOST_ASSERT(header.compressed_size <= 0xffffff);
+    BOOST_ASSERT(header.uncompressed_size <= 0xffffff);
+    endian::store_little_u24(to.data(), header.compressed_size);
+    to[3] = header.sequence_number;
+    endian::store_little_u24(to.data() + 4, header.uncompressed_size);
+}
+
+inline compressed_frame_header deserialize_compressed_frame_header(
+    span<const std::uint8_t, compressed_frame_header_size> buffer
+)
+{
+    return {
+        endian::load_little_u24(buffer.data()),
+        buffer[3],
+        endian::load_little_u24(buffer.data() + 4),
+    };
+}
+
+// Compressed sequence numbers are independent from the regular ones. As the server does,
+// a single counter is shared by reads and writes, and every command (a message whose first
+// regular frame has sequence number 0) restarts it. The response to a command continues the count.
+// Pipelines write several commands at once, so we record where each response should start.
+class compressed_seqnum_tracker
+{
+    std::uint8_t next_{0};               // the next sequence number to read or write
+    std::vector<std::uint8_t> pending_;  // first sequence number of the responses after the current one
+
+public:
+    void reset()
+    {
+        next_ = 0;
+        pending_.clear();
+    }
+
+    // Writing. Call begin_message() before serializing each message, next_write() for every
+    // compressed frame it requires, end_message() after it and end_write() once all messages are done
+    void begin_message(bool is_command) noexcept
+    {
+        if (is_command)
+            next_ = 0;
+    }
+
+    std::uint8_t next_write() noexcept { return next_++; }
+
+    void end_message(bool is_command)
+    {
+        if (is_command)
+            pending_.push_back(next_);
+    }
+
+    void end_write()
+    {
+        if (!pending_.empty())
+        {
+            next_ = pending_.front();
+            pending_.erase(pending_.begin());
+        }
+    }
+
+    // Reading. Returns false if seqnum is not the expected one
+    bool check_read(std::uint8_t seqnum)
+    {
+        if (seqnum != next_)
+        {
+            // It may be the first frame of the next response in a pipeline
+            if (pending_.empty() || seqnum != pending_.front())
+                return false;
+            pending_.erase(pending_.begin());
+        }
+        next_ = static_cast<std::uint8_t>(seqnum + 1u);
+        return true;
+    }
+};
+
+// The size of a compressed frame's payload, after decompressing it
+inline std::size_t get_uncompressed_size(compressed_frame_header header) noexcept
+{
+    return header.uncompressed_size ? header.uncompressed_size : header.compressed_size;
+}
+
+// Was the library built with support for this algorithm?
+inline bool is_compression_supported(compression_algorithm algo) noexcept
+{
+    switch (algo)
+    {
+#ifdef BOOST_MYSQL_HAS_ZLIB
+    case compression_algorithm::zlib: return true;
+#endif
+#ifdef BOOST_MYSQL_HAS_ZSTD
+    case compression_algorithm::zstd: return true;
+#endif
+    default: return false;
+    }
+}
+
+// The capability to request to the server to use an algorithm, if supported
+inline capabilities get_compression_capability(compression_algorithm algo) noexcept
+{
+    if (!is_compression_supported(algo))
+        return capabilities();
+    switch (algo)
+    {
+    case compression_algorithm::zlib: return capabilities(CLIENT_COMPRESS);
+    case compression_algorithm::zstd: return capabilities(CLIENT_ZSTD_COMPRESSION_ALGORITHM);
+    default: return capabilities();
+    }
+}
+
+// The algorithm to use, given the negotiated capabilities
+inline compression_algorithm get_compression_algorithm(capabilities caps) noexcept
+{
+    if (caps.has(CLIENT_ZSTD_COMPRESSION_ALGORITHM))
+        return compression_algorithm::zstd;
+    else if (caps.has(CLIENT_COMPRESS))
+        return compression_algorithm::zlib;
+    else
+        return compression_algorithm::none;
+}
+
+// Compresses input, appending the result to to. Returns false and leaves to
+// unchanged if compression failed or the algorithm is not supported
+inline bool compress_payload(
+    compression_algorithm algo,
+    span<const std::uint8_t> input,
+    std::vector<std::uint8_t>& to
+)
+{
+    std::size_t offset = to.size();
+    switch (algo)
+    {
+#ifdef BOOST_MYSQL_HAS_ZLIB
+    case compression_algorithm::zlib:
+    {
+        uLongf size = ::compressBound(static_cast<uLong>(input.size()));
+        to.resize(offset + size);
+        if (::compress(to.data() + offset, &size, input.data(), static_cast<uLong>(input.size())) == Z_OK)
+        {
+            to.resize(offset + size);
+            return true;
+        }
+        break;
+    }
+#endif
+#ifdef BOOST_MYSQL_HAS_ZSTD
+    case compression_algorithm::zstd:
+    {
+        std::size_t bound = ::ZSTD_compressBound(input.size());
+        to.resize(offset + bound);
+        std::size_t size = ::ZSTD_compress(
+            to.data() + offset,
+            bound,
+            input.data(),
+            input.size(),
+            zstd_compression_level
+        );
+        if (!::ZSTD_isError(size))
+        {
+            to.resize(offset + size);
+            return true;
+        }
+        break;
+    }
+#endif
+    default: break;
+    }
+    to.resize(offset);
+    return false;
+}
+
+// Decompresses input into output, which must be exactly as big as the uncompressed data
+inline error_code decompress_payload(
+    compression_algorithm algo,
+    span<const std::uint8_t> input,
+    span<std::uint8_t> output
+)
+{
+    switch (algo)
+    {
+#ifdef BOOST_MYSQL_HAS_ZLIB
+    case compression_algorithm::zlib:
+    {
+        uLongf size = static_cast<uLongf>(output.size());
+        if (::uncompress(output.data(), &size, input.data(), static_cast<uLong>(input.size())) == Z_OK &&
+            size == output.size())
+            return error_code();
+        break;
+    }
+#endif
+#ifdef BOOST_MYSQL_HAS_ZSTD
+    case compression_algorithm::zstd:
+    {
+        std::size_t size = ::ZSTD_decompress(output.data(), output.size(), input.data(), input.size());
+        if (!::ZSTD_isError(size) && size == output.size())
+            return error_code();
+        break;
+    }
+#endif
+    default: break;
+    }
+    return client_errc::protocol_value_error;
+}
+
+// Appends a single compressed frame to to
+inline void serialize_compressed_frame(
+    compression_algorithm algo,
+    std::size_t threshold,
+    span<const std::uint8_t> chunk,
+    std::uint8_t seqnum,
+    std::vector<std::uint8_t>& to
+)
+{
+    BOOST_ASSERT(chunk.size() <= max_packet_size);
+
+    // Leave space for the header
+    std::size_t header_offset = to.size();
+    to.resize(header_offset + compressed_frame_header_size);
+
+    // Compress. Payloads that are too small or don't shrink are sent uncompressed
+    compressed_frame_header header{static_cast<std::uint32_t>(chunk.size()), seqnum, 0u};
+    if (chunk.size() >= threshold && compress_payload(algo, chunk, to))
+    {
+        std::size_t compressed_size = to.size() - header_offset - compressed_frame_header_size;
+        if (compressed_size < chunk.size())
+        {
+            header.compressed_size = static_cast<std::uint32_t>(compressed_size);
+            header.uncompressed_size = static_cast<std::uint32_t>(chunk.size());
+        }
+        else
+        {
+            to.resize(header_offset + compressed_frame_header_size);
+        }
+    }
+    if (header.uncompressed_size == 0u)
+        to.insert(to.end(), chunk.begin(), chunk.end());
+
+    span<std::uint8_t, compressed_frame_header_size> header_buff(
+        to.data() + header_offset,
+        compressed_frame_header_size
+    );
+    serialize_compressed_frame_header(header_buff, header);
+}
+
+// Wraps a sequence of regular frames (as produced by serialize_top_level) into compressed
+// frames, appending them to to. Each message is compressed independently, so
+// pipelined requests reach the server as independent compressed frames.
+// Compressed sequence numbers are assigned by seqnums.
+inline void serialize_compressed_frames(
+    compression_algorithm algo,
+    std::size_t threshold,
+    span<const std::uint8_t> frames,
+    compressed_seqnum_tracker& seqnums,
+    std::vector<std::uint8_t>& to,
+    std::size_t max_frame_size = max_packet_size
+)
+{
+    std::size_t message_first = 0u;
+    std::size_t offset = 0u;
+    while (offset < frames.size())
+    {
+        // Find the end of the current message
+        BOOST_ASSERT(frames.size() - offset >= frame_header_size);
+        auto header = deserialize_frame_header(
+            span<const std::uint8_t, frame_header_size>(frames.data() + offset, frame_header_size)
+        );
+        offset += frame_header_size + header.size;
+        BOOST_ASSERT(offset <= frames.size());
+        if (header.size == max_frame_size)
+            continue;
+
+        // Compress it, in chunks that fit in a compressed frame
+        bool is_command = frames[message_first + 3] == 0u;
+        auto message = frames.subspan(message_first, offset - message_first);
+        seqnums.begin_message(is_command);
+        while (!message.empty())
+        {
+            std::size_t chunk_size = (std::min)(message.size(), max_packet_size);
+            serialize_compressed_frame(algo, threshold, message.first(chunk_size), seqnums.next_write(), to);
+            message = message.subspan(chunk_size);
+        }
+        seqnums.end_message(is_command);
+        message_first = offset;
+    }
+    seqnums.end_write();
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -69,7 +69,15 @@ BOOST_ATTRIBUTE_NODISCARD inline error_code process_error_packet(
 
 // Deserializes a response that may be an OK or an error packet.
 // Applicable for commands like ping and reset connection.
-// If the response is an OK packet, sets backslash_escapes according to the
+// If the response is an OK packet, it's stored in ok
+BOOST_ATTRIBUTE_NODISCARD inline error_code deserialize_ok_response(
+    span<const std::uint8_t> message,
+    db_flavor flavor,
+    diagnostics& diag,
+    ok_view& ok
+);
+
+// Same as the above, but only sets backslash_escapes according to the
 // OK packet's server status flags
 BOOST_ATTRIBUTE_NODISCARD inline error_code deserialize_ok_response(
     span<const std::uint8_t> message,
@@ -126,6 +134,10 @@ struct execute_response
     execute_response(const ok_view& v) noexcept : type(type_t::ok_packet), data(v) {}
     execute_response(error_code v) noexcept : type(type_t::error), data(v) {}
 };
+
+// LOAD DATA LOCAL INFILE requests. May be sent by the server instead of an execute_response.
+// Returns true if msg is a request, and sets file_name to the requested file
+inline bool deserialize_local_infile_request(span<const std::uint8_t> msg, string_view& file_name);
 inline execute_response deserialize_execute_response(
     span<const std::uint8_t> msg,
     db_flavor flavor,
@@ -164,6 +176,16 @@ inline error_code deserialize_row(
     span<field_view> output  // Should point to meta.size() field_view objects
 );
 
+// Deserializes a row, invoking fn(index, field_view) for each field, in the order
+// they appear in the message. Avoids requiring storage for the entire row.
+template <class FieldFn>
+error_code deserialize_row_fields(
+    resultset_encoding encoding,
+    span<const std::uint8_t> message,
+    metadata_collection_view meta,
+    FieldFn&& fn
+);
+
 // Server hello
 struct server_hello
 {
@@ -171,6 +193,7 @@ struct server_hello
     db_flavor server;
     auth_buffer_type auth_plugin_data;
     capabilities server_capabilities{};
+    std::uint32_t mariadb_ext_capabilities{};  // zero if the server is not MariaDB
     string_view auth_plugin_name;
 };
 BOOST_ATTRIBUTE_NODISCARD inline error_code deserialize_server_hello_impl(
@@ -257,6 +280,7 @@ namespace detail {
 // Constants
 BOOST_INLINE_CONSTEXPR std::uint8_t error_packet_header = 0xff;
 BOOST_INLINE_CONSTEXPR std::uint8_t ok_packet_header = 0x00;
+BOOST_INLINE_CONSTEXPR std::uint8_t local_infile_request_header = 0xfb;
 
 }  // namespace detail
 }  // namespace mysql
@@ -279,8 +303,8 @@ boost::mysql::error_code boost::mysql::detail::deserialize_ok_packet(
         int_lenenc last_insert_id;
         int2 status_flags;  // server_status_flags
         int2 warnings;
-        // CLIENT_SESSION_TRACK: not implemented
         string_lenenc info;
+        string_lenenc session_state_info;  // CLIENT_SESSION_TRACK, only if status_flags has the flag set
     } pack{};
 
     deserialization_context ctx(msg);
@@ -295,12 +319,22 @@ boost::mysql::error_code boost::mysql::detail::deserialize_ok_packet(
             return to_error_code(err);
     }
 
+    if ((pack.status_flags.value & status_flags::session_state_changed) && ctx.enough_size(1))
+    {
+        // Session state information is sent if CLIENT_SESSION_TRACK was negotiated
+        // and the server has session state changes to report. It's parsed on demand
+        err = pack.session_state_info.deserialize(ctx);
+        if (err != deserialize_errc::ok)
+            return to_error_code(err);
+    }
+
     output = {
         pack.affected_rows.value,
         pack.last_insert_id.value,
         pack.status_flags.value,
         pack.warnings.value,
         pack.info.value,
+        pack.session_state_info.value,
     };
 
     return ctx.check_extra_bytes();
@@ -459,7 +493,7 @@ boost::mysql::error_code boost::mysql::detail::deserialize_ok_response(
     span<const std::uint8_t> message,
     db_flavor flavor,
     diagnostics& diag,
-    bool& backslash_escapes
+    ok_view& ok
 )
 {
     // Header
@@ -472,12 +506,7 @@ boost::mysql::error_code boost::mysql::detail::deserialize_ok_response(
     if (header.value == ok_packet_header)
     {
         // Verify that the ok_packet is correct
-        ok_view ok{};
-        err = deserialize_ok_packet(ctx.to_span(), ok);
-        if (err)
-            return err;
-        backslash_escapes = ok.backslash_escapes();
-        return error_code();
+        return deserialize_ok_packet(ctx.to_span(), ok);
     }
     else if (header.value == error_packet_header)
     {
@@ -491,6 +520,20 @@ boost::mysql::error_code boost::mysql::detail::deserialize_ok_response(
     }
 }
 
+boost::mysql::error_code boost::mysql::detail::deserialize_ok_response(
+    span<const std::uint8_t> message,
+    db_flavor flavor,
+    diagnostics& diag,
+    bool& backslash_escapes
+)
+{
+    ok_view ok{};
+    auto err = deserialize_ok_response(message, flavor, diag, ok);
+    if (!err)
+        backslash_escapes = ok.backslash_escapes();
+    return err;
+}
+
 boost::mysql::error_code boost::mysql::detail::deserialize_prepare_stmt_response_impl(
     span<const std::uint8_t> message,
     prepare_stmt_response& output
@@ -562,7 +605,7 @@ boost::mysql::detail::execute_response boost::mysql::detail::deserialize_execute
     diagnostics& diag
 )
 {
-    // Response may be: ok_packet, err_packet, local infile request (not implemented)
+    // Response may be: ok_packet, err_packet, local infile request (handled separately)
     // If it is none of this, then the message type itself is the beginning of
     // a length-encoded int containing the field count
     deserialization_context ctx(msg);
@@ -609,6 +652,19 @@ boost::mysql::detail::execute_response boost::mysql::detail::deserialize_execute
     }
 }
 
+// local infile request
+bool boost::mysql::detail::deserialize_local_infile_request(
+    span<const std::uint8_t> msg,
+    string_view& file_name
+)
+{
+    // Message type, followed by the file name, up to the end of the message
+    if (msg.empty() || msg[0] != local_infile_request_header)
+        return false;
+    file_name = string_view(reinterpret_cast<const char*>(msg.data() + 1), msg.size() - 1);
+    return true;
+}
+
 boost::mysql::detail::row_message boost::mysql::detail::deserialize_row_message(
     span<const std::uint8_t> msg,
     db_flavor flavor,
@@ -660,18 +716,15 @@ inline bool is_next_field_null(const deserialization_context& ctx)
     return *ctx.first() == 0xfb;
 }
 
-inline error_code deserialize_text_row(
-    deserialization_context& ctx,
-    metadata_collection_view meta,
-    field_view* output
-)
+template <class FieldFn>
+error_code deserialize_text_row(deserialization_context& ctx, metadata_collection_view meta, FieldFn& fn)
 {
     for (std::vector<field_view>::size_type i = 0; i < meta.size(); ++i)
     {
         if (is_next_field_null(ctx))
         {
             ctx.advance(1);
-            output[i] = field_view(nullptr);
+            fn(i, field_view(nullptr));
         }
         else
         {
@@ -679,19 +732,18 @@ inline error_code deserialize_text_row(
             auto err = value_str.deserialize(ctx);
             if (err != deserialize_errc::ok)
                 return to_error_code(err);
-            err = deserialize_text_field(value_str.value, meta[i], output[i]);
+            field_view value;
+            err = deserialize_text_field(value_str.value, meta[i], value);
             if (err != deserialize_errc::ok)
                 return to_error_code(err);
+            fn(i, value);
         }
     }
     return ctx.check_extra_bytes();
 }
 
-inline error_code deserialize_binary_row(
-    deserialization_context& ctx,
-    metadata_collection_view meta,
-    field_view* output
-)
+template <class FieldFn>
+error_code deserialize_binary_row(deserialization_context& ctx, metadata_collection_view meta, FieldFn& fn)
 {
     // Skip packet header (it is not part of the message in the binary
     // protocol but it is in the text protocol, so we include it for homogeneity)
@@ -715,13 +767,15 @@ inline error_code deserialize_binary_row(
     {
         if (null_bitmap.is_null(null_bitmap_first, i))
         {
-            output[i] = field_view(nullptr);
+            fn(i, field_view(nullptr));
         }
         else
         {
-            auto err = deserialize_binary_field(ctx, meta[i], output[i]);
+            field_view value;
+            auto err = deserialize_binary_field(ctx, meta[i], value);
             if (err != deserialize_errc::ok)
                 return to_error_code(err);
+            fn(i, value);
         }
     }
 
@@ -729,6 +783,14 @@ inline error_code deserialize_binary_row(
     return ctx.check_extra_bytes();
 }
 
+// Stores fields into an array of field_views
+struct field_array_writer
+{
+    field_view* output;
+
+    void operator()(std::size_t index, field_view value) const noexcept { output[index] = value; }
+};
+
 }  // namespace detail
 }  // namespace mysql
 }  // namespace boost
@@ -741,9 +803,20 @@ boost::mysql::error_code boost::mysql::detail::deserialize_row(
 )
 {
     BOOST_ASSERT(meta.size() == output.size());
+    return deserialize_row_fields(encoding, buff, meta, field_array_writer{output.data()});
+}
+
+template <class FieldFn>
+boost::mysql::error_code boost::mysql::detail::deserialize_row_fields(
+    resultset_encoding encoding,
+    span<const std::uint8_t> buff,
+    metadata_collection_view meta,
+    FieldFn&& fn
+)
+{
     deserialization_context ctx(buff);
-    return encoding == detail::resultset_encoding::text ? deserialize_text_row(ctx, meta, output.data())
-                                                        : deserialize_binary_row(ctx, meta, output.data());
+    return encoding == detail::resultset_encoding::text ? deserialize_text_row(ctx, meta, fn)
+                                                        : deserialize_binary_row(ctx, meta, fn);
 }
 
 // Server hello
@@ -838,6 +911,15 @@ boost::mysql::error_code boost::mysql::detail::deserialize_server_hello_impl(
     output.server_capabilities = cap;
     output.auth_plugin_name = pack.auth_plugin_name.value;
 
+    // MariaDB servers don't set CLIENT_LONG_PASSWORD, and send their extended
+    // capabilities in the last 4 bytes of the reserved field
+    if (!cap.has(CLIENT_LONG_PASSWORD))
+    {
+        std::uint32_t ext_caps = 0;
+        memcpy(&ext_caps, pack.reserved.value.data() + 6, 4);
+        output.mariadb_ext_capabilities = boost::endian::little_to_native(ext_caps);
+    }
+
     // Compose auth_plugin_data
     output.auth_plugin_data.clear();
     output.auth_plugin_data.append(
@@ -23,9 +23,11 @@
 
 #include <boost/assert.hpp>
 #include <boost/charconv/from_chars.hpp>
+#include <boost/endian/conversion.hpp>
 
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <system_error>
@@ -52,16 +54,94 @@ namespace detail {
 BOOST_INLINE_CONSTEXPR unsigned max_decimals = 6u;
 BOOST_INLINE_CONSTEXPR unsigned time_max_hour = 838;
 
-// Integers
+// Integers. Most integers in text resultsets are short, plain sequences of digits.
+// These are parsed by a fast path that processes 8 digits at a time using regular 64-bit
+// arithmetic (SWAR). Anything else (signs, overflow, invalid characters) is handled by charconv.
+BOOST_INLINE_CONSTEXPR std::size_t max_fast_int_digits = 18u;  // always fits in an int64_t
+
+// Checks whether the 8 characters loaded into chunk are all decimal digits
+inline bool is_eight_digits(std::uint64_t chunk) noexcept
+{
+    return ((chunk & 0xf0f0f0f0f0f0f0f0) | (((chunk + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0) >> 4)) ==
+           0x3333333333333333;
+}
+
+// Converts 8 digit characters (as loaded by a little-endian load) to their value
+inline std::uint32_t parse_eight_digits(std::uint64_t chunk) noexcept
+{
+    constexpr std::uint64_t mask = 0x000000ff000000ff;
+    constexpr std::uint64_t mul1 = 100 + (1000000ULL << 32);
+    constexpr std::uint64_t mul2 = 1 + (10000ULL << 32);
+    chunk -= 0x3030303030303030;
+    chunk = (chunk * 10) + (chunk >> 8);  // combine pairs of digits
+    return static_cast<std::uint32_t>(((chunk & mask) * mul1 + ((chunk >> 16) & mask) * mul2) >> 32);
+}
+
+// Parses a sequence of up to max_fast_int_digits digits. Returns false if it contains
+// anything other than digits, so the caller can fall back to the general algorithm
+inline bool parse_short_digits(const char* first, std::size_t size, std::uint64_t& output) noexcept
+{
+    if (size == 0u || size > max_fast_int_digits)
+        return false;
+
+    // Leading digits that don't complete a group of 8
+    std::uint64_t res = 0;
+    const char* last = first + size;
+    for (const char* it = first; it != first + size % 8u; ++it)
+    {
+        auto digit = static_cast<unsigned char>(*it - '0');
+        if (digit > 9u)
+            return false;
+        res = res * 10u + digit;
+    }
+
+    // Groups of 8
+    for (const char* it = first + size % 8u; it != last; it += 8)
+    {
+        auto chunk = endian::endian_load<std::uint64_t, 8, endian::order::little>(
+            reinterpret_cast<const unsigned char*>(it)
+        );
+        if (!is_eight_digits(chunk))
+            return false;
+        res = res * 100000000u + parse_eight_digits(chunk);
+    }
+
+    output = res;
+    return true;
+}
+
+inline bool parse_text_int_fast(string_view from, std::uint64_t& to) noexcept
+{
+    return parse_short_digits(from.data(), from.size(), to);
+}
+
+inline bool parse_text_int_fast(string_view from, std::int64_t& to) noexcept
+{
+    bool is_negative = !from.empty() && from.front() == '-';
+    std::size_t offset = is_negative ? 1u : 0u;
+    std::uint64_t v = 0;
+    if (!parse_short_digits(from.data() + offset, from.size() - offset, v))
+        return false;
+    to = is_negative ? -static_cast<std::int64_t>(v) : static_cast<std::int64_t>(v);
+    return true;
+}
+
 template <class T>
 inline deserialize_errc deserialize_text_value_int_impl(string_view from, field_view& to)
 {
+    // Fast path
+    T v;
+    if (parse_text_int_fast(from, v))
+    {
+        to = field_view(v);
+        return deserialize_errc::ok;
+    }
+
     // Iterators
     const char* begin = from.data();
     const char* end = begin + from.size();
 
     // Convert
-    T v;
     auto res = charconv::from_chars(from.data(), from.data() + from.size(), v);
 
     // Check
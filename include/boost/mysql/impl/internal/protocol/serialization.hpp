@@ -22,6 +22,7 @@
 
 #include <boost/assert.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 
@@ -71,11 +72,85 @@ struct prepare_stmt_command
     }
 };
 
+// A statement parameter that received its value using send_long_data_command
+struct long_data_param
+{
+    std::uint32_t statement_id;
+    std::uint16_t param_index;
+};
+
 // execute statement
 struct execute_stmt_command
 {
     std::uint32_t statement_id;
     span<const field_view> params;
+    bool open_cursor;  // CURSOR_TYPE_READ_ONLY. Rows are then retrieved using fetch_stmt_command
+
+    // Parameters with long data. May contain parameters for other statements.
+    // The server already has their values, so only their types are sent
+    span<const long_data_param> long_data;
+
+    inline void serialize(serialization_context& ctx) const;
+};
+
+// MariaDB bulk execution (COM_STMT_BULK_EXECUTE). Executes a statement once per row of parameters,
+// in a single request. Requires MARIADB_CLIENT_STMT_BULK_OPERATIONS. Types are sent once,
+// so all non-NULL values of a parameter must have the same kind (see is_bulk_executable).
+// The server responds with a single OK packet, or an error
+struct bulk_execute_stmt_command
+{
+    std::uint32_t statement_id;
+    std::size_t num_params;
+    span<const field_view> params;  // row-major. Its size is a multiple of num_params
+
+    inline void serialize(serialization_context& ctx) const;
+};
+
+// The kind sent as type for a parameter in a bulk execution: the first non-NULL value's kind
+inline field_kind get_bulk_param_kind(span<const field_view> params, std::size_t num_params, std::size_t idx)
+{
+    for (std::size_t i = idx; i < params.size(); i += num_params)
+    {
+        if (!params[i].is_null())
+            return params[i].kind();
+    }
+    return field_kind::null;
+}
+
+// Can params be sent using bulk_execute_stmt_command?
+inline bool is_bulk_executable(span<const field_view> params, std::size_t num_params)
+{
+    for (std::size_t param_idx = 0; param_idx < num_params; ++param_idx)
+    {
+        field_kind kind = get_bulk_param_kind(params, num_params, param_idx);
+        for (std::size_t i = param_idx; i < params.size(); i += num_params)
+        {
+            if (!params[i].is_null() && params[i].kind() != kind)
+                return false;
+        }
+    }
+    return true;
+}
+
+// send long data. Appends data to a statement parameter's value. Doesn't have a response
+struct send_long_data_command
+{
+    std::uint32_t statement_id;
+    std::uint16_t param_index;
+    span<const std::uint8_t> data;
+
+    void serialize(serialization_context& ctx) const
+    {
+        ctx.serialize_fixed(int1{0x18}, int4{statement_id}, int2{param_index});
+        ctx.add(data);
+    }
+};
+
+// fetch rows from a cursor opened by execute_stmt_command
+struct fetch_stmt_command
+{
+    std::uint32_t statement_id;
+    std::uint32_t num_rows;
 
     inline void serialize(serialization_context& ctx) const;
 };
@@ -97,6 +172,8 @@ struct login_request
     span<const std::uint8_t> auth_response;
     string_view database;
     string_view auth_plugin_name;
+    std::uint8_t zstd_compression_level;     // only sent if CLIENT_ZSTD_COMPRESSION_ALGORITHM
+    std::uint32_t mariadb_ext_capabilities;  // sent as part of the filler
 
     inline void serialize(serialization_context& ctx) const;
 };
@@ -107,6 +184,7 @@ struct ssl_request
     capabilities negotiated_capabilities;
     std::uint32_t max_packet_size;
     std::uint32_t collation_id;
+    std::uint32_t mariadb_ext_capabilities;  // sent as part of the filler
 
     inline void serialize(serialization_context& ctx) const;
 };
@@ -220,9 +298,9 @@ void boost::mysql::detail::execute_stmt_command::serialize(serialization_context
     //      array<field_view, num_params> params;
 
     constexpr int1 command_id{0x17};
-    constexpr int1 flags{0};
     constexpr int4 iteration_count{1};
     constexpr int1 new_params_bind_flag{1};
+    const int1 flags{open_cursor ? std::uint8_t(0x01) : std::uint8_t(0x00)};  // CURSOR_TYPE_READ_ONLY or none
 
     // header
     ctx.serialize_fixed(command_id, int4{statement_id}, flags, iteration_count);
@@ -249,21 +327,85 @@ void boost::mysql::detail::execute_stmt_command::serialize(serialization_context
             ctx.serialize_fixed(int1{static_cast<std::uint8_t>(type)}, int1{unsigned_flag});
         }
 
-        // actual values
-        for (field_view param : params)
+        // actual values, except for parameters with long data
+        for (std::size_t i = 0; i < num_params; ++i)
+        {
+            bool is_long_data = std::any_of(long_data.begin(), long_data.end(), [&](long_data_param p) {
+                return p.statement_id == statement_id && p.param_index == i;
+            });
+            if (!is_long_data)
+                serialize_binary_field(ctx, params[i]);
+        }
+    }
+}
+
+void boost::mysql::detail::bulk_execute_stmt_command::serialize(serialization_context& ctx) const
+{
+    // The wire layout is as follows:
+    //  command ID
+    //  std::uint32_t statement_id;
+    //  std::uint16_t flags; // STMT_BULK_FLAG_SEND_TYPES_TO_SERVER
+    //  array<meta_packet, num_params> meta;
+    //      protocol_field_type type;
+    //      std::uint8_t unsigned_flag;
+    //  array<row, num_rows> rows;
+    //      array<param, num_params>
+    //          std::uint8_t indicator; // STMT_INDICATOR_NONE or STMT_INDICATOR_NULL
+    //          field_view value;       // only if indicator is STMT_INDICATOR_NONE
+
+    BOOST_ASSERT(num_params > 0u);
+    BOOST_ASSERT(params.size() % num_params == 0u);
+
+    constexpr int1 command_id{0xfa};
+    constexpr int2 flags{128};  // STMT_BULK_FLAG_SEND_TYPES_TO_SERVER
+    constexpr std::uint8_t indicator_none = 0;
+    constexpr std::uint8_t indicator_null = 1;
+
+    // header
+    ctx.serialize_fixed(command_id, int4{statement_id}, flags);
+
+    // value metadata
+    for (std::size_t i = 0; i < num_params; ++i)
+    {
+        field_kind kind = get_bulk_param_kind(params, num_params, i);
+        protocol_field_type type = to_protocol_field_type(kind);
+        std::uint8_t unsigned_flag = kind == field_kind::uint64 ? std::uint8_t(0x80) : std::uint8_t(0);
+        ctx.serialize_fixed(int1{static_cast<std::uint8_t>(type)}, int1{unsigned_flag});
+    }
+
+    // actual values
+    for (field_view param : params)
+    {
+        if (param.is_null())
+        {
+            ctx.add(indicator_null);
+        }
+        else
         {
+            ctx.add(indicator_none);
             serialize_binary_field(ctx, param);
         }
     }
 }
 
+void boost::mysql::detail::fetch_stmt_command::serialize(serialization_context& ctx) const
+{
+    // The wire layout is as follows:
+    //  command ID
+    //  std::uint32_t statement_id;
+    //  std::uint32_t num_rows;
+    constexpr int1 command_id{0x1c};
+    ctx.serialize_fixed(command_id, int4{statement_id}, int4{num_rows});
+}
+
 void boost::mysql::detail::login_request::serialize(serialization_context& ctx) const
 {
     ctx.serialize_fixed(
         int4{negotiated_capabilities.get()},           // client_flag
         int4{max_packet_size},                         // max_packet_size
         int1{get_collation_first_byte(collation_id)},  //  character_set
-        string_fixed<23>{}                             // filler (all zeros)
+        string_fixed<19>{},                            // filler (all zeros)
+        int4{mariadb_ext_capabilities}                 // MariaDB extended capabilities, zero otherwise
     );
     ctx.serialize(
         string_null{username},
@@ -274,6 +416,10 @@ void boost::mysql::detail::login_request::serialize(serialization_context& ctx)
         string_null{database}.serialize(ctx);  // database
     }
     string_null{auth_plugin_name}.serialize(ctx);  //  client_plugin_name
+    if (negotiated_capabilities.has(CLIENT_ZSTD_COMPRESSION_ALGORITHM))
+    {
+        int1{zstd_compression_level}.serialize(ctx);  // zstd_compression_level
+    }
 }
 
 void boost::mysql::detail::ssl_request::serialize(serialization_context& ctx) const
@@ -282,7 +428,8 @@ void boost::mysql::detail::ssl_request::serialize(serialization_context& ctx) co
         int4{negotiated_capabilities.get()},           // client_flag
         int4{max_packet_size},                         // max_packet_size
         int1{get_collation_first_byte(collation_id)},  // character_set,
-        string_fixed<23>{}                             // filler, all zeros
+        string_fixed<19>{},                            // filler, all zeros
+        int4{mariadb_ext_capabilities}                 // MariaDB extended capabilities, zero otherwise
     );
 }
 
@@ -26,6 +26,7 @@ inline run_pipeline_algo_params setup_close_statement_pipeline(
     // Pipeline a ping with the close statement, to avoid delays on old connections
     // that don't set tcp_nodelay. Both requests are small and fixed size, so
     // we don't enforce any buffer limits here.
+    st.clear_long_data_params(params.stmt_id);
     st.write_buffer.clear();
     auto seqnum1 = serialize_top_level_checked(close_stmt_command{params.stmt_id}, st.write_buffer);
     auto seqnum2 = serialize_top_level_checked(ping_command{}, st.write_buffer);
@@ -35,7 +36,7 @@ inline run_pipeline_algo_params setup_close_statement_pipeline(
          {pipeline_stage_kind::ping, seqnum2, {}},
          }
     };
-    return {st.write_buffer, st.shared_pipeline_stages, nullptr};
+    return {st.write_buffer, st.shared_pipeline_stages, nullptr, false};
 }
 
 }  // namespace detail
@@ -30,6 +30,7 @@
 #include <boost/mysql/impl/internal/sansio/read_some_rows_dynamic.hpp>
 #include <boost/mysql/impl/internal/sansio/reset_connection.hpp>
 #include <boost/mysql/impl/internal/sansio/run_pipeline.hpp>
+#include <boost/mysql/impl/internal/sansio/send_long_data.hpp>
 #include <boost/mysql/impl/internal/sansio/set_character_set.hpp>
 #include <boost/mysql/impl/internal/sansio/start_execution.hpp>
 #include <boost/mysql/impl/internal/sansio/top_level_algo.hpp>
@@ -52,6 +53,7 @@ template <> struct get_algo<read_resultset_head_algo_params> { using type = read
 template <> struct get_algo<read_some_rows_algo_params> { using type = read_some_rows_algo; };
 template <> struct get_algo<read_some_rows_dynamic_algo_params> { using type = read_some_rows_dynamic_algo; };
 template <> struct get_algo<prepare_statement_algo_params> { using type = prepare_statement_algo; };
+template <> struct get_algo<send_long_data_algo_params> { using type = send_long_data_algo; };
 template <> struct get_algo<set_character_set_algo_params> { using type = set_character_set_algo; };
 template <> struct get_algo<quit_connection_algo_params> { using type = quit_connection_algo; };
 template <> struct get_algo<close_connection_algo_params> { using type = close_connection_algo; };
@@ -74,6 +76,7 @@ class connection_state
         read_some_rows_algo,
         read_some_rows_dynamic_algo,
         prepare_statement_algo,
+        send_long_data_algo,
         set_character_set_algo,
         quit_connection_algo,
         close_connection_algo,
@@ -86,8 +89,13 @@ public:
     // We initialize the algo state with a dummy value. This will be overwritten
     // by setup() before the first algorithm starts running. Doing this avoids
     // the need for a special null algo
-    connection_state(std::size_t read_buffer_size, std::size_t max_buffer_size, bool transport_supports_ssl)
-        : st_data_(read_buffer_size, max_buffer_size, transport_supports_ssl),
+    connection_state(
+        std::size_t read_buffer_size,
+        std::size_t max_buffer_size,
+        bool transport_supports_ssl,
+        container::pmr::memory_resource* buffer_resource = nullptr
+    )
+        : st_data_(read_buffer_size, max_buffer_size, transport_supports_ssl, buffer_resource),
           algo_(top_level_algo<quit_connection_algo>(
               st_data_,
               st_data_.shared_diag,
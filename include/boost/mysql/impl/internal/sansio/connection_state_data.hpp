@@ -9,18 +9,30 @@
 #define BOOST_MYSQL_IMPL_INTERNAL_SANSIO_CONNECTION_STATE_DATA_HPP
 
 #include <boost/mysql/character_set.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/compression_algorithm.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/field_view.hpp>
+#include <boost/mysql/local_infile.hpp>
 #include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/next_action.hpp>
+#include <boost/mysql/detail/ok_view.hpp>
 #include <boost/mysql/detail/pipeline.hpp>
 
 #include <boost/mysql/impl/internal/protocol/capabilities.hpp>
+#include <boost/mysql/impl/internal/protocol/compression.hpp>
 #include <boost/mysql/impl/internal/protocol/db_flavor.hpp>
+#include <boost/mysql/impl/internal/protocol/frame_header.hpp>
 #include <boost/mysql/impl/internal/protocol/serialization.hpp>
 #include <boost/mysql/impl/internal/sansio/message_reader.hpp>
+#include <boost/mysql/impl/internal/statement_cache.hpp>
 
+#include <boost/assert.hpp>
+#include <boost/core/span.hpp>
+
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -30,6 +42,9 @@ namespace boost {
 namespace mysql {
 namespace detail {
 
+// The maximum number of bytes requested to local infile handlers in a single call
+BOOST_INLINE_CONSTEXPR std::size_t local_infile_chunk_size = 0x10000;
+
 enum class ssl_state
 {
     unsupported,
@@ -49,6 +64,9 @@ struct connection_state_data
     // What are the connection's capabilities?
     capabilities current_capabilities;
 
+    // MariaDB extended capabilities (e.g. MARIADB_CLIENT_STMT_BULK_OPERATIONS). Zero for MySQL
+    std::uint32_t mariadb_ext_capabilities{0};
+
     // Used by async ops without output diagnostics params, to avoid allocations
     diagnostics shared_diag;
 
@@ -61,6 +79,9 @@ struct connection_state_data
     // Do we want to retain metadata strings or not? Used to save allocations
     metadata_mode meta_mode{metadata_mode::minimal};
 
+    // Supplies file contents for LOAD DATA LOCAL INFILE statements. Empty if not set
+    local_infile_handler local_infile;
+
     // Is SSL supported/enabled for the current connection?
     ssl_state ssl;
 
@@ -68,26 +89,78 @@ struct connection_state_data
     // be disabled using a variable. OK packets include a flag with this info.
     bool backslash_escapes{true};
 
+    // Has the session state changed since the connection was established or reset?
+    // The server reports changes in OK packets if CLIENT_SESSION_TRACK was negotiated.
+    // Which changes get reported depends on the session_track_xxx variables.
+    // Statements prepared by the user are not reported, so they're tracked here.
+    bool session_state_changed{false};
+
+    // Was a transaction active after the last OK packet? Reported by the server in OK packets
+    bool in_transaction{false};
+
+    // Has an execution been started whose response hasn't been fully read? Set when the request
+    // is sent, and cleared when the final OK or error packet is processed. Remains set if
+    // the user stops reading rows, an open cursor is abandoned or the operation fails
+    // mid-way (e.g. it gets cancelled), since the connection is then in an unknown state
+    bool execution_in_progress{false};
+
+    // The first error produced by the local infile handler during the current execution, if any.
+    // The server is told that the file is empty and keeps processing the execution,
+    // so the error is reported once the final OK packet has been read
+    error_code local_infile_err;
+
     // The current character set, or a default-constructed character set (will all nullptrs) if unknown
     character_set current_charset{};
 
+    // Server-side cursor opened by the current execution, if any. When the server
+    // runs out of fetched rows, it sends an OK packet with the cursor_exists flag set
+    // and last_row_sent cleared, and we need to send a fetch command to get more.
+    struct cursor_state
+    {
+        std::uint32_t stmt_id;
+        std::uint32_t fetch_size;  // zero if the current execution doesn't use a cursor
+        bool fetch_pending;
+    } cursor{};
+
     // The write buffer
     std::vector<std::uint8_t> write_buffer;
 
+    // If compression is enabled, messages are compressed into this buffer before being written
+    std::vector<std::uint8_t> compressed_write_buffer;
+
+    // Payloads smaller than this are not compressed. Set by handshake
+    std::size_t compression_threshold{default_compression_threshold};
+
     // Reader
     message_reader reader;
 
+    // The size the read buffer was created with
+    std::size_t initial_read_buffer_size;
+
+    // Buffers bigger than this are shrunk when the session is reset
+    std::size_t buffer_shrink_threshold{static_cast<std::size_t>(-1)};
+
+    // Statements prepared by cached_statement executions. Cleared when the server deallocates them
+    statement_cache stmt_cache{64u};
+
+    // Statement parameters that received data via send_long_data since their statement
+    // was last executed. The server discards this data when the statement is executed
+    std::vector<long_data_param> long_data_params;
+
     std::size_t max_buffer_size() const { return reader.max_buffer_size(); }
     bool ssl_active() const { return ssl == ssl_state::active; }
     bool supports_ssl() const { return ssl != ssl_state::unsupported; }
+    compression_algorithm compression() const { return reader.compression(); }
 
     connection_state_data(
         std::size_t read_buffer_size,
         std::size_t max_buff_size = static_cast<std::size_t>(-1),
-        bool transport_supports_ssl = false
+        bool transport_supports_ssl = false,
+        container::pmr::memory_resource* buffer_resource = nullptr
     )
         : ssl(transport_supports_ssl ? ssl_state::inactive : ssl_state::unsupported),
-          reader(read_buffer_size, max_buff_size)
+          reader(read_buffer_size, max_buff_size, max_packet_size, buffer_resource),
+          initial_read_buffer_size(read_buffer_size)
     {
     }
 
@@ -96,19 +169,159 @@ struct connection_state_data
         is_connected = false;
         flavor = db_flavor::mysql;
         current_capabilities = capabilities();
-        // Metadata mode does not get reset on handshake
+        mariadb_ext_capabilities = 0u;
+        // Metadata mode and the local infile handler do not get reset on handshake
         reader.reset();
         // Writer does not need reset, since every write clears previous state
         if (supports_ssl())
             ssl = ssl_state::inactive;
         backslash_escapes = true;
+        session_state_changed = false;
+        in_transaction = false;
+        execution_in_progress = false;
+        local_infile_err = error_code();
         current_charset = character_set{};
+        cursor = cursor_state{};
+        stmt_cache.clear();
+        long_data_params.clear();
+    }
+
+    // Releases the memory held by buffers that grew past buffer_shrink_threshold,
+    // going back to the initial size. Invalidates the last read message
+    void shrink_buffers()
+    {
+        if (reader.internal_buffer().size() > buffer_shrink_threshold)
+            reader.shrink_buffer(initial_read_buffer_size);
+        if (write_buffer.capacity() > buffer_shrink_threshold)
+        {
+            write_buffer.clear();
+            write_buffer.shrink_to_fit();
+        }
+        if (compressed_write_buffer.capacity() > buffer_shrink_threshold)
+        {
+            compressed_write_buffer.clear();
+            compressed_write_buffer.shrink_to_fit();
+        }
+    }
+
+    // Returns the bytes to write to the server to send the given frames.
+    // Used by top_level_algo, so that all writes get compressed, if required
+    span<const std::uint8_t> prepare_write(span<const std::uint8_t> frames)
+    {
+        if (compression() == compression_algorithm::none)
+            return frames;
+        compressed_write_buffer.clear();
+        serialize_compressed_frames(
+            compression(),
+            compression_threshold,
+            frames,
+            reader.compressed_seqnums(),
+            compressed_write_buffer
+        );
+        return compressed_write_buffer;
+    }
+
+    // Updates the session information reported by the server in every OK packet
+    void on_ok_packet(const ok_view& ok)
+    {
+        backslash_escapes = ok.backslash_escapes();
+        in_transaction = ok.in_transaction();
+        if (ok.session_state_changed())
+            session_state_changed = true;
+    }
+
+    // Whether a session reset is required to get a clean session.
+    // If the server doesn't support session tracking, we can't know, so we're conservative.
+    // Connections with unread responses can't be reused as they are. The reset will
+    // fail for them, causing the connection to be re-established
+    bool session_reset_required() const
+    {
+        return !current_capabilities.has(CLIENT_SESSION_TRACK) || session_state_changed || in_transaction ||
+               execution_in_progress;
+    }
+
+    // Called when the final OK or error packet of an execution has been processed.
+    // Returns the error to report for the execution, other than server errors
+    error_code on_execution_finished()
+    {
+        execution_in_progress = false;
+        error_code res = local_infile_err;
+        local_infile_err = error_code();
+        return res;
     }
 
     // Reads an OK packet from the reader. This operation is repeated in several places.
     error_code deserialize_ok(diagnostics& diag)
     {
-        return deserialize_ok_response(reader.message(), flavor, diag, backslash_escapes);
+        ok_view ok{};
+        auto err = deserialize_ok_response(reader.message(), flavor, diag, ok);
+        if (!err)
+            on_ok_packet(ok);
+        return err;
+    }
+
+    // LOAD DATA LOCAL INFILE: invokes the local infile handler to get the next chunk
+    // of the requested file, and serializes it as a packet into the write buffer.
+    // If the handler signals the end of the file, or it fails, or no handler is set,
+    // an empty packet is serialized, instead. This signals the server that no more data follows.
+    // Returns true if the serialized packet is the empty one.
+    bool prepare_local_infile_packet(string_view file_name, std::uint8_t& seqnum, error_code& ec)
+    {
+        // The handler generates the data directly into the write buffer
+        std::size_t size = 0u;
+        if (!local_infile)
+        {
+            ec = client_errc::local_infile_no_handler;
+        }
+        else
+        {
+            std::size_t max_size = (std::min)(max_buffer_size() - frame_header_size, local_infile_chunk_size);
+            write_buffer.resize(frame_header_size + max_size);
+            span<std::uint8_t> chunk(write_buffer.data() + frame_header_size, max_size);
+            size = local_infile(file_name, chunk, ec);
+            BOOST_ASSERT(size <= max_size);
+            if (ec)
+                size = 0u;
+        }
+
+        // Serialize the header
+        write_buffer.resize(frame_header_size + size);
+        serialize_frame_header(
+            span<std::uint8_t, frame_header_size>(write_buffer.data(), frame_header_size),
+            frame_header{static_cast<std::uint32_t>(size), seqnum++}
+        );
+        return size == 0u;
+    }
+
+    // Records that a statement parameter received long data. No-op if it was already recorded
+    void add_long_data_param(long_data_param param)
+    {
+        auto it = std::find_if(long_data_params.begin(), long_data_params.end(), [param](long_data_param p) {
+            return p.statement_id == param.statement_id && p.param_index == param.param_index;
+        });
+        if (it == long_data_params.end())
+            long_data_params.push_back(param);
+    }
+
+    // Does the statement have parameters with long data, waiting to be used by its next execution?
+    bool has_long_data_params(std::uint32_t stmt_id) const
+    {
+        return std::any_of(long_data_params.begin(), long_data_params.end(), [stmt_id](long_data_param p) {
+            return p.statement_id == stmt_id;
+        });
+    }
+
+    // Discards the long data records for a statement, after it's executed or closed
+    void clear_long_data_params(std::uint32_t stmt_id)
+    {
+        long_data_params.erase(
+            std::remove_if(
+                long_data_params.begin(),
+                long_data_params.end(),
+                [stmt_id](long_data_param p) { return p.statement_id == stmt_id; }
+            ),
+            long_data_params.end()
+        );
     }
 
     // Helpers for sans-io algorithms
@@ -32,8 +32,13 @@ class read_execute_response_algo
     read_some_rows_algo read_some_rows_st_;
 
 public:
-    read_execute_response_algo(diagnostics& diag, execution_processor* proc) noexcept
-        : read_head_st_(diag, {proc}), read_some_rows_st_(diag, {proc, output_ref()})
+    // in_pipeline: whether the execution request is part of a pipeline
+    read_execute_response_algo(
+        diagnostics& diag,
+        execution_processor* proc,
+        bool in_pipeline = false
+    ) noexcept
+        : read_head_st_(diag, {proc}, in_pipeline), read_some_rows_st_(diag, {proc, output_ref()})
     {
     }
 
@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_SANSIO_EXECUTION_SUMMARY_PROCESSOR_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_SANSIO_EXECUTION_SUMMARY_PROCESSOR_HPP
+
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/execution_summary.hpp>
+#include <boost/mysql/field_view.hpp>
+
+#include <boost/mysql/detail/coldef_view.hpp>
+#include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+#include <boost/mysql/detail/ok_view.hpp>
+
+#include <boost/core/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// An execution processor that discards metadata and rows, and aggregates
+// the OK packets of all resultsets into an execution_summary.
+// Used by pipelines, to avoid allocating a results object per stage
+class execution_summary_processor final : public execution_processor
+{
+    execution_summary summary_;
+
+    void on_ok_packet(const ok_view& pack) noexcept
+    {
+        summary_.affected_rows += pack.affected_rows;
+        if (summary_.last_insert_id == 0u)
+            summary_.last_insert_id = pack.last_insert_id;
+        summary_.warning_count += pack.warnings;
+    }
+
+    void reset_impl() noexcept override final { summary_ = execution_summary(); }
+
+    error_code on_head_ok_packet_impl(const ok_view& pack, diagnostics&) override final
+    {
+        on_ok_packet(pack);
+        return error_code();
+    }
+
+    void on_num_meta_impl(std::size_t) override final {}
+
+    error_code on_meta_impl(const coldef_view&, bool, diagnostics&) override final { return error_code(); }
+
+    error_code on_row_impl(span<const std::uint8_t>, const output_ref&, std::vector<field_view>&)
+        override final
+    {
+        return error_code();
+    }
+
+    error_code on_row_ok_packet_impl(const ok_view& pack) override final
+    {
+        on_ok_packet(pack);
+        return error_code();
+    }
+
+    void on_row_batch_start_impl() override final {}
+
+    void on_row_batch_finish_impl() override final {}
+
+public:
+    execution_summary_processor() = default;
+
+    const execution_summary& summary() const noexcept { return summary_; }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
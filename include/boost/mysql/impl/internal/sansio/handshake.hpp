@@ -21,6 +21,7 @@
 #include <boost/mysql/impl/internal/auth/auth.hpp>
 #include <boost/mysql/impl/internal/coroutine.hpp>
 #include <boost/mysql/impl/internal/protocol/capabilities.hpp>
+#include <boost/mysql/impl/internal/protocol/compression.hpp>
 #include <boost/mysql/impl/internal/protocol/db_flavor.hpp>
 #include <boost/mysql/impl/internal/protocol/deserialization.hpp>
 #include <boost/mysql/impl/internal/protocol/serialization.hpp>
@@ -61,7 +62,8 @@ inline error_code process_capabilities(
         return make_error_code(client_errc::server_unsupported);
     }
     negotiated_caps = server_caps & (required_caps | optional_capabilities |
-                                     conditional_capability(ssl == ssl_mode::enable, CLIENT_SSL));
+                                     conditional_capability(ssl == ssl_mode::enable, CLIENT_SSL) |
+                                     get_compression_capability(params.compression()));
     return error_code();
 }
 
@@ -108,6 +110,7 @@ class handshake_algo
 
         // Set capabilities & db flavor
         st.current_capabilities = negotiated_caps;
+        st.mariadb_ext_capabilities = hello.mariadb_ext_capabilities & mariadb_optional_ext_capabilities;
         st.flavor = hello.server;
 
         // If we're using SSL, mark the channel as secure
@@ -130,6 +133,7 @@ class handshake_algo
             st.current_capabilities,
             static_cast<std::uint32_t>(max_packet_size),
             hparams_.connection_collation(),
+            st.mariadb_ext_capabilities,
         };
     }
 
@@ -143,6 +147,8 @@ class handshake_algo
             auth_resp_.data,
             hparams_.database(),
             auth_resp_.plugin_name,
+            zstd_compression_level,
+            st.mariadb_ext_capabilities,
         };
     }
 
@@ -178,8 +184,13 @@ class handshake_algo
     void on_success(connection_state_data& st, const ok_view& ok)
     {
         st.is_connected = true;
-        st.backslash_escapes = ok.backslash_escapes();
+        st.on_ok_packet(ok);
+        st.session_state_changed = false;  // Changes reported here are part of the initial session state
         st.current_charset = collation_id_to_charset(hparams_.connection_collation());
+
+        // The server switches to the compressed protocol after sending the OK packet
+        st.reader.set_compression(get_compression_algorithm(st.current_capabilities));
+        st.compression_threshold = hparams_.compression_threshold();
     }
 
     error_code process_ok(connection_state_data& st)
@@ -9,18 +9,22 @@
 #define BOOST_MYSQL_IMPL_INTERNAL_SANSIO_MESSAGE_READER_HPP
 
 #include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/compression_algorithm.hpp>
 #include <boost/mysql/error_code.hpp>
 
 #include <boost/mysql/impl/internal/coroutine.hpp>
+#include <boost/mysql/impl/internal/protocol/compression.hpp>
 #include <boost/mysql/impl/internal/protocol/deserialization.hpp>
 #include <boost/mysql/impl/internal/protocol/frame_header.hpp>
 #include <boost/mysql/impl/internal/sansio/read_buffer.hpp>
 
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
+#include <boost/core/ignore_unused.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 namespace boost {
 namespace mysql {
@@ -34,26 +38,58 @@ namespace detail {
 //      Call resume with the number of bytes read
 // Or call prepare_read() and check done() to attempt to get a cached message
 //    (further prepare_read calls should use keep_state=true)
+// If compression is enabled, bytes are read into a separate buffer, and decompressed
+// into the main one as compressed frames become complete. prepare_buffer() may
+// complete the current message this way, without any further read.
 class message_reader
 {
 public:
     message_reader(
         std::size_t initial_buffer_size,
         std::size_t max_buffer_size = static_cast<std::size_t>(-1),
-        std::size_t max_frame_size = max_packet_size
+        std::size_t max_frame_size = max_packet_size,
+        container::pmr::memory_resource* buffer_resource = nullptr
     )
-        : buffer_(initial_buffer_size, max_buffer_size), max_frame_size_(max_frame_size)
+        : buffer_(initial_buffer_size, max_buffer_size, buffer_resource),
+          compressed_buffer_(0, max_buffer_size, buffer_resource),
+          max_frame_size_(max_frame_size)
     {
     }
 
     void reset()
     {
         buffer_.reset();
+        compressed_buffer_.reset();
+        compression_ = compression_algorithm::none;
+        compressed_seqnums_.reset();
         state_ = parse_state();
     }
 
     std::size_t max_buffer_size() const { return buffer_.max_size(); }
 
+    // Enables the compressed protocol. Must be called between messages,
+    // when no bytes are pending (i.e. just after the handshake)
+    void set_compression(compression_algorithm algo)
+    {
+        compression_ = algo;
+        compressed_seqnums_.reset();
+
+        // Give the compressed buffer the same size as the main one. This can't fail,
+        // since both buffers have the same maximum size
+        if (algo != compression_algorithm::none)
+        {
+            BOOST_ASSERT(buffer_.pending_size() == 0u);
+            auto ec = compressed_buffer_.grow_to_fit(buffer_.size());
+            BOOST_ASSERT(!ec);
+            ignore_unused(ec);
+        }
+    }
+
+    compression_algorithm compression() const { return compression_; }
+
+    // Compressed sequence numbers are shared by reads and writes
+    compressed_seqnum_tracker& compressed_seqnums() { return compressed_seqnums_; }
+
     // Prepares a read operation. sequence_number should be kept alive until
     // the next read is prepared or no more calls to resume() are expected.
     // If keep_state=true, and the op is not complete, parsing state is preserved
@@ -86,14 +122,20 @@ public:
     }
 
     // Returns buffer space suitable to read bytes to
-    span<std::uint8_t> buffer() { return buffer_.free_area(); }
+    span<std::uint8_t> buffer()
+    {
+        return is_compressed() ? compressed_buffer_.free_area() : buffer_.free_area();
+    }
 
-    // Removes old messages stored in the buffer, and resizes it, if required, to accomodate
-    // the message currently being parsed.
+    // Removes old messages stored in the buffer (when it's required or cheap), and resizes it,
+    // if required, to accomodate the message currently being parsed.
+    // With compression, this may complete the current message. Check done() before reading.
     BOOST_ATTRIBUTE_NODISCARD
     error_code prepare_buffer()
     {
-        buffer_.remove_reserved();
+        if (is_compressed())
+            return prepare_compressed_buffer();
+        buffer_.compact(state_.required_size);
         auto ec = buffer_.grow_to_fit(state_.required_size);
         if (ec)
             return ec;
@@ -101,9 +143,76 @@ public:
         return error_code();
     }
 
+    // Shrinks the buffer to target bytes, keeping any unparsed bytes. Invalidates
+    // the last parsed message
+    void shrink_buffer(std::size_t target)
+    {
+        buffer_.shrink(target);
+        compressed_buffer_.shrink(is_compressed() ? target : 0u);
+    }
+
     // The main operation. Call it after reading bytes against buffer(),
     // with the number of bytes read
     void resume(std::size_t bytes_read)
+    {
+        if (is_compressed())
+        {
+            // Decompress the frames that fit in the free area. Resizing the buffer here
+            // would invalidate the messages in the reserved area
+            compressed_buffer_.move_to_pending(bytes_read);
+            compressed_frame_header header{};
+            while (peek_compressed_frame(header) && get_uncompressed_size(header) <= buffer_.free_size())
+            {
+                auto ec = decompress_frame(header);
+                if (ec)
+                {
+                    state_.ec = ec;
+                    state_.resume_point = -1;
+                    return;
+                }
+            }
+            bytes_read = 0u;  // already moved to the pending area
+        }
+        parse(bytes_read);
+    }
+
+    // Exposed for testing
+    const read_buffer& internal_buffer() const { return buffer_; }
+    const read_buffer& internal_compressed_buffer() const { return compressed_buffer_; }
+
+    // The total number of bytes memmove'd by the reader. Exposed for tests and benchmarks
+    std::size_t bytes_moved() const
+    {
+        return buffer_.bytes_moved() + compressed_buffer_.bytes_moved() + header_bytes_moved_;
+    }
+
+private:
+    read_buffer buffer_;
+    read_buffer compressed_buffer_;  // raw bytes, only used with compression
+    std::size_t max_frame_size_;
+    compression_algorithm compression_{compression_algorithm::none};
+    compressed_seqnum_tracker compressed_seqnums_;
+    std::size_t header_bytes_moved_{0};  // bytes memmove'd by remove_continuation_headers
+
+    struct parse_state
+    {
+        int resume_point{0};
+        std::uint8_t* sequence_number{};
+        bool is_first_frame{true};
+        std::size_t num_continuation_frames{0};
+        std::size_t body_bytes{0};
+        bool more_frames_follow{false};
+        std::size_t required_size{0};
+        error_code ec;
+
+        parse_state() = default;
+        parse_state(std::uint8_t& seqnum) noexcept : sequence_number(&seqnum) {}
+    } state_;
+
+    bool is_compressed() const { return compression_ != compression_algorithm::none; }
+
+    // Parses the bytes in the pending area, which have already been decompressed if required
+    void parse(std::size_t bytes_read)
     {
         frame_header header{};
         buffer_.move_to_pending(bytes_read);
@@ -153,7 +262,10 @@ public:
                 }
                 else
                 {
-                    buffer_.remove_current_message_last(frame_header_size);
+                    // Intermediate headers are left in place until all frames have been received,
+                    // and then removed in a single pass. Removing them here would memmove
+                    // all pending bytes once per frame
+                    ++state_.num_continuation_frames;
                 }
                 state_.is_first_frame = false;
 
@@ -167,6 +279,7 @@ public:
                 // Check if we're done
                 if (!state_.more_frames_follow)
                 {
+                    remove_continuation_headers();
                     state_.resume_point = -1;
                     return;
                 }
@@ -174,26 +287,102 @@ public:
         }
     }
 
-    // Exposed for testing
-    const read_buffer& internal_buffer() const { return buffer_; }
+    // If a complete compressed frame has been read, retrieves its header
+    bool peek_compressed_frame(compressed_frame_header& header) const
+    {
+        if (compressed_buffer_.pending_size() < compressed_frame_header_size)
+            return false;
+        header = deserialize_compressed_frame_header(span<const std::uint8_t, compressed_frame_header_size>(
+            compressed_buffer_.pending_first(),
+            compressed_frame_header_size
+        ));
+        return compressed_buffer_.pending_size() - compressed_frame_header_size >= header.compressed_size;
+    }
 
-private:
-    read_buffer buffer_;
-    std::size_t max_frame_size_;
+    // Decompresses the first pending compressed frame into the main buffer's free area,
+    // which must be big enough, and marks the result as pending
+    error_code decompress_frame(compressed_frame_header header)
+    {
+        if (!compressed_seqnums_.check_read(header.sequence_number))
+            return client_errc::sequence_number_mismatch;
+
+        std::size_t uncompressed_size = get_uncompressed_size(header);
+        BOOST_ASSERT(buffer_.free_size() >= uncompressed_size);
+        span<const std::uint8_t> payload(
+            compressed_buffer_.pending_first() + compressed_frame_header_size,
+            header.compressed_size
+        );
+        if (header.uncompressed_size == 0u)
+        {
+            if (uncompressed_size)
+                std::memcpy(buffer_.free_first(), payload.data(), uncompressed_size);
+        }
+        else
+        {
+            span<std::uint8_t> output(buffer_.free_first(), uncompressed_size);
+            auto ec = decompress_payload(compression_, payload, output);
+            if (ec)
+                return ec;
+        }
+        buffer_.move_to_pending(uncompressed_size);
 
-    struct parse_state
+        // The compressed frame is no longer needed
+        std::size_t frame_size = compressed_frame_header_size + header.compressed_size;
+        compressed_buffer_.move_to_current_message(frame_size);
+        compressed_buffer_.move_to_reserved(frame_size);
+        return error_code();
+    }
+
+    error_code prepare_compressed_buffer()
     {
-        int resume_point{0};
-        std::uint8_t* sequence_number{};
-        bool is_first_frame{true};
-        std::size_t body_bytes{0};
-        bool more_frames_follow{false};
-        std::size_t required_size{0};
-        error_code ec;
+        // Decompress any complete frames until the current message is done.
+        // We can resize the main buffer here
+        compressed_frame_header header{};
+        while (!done() && peek_compressed_frame(header))
+        {
+            std::size_t uncompressed_size = get_uncompressed_size(header);
+            buffer_.compact(uncompressed_size);
+            auto ec = buffer_.grow_to_fit(uncompressed_size);
+            if (ec)
+                return ec;
+            ec = decompress_frame(header);
+            if (ec)
+                return ec;
+            parse(0);
+        }
+        state_.required_size = 0;
+        if (done())
+            return error_code();
+
+        // Make space for the rest of the compressed frame being read
+        std::size_t pending = compressed_buffer_.pending_size();
+        std::size_t required = pending < compressed_frame_header_size
+                                   ? compressed_frame_header_size - pending
+                                   : compressed_frame_header_size + header.compressed_size - pending;
+        compressed_buffer_.compact(required);
+        return compressed_buffer_.grow_to_fit(required);
+    }
 
-        parse_state() = default;
-        parse_state(std::uint8_t& seqnum) noexcept : sequence_number(&seqnum) {}
-    } state_;
+    // Once a multi-frame message has been fully received, the current message area
+    // looks like: body0 header1 body1 ... headerN bodyN, where all bodies but the last one
+    // have max_frame_size_ bytes. We move the bodies towards the end of the area,
+    // overwriting the headers, and then move the space they used to the reserved area.
+    // Every byte is moved at most once, and pending bytes are never touched.
+    void remove_continuation_headers() noexcept
+    {
+        std::size_t num_headers = state_.num_continuation_frames;
+        if (num_headers == 0u)
+            return;
+
+        std::uint8_t* first = buffer_.current_message_first();
+        for (std::size_t i = num_headers; i-- > 0u;)
+        {
+            std::uint8_t* body_first = first + i * (max_frame_size_ + frame_header_size);
+            std::memmove(body_first + (num_headers - i) * frame_header_size, body_first, max_frame_size_);
+        }
+        header_bytes_moved_ += num_headers * max_frame_size_;
+        buffer_.move_to_reserved(num_headers * frame_header_size);
+    }
 
     void set_required_size(std::size_t required_bytes)
     {
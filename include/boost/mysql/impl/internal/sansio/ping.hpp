@@ -60,7 +60,8 @@ inline run_pipeline_algo_params setup_ping_pipeline(connection_state_data& st)
     return {
         st.write_buffer,
         {st.shared_pipeline_stages.data(), 1},
-        nullptr
+        nullptr,
+        false,
     };
 }
 
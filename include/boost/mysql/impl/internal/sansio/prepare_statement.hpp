@@ -117,6 +117,10 @@ public:
             // Read response
             while (!(act = read_response_st_.resume(st, ec)).is_done())
                 BOOST_MYSQL_YIELD(resume_point_, 2, act)
+
+            // Prepared statements are session state, but the server doesn't report them
+            if (!act.error())
+                st.session_state_changed = true;
             return act;
         }
 
@@ -11,10 +11,13 @@
 #include <boost/mysql/client_errc.hpp>
 #include <boost/mysql/error_code.hpp>
 
+#include <boost/mysql/impl/internal/memory_resource_allocator.hpp>
+
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
 #include <boost/core/span.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -31,17 +34,23 @@ namespace detail {
 //   - Current message area: delimits the message we are currently parsing.
 //   - Pending bytes area: bytes we've read but haven't been parsed into a message yet.
 //   - Free area: free space for more bytes to be read.
+// Memory is allocated from the passed memory_resource, if any.
 class read_buffer
 {
-    std::vector<std::uint8_t> buffer_;
+    std::vector<std::uint8_t, memory_resource_allocator<std::uint8_t>> buffer_;
     std::size_t current_message_offset_{0};
     std::size_t pending_offset_{0};
     std::size_t free_offset_{0};
     std::size_t max_size_;
+    std::size_t bytes_moved_{0};  // total bytes memmove'd within the buffer
 
 public:
-    read_buffer(std::size_t size, std::size_t max_size = static_cast<std::size_t>(-1))
-        : buffer_(size), max_size_(max_size)
+    read_buffer(
+        std::size_t size,
+        std::size_t max_size = static_cast<std::size_t>(-1),
+        container::pmr::memory_resource* res = nullptr
+    )
+        : buffer_(size, std::uint8_t(), memory_resource_allocator<std::uint8_t>(res)), max_size_(max_size)
     {
         BOOST_ASSERT(size <= max_size_);
     }
@@ -58,6 +67,9 @@ public:
     std::size_t size() const noexcept { return buffer_.size(); }
     std::size_t max_size() const { return max_size_; }
 
+    // The total number of bytes memmove'd by compactions. Exposed for tests and benchmarks
+    std::size_t bytes_moved() const noexcept { return bytes_moved_; }
+
     // Area accessors
     std::uint8_t* reserved_first() noexcept { return buffer_.data(); }
     const std::uint8_t* reserved_first() const noexcept { return buffer_.data(); }
@@ -106,6 +118,7 @@ public:
         BOOST_ASSERT(length <= current_message_size());
         BOOST_ASSERT(length > 0);
         std::memmove(pending_first() - length, pending_first(), pending_size());
+        bytes_moved_ += pending_size();
         pending_offset_ -= length;
         free_offset_ -= length;
     }
@@ -131,12 +144,36 @@ public:
             std::size_t currmsg_size = current_message_size();
             std::size_t pend_size = pending_size();
             std::memmove(to, from, currmsg_size + pend_size);
+            bytes_moved_ += currmsg_size + pend_size;
             current_message_offset_ = 0;
             pending_offset_ = currmsg_size;
             free_offset_ = currmsg_size + pend_size;
         }
     }
 
+    // Removes the reserved area only if it's required to make space for n more bytes,
+    // or if it's cheap compared to the space it reclaims. If the current message and pending bytes
+    // are bigger than both the reserved and the free areas, and the free area can already fit
+    // n bytes, the memmove is skipped. This bounds the total number of bytes moved
+    // by the number of bytes consumed, making compaction amortized O(1) per byte
+    void compact(std::size_t n) noexcept
+    {
+        std::size_t bytes_to_move = current_message_size() + pending_size();
+        std::size_t reclaimed = reserved_size();
+        if (free_size() < n || reclaimed >= bytes_to_move || free_size() < reclaimed)
+            remove_reserved();
+    }
+
+    // Removes the reserved area and shrinks the buffer to target bytes, or to the minimum size
+    // required to hold the current message and pending bytes, if that's bigger.
+    // Used to release memory after reading big messages
+    void shrink(std::size_t target)
+    {
+        remove_reserved();
+        buffer_.resize((std::max)(target, free_offset_));
+        buffer_.shrink_to_fit();
+    }
+
     // Makes sure the free size is at least n bytes long; resizes the buffer if required
     BOOST_ATTRIBUTE_NODISCARD
     error_code grow_to_fit(std::size_t n)
@@ -0,0 +1,142 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_SANSIO_READ_EXECUTE_BATCH_RESPONSE_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_SANSIO_READ_EXECUTE_BATCH_RESPONSE_HPP
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+
+#include <boost/mysql/detail/next_action.hpp>
+#include <boost/mysql/detail/ok_view.hpp>
+
+#include <boost/mysql/impl/internal/coroutine.hpp>
+#include <boost/mysql/impl/internal/protocol/deserialization.hpp>
+#include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// The aggregated OK packets of a batch of statement executions, plus the first error found
+struct execute_batch_totals
+{
+    error_code err;
+    std::uint64_t affected_rows{};
+    std::uint64_t last_insert_id{};  // the first non-zero one
+    std::uint16_t status_flags{};    // the last one
+    unsigned warnings{};             // the sum of all of them, as in execution_summary
+};
+
+// Processes the response to one of the execution requests in a batch.
+// Server errors are recorded in totals, since the remaining responses must still be read.
+// Diagnostics are only written for the first error. Returns an error only if the response
+// can't be handled (it contains rows)
+inline error_code process_execute_batch_response(
+    connection_state_data& st,
+    execute_batch_totals& totals,
+    diagnostics& diag
+)
+{
+    diagnostics ignored_diag;
+    auto response = deserialize_execute_response(
+        st.reader.message(),
+        st.flavor,
+        totals.err ? ignored_diag : diag
+    );
+    switch (response.type)
+    {
+    case execute_response::type_t::error:
+        if (!totals.err)
+            totals.err = response.data.err;
+        break;
+    case execute_response::type_t::ok_packet:
+    {
+        const ok_view& ok = response.data.ok_pack;
+        st.on_ok_packet(ok);
+        totals.affected_rows += ok.affected_rows;
+        if (totals.last_insert_id == 0u)
+            totals.last_insert_id = ok.last_insert_id;
+        totals.status_flags = ok.status_flags;
+        totals.warnings += ok.warnings;
+        break;
+    }
+    case execute_response::type_t::num_fields: return client_errc::batch_returned_rows;
+    }
+    return error_code();
+}
+
+// Reads the responses to num_responses execution requests written at once,
+// each of them using the same sequence numbers. Used by pipelines
+class read_execute_batch_response_algo
+{
+    diagnostics* diag_;
+    std::size_t num_responses_;
+    std::uint8_t initial_seqnum_;
+
+    struct state_t
+    {
+        int resume_point{0};
+        std::size_t current{0};
+        std::uint8_t seqnum{0};
+        execute_batch_totals totals;
+    } state_;
+
+public:
+    read_execute_batch_response_algo(
+        diagnostics& diag,
+        std::size_t num_responses,
+        std::uint8_t seqnum
+    ) noexcept
+        : diag_(&diag), num_responses_(num_responses), initial_seqnum_(seqnum)
+    {
+    }
+
+    diagnostics& diag() { return *diag_; }
+    const execute_batch_totals& totals() const { return state_.totals; }
+
+    next_action resume(connection_state_data& st, error_code ec)
+    {
+        if (ec)
+            return ec;
+
+        switch (state_.resume_point)
+        {
+        case 0:
+
+            // Clear diagnostics
+            diag_->clear();
+
+            for (state_.current = 0; state_.current < num_responses_; ++state_.current)
+            {
+                // Read the response
+                state_.seqnum = initial_seqnum_;
+                BOOST_MYSQL_YIELD(state_.resume_point, 1, st.read(state_.seqnum))
+
+                // Process it
+                ec = process_execute_batch_response(st, state_.totals, *diag_);
+                if (ec)
+                    return ec;
+            }
+
+            // Report the first error, if any
+            return state_.totals.err;
+        }
+
+        return next_action();
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -8,13 +8,16 @@
 #ifndef BOOST_MYSQL_IMPL_INTERNAL_SANSIO_READ_RESULTSET_HEAD_HPP
 #define BOOST_MYSQL_IMPL_INTERNAL_SANSIO_READ_RESULTSET_HEAD_HPP
 
+#include <boost/mysql/client_errc.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
+#include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/algo_params.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
 
 #include <boost/mysql/impl/internal/coroutine.hpp>
+#include <boost/mysql/impl/internal/protocol/deserialization.hpp>
 #include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
 
 namespace boost {
@@ -32,10 +35,20 @@ inline error_code process_execution_response(
     error_code err;
     switch (response.type)
     {
-    case execute_response::type_t::error: err = response.data.err; break;
+    case execute_response::type_t::error:
+        // Error packets end the execution. Server errors take precedence over local infile errors
+        st.on_execution_finished();
+        err = response.data.err;
+        break;
     case execute_response::type_t::ok_packet:
-        st.backslash_escapes = response.data.ok_pack.backslash_escapes();
+        st.on_ok_packet(response.data.ok_pack);
         err = proc.on_head_ok_packet(response.data.ok_pack, diag);
+        if (proc.is_complete())
+        {
+            auto finish_err = st.on_execution_finished();
+            if (!err)
+                err = finish_err;
+        }
         break;
     case execute_response::type_t::num_fields: proc.on_num_meta(response.data.num_fields); break;
     }
@@ -62,15 +75,25 @@ class read_resultset_head_algo
 {
     diagnostics* diag_;
     execution_processor* proc_;
+    bool in_pipeline_;
 
     struct state_t
     {
         int resume_point{0};
+
+        // LOAD DATA LOCAL INFILE state. file_name points into the read buffer
+        string_view local_infile_file_name;
+        bool local_infile_eof{false};
+        error_code local_infile_err;
     } state_;
 
 public:
-    read_resultset_head_algo(diagnostics& diag, read_resultset_head_algo_params params) noexcept
-        : diag_(&diag), proc_(params.proc)
+    read_resultset_head_algo(
+        diagnostics& diag,
+        read_resultset_head_algo_params params,
+        bool in_pipeline = false
+    ) noexcept
+        : diag_(&diag), proc_(params.proc), in_pipeline_(in_pipeline)
     {
     }
 
@@ -98,8 +121,42 @@ public:
             // Read the response
             BOOST_MYSQL_YIELD(state_.resume_point, 1, st.read(proc_->sequence_number()))
 
-            // Response may be: ok_packet, err_packet, local infile request
-            // (not implemented), or response with fields
+            // LOAD DATA LOCAL INFILE statements make the server request the contents of a file
+            // before sending the actual response. In multi-statement queries, this happens
+            // once per statement, each one yielding a separate resultset.
+            // Without CLIENT_LOCAL_FILES, the 0xfb header is a valid field count
+            if (st.current_capabilities.has(CLIENT_LOCAL_FILES) &&
+                deserialize_local_infile_request(st.reader.message(), state_.local_infile_file_name))
+            {
+                // In a pipeline, the requests following this one have already been sent,
+                // and the server will interpret them as the file contents. There is no way
+                // to recover from this, so fail without invoking the handler
+                if (in_pipeline_)
+                    return error_code(client_errc::local_infile_in_pipeline);
+
+                // Send the file contents, one packet per handler invocation.
+                // An empty packet signals the end of the file
+                do
+                {
+                    state_.local_infile_eof = st.prepare_local_infile_packet(
+                        state_.local_infile_file_name,
+                        proc_->sequence_number(),
+                        state_.local_infile_err
+                    );
+                    BOOST_MYSQL_YIELD(state_.resume_point, 2, next_action::write({st.write_buffer, false}))
+                } while (!state_.local_infile_eof);
+
+                // If the handler failed, or there was no handler, the server has been told
+                // that the file is empty. Subsequent statements in multi-statement queries are still
+                // executed, so the error is reported once the final OK packet has been read
+                if (state_.local_infile_err && !st.local_infile_err)
+                    st.local_infile_err = state_.local_infile_err;
+
+                // Read the response to the statement
+                BOOST_MYSQL_YIELD(state_.resume_point, 3, st.read(proc_->sequence_number()))
+            }
+
+            // Response may be: ok_packet, err_packet or response with fields
             ec = process_execution_response(st, *proc_, st.reader.message(), *diag_);
             if (ec)
                 return ec;
@@ -108,7 +165,7 @@ public:
             while (proc_->is_reading_meta())
             {
                 // Read a message
-                BOOST_MYSQL_YIELD(state_.resume_point, 2, st.read(proc_->sequence_number()))
+                BOOST_MYSQL_YIELD(state_.resume_point, 4, st.read(proc_->sequence_number()))
 
                 // Process the metadata packet
                 ec = process_field_definition(*proc_, st.reader.message(), *diag_);
@@ -17,6 +17,7 @@
 
 #include <boost/mysql/impl/internal/coroutine.hpp>
 #include <boost/mysql/impl/internal/protocol/deserialization.hpp>
+#include <boost/mysql/impl/internal/protocol/serialization.hpp>
 #include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
 
 #include <cstddef>
@@ -37,6 +38,11 @@ class read_some_rows_algo
         std::size_t rows_read{0};
     } state_;
 
+    static bool is_cursor_batch_end(const connection_state_data& st, const ok_view& pack)
+    {
+        return st.cursor.fetch_size != 0u && pack.cursor_exists() && !pack.last_row_sent();
+    }
+
     BOOST_ATTRIBUTE_NODISCARD static std::pair<error_code, std::size_t> process_some_rows(
         connection_state_data& st,
         execution_processor& proc,
@@ -62,6 +68,8 @@ class read_some_rows_algo
             auto res = deserialize_row_message(buff, st.flavor, diag);
             if (res.type == row_message::type_t::error)
             {
+                // Error packets end the execution. Server errors take precedence over local infile errors
+                st.on_execution_finished();
                 err = res.data.err;
             }
             else if (res.type == row_message::type_t::row)
@@ -71,10 +79,23 @@ class read_some_rows_algo
                 if (!err)
                     ++read_rows;
             }
+            else if (is_cursor_batch_end(st, res.data.ok_pack))
+            {
+                // The server sent all the rows we fetched, but the cursor
+                // has more. This is not the end of the resultset
+                st.cursor.fetch_pending = true;
+                break;
+            }
             else
             {
-                st.backslash_escapes = res.data.ok_pack.backslash_escapes();
+                st.on_ok_packet(res.data.ok_pack);
                 err = proc.on_row_ok_packet(res.data.ok_pack);
+                if (proc.is_complete())
+                {
+                    auto finish_err = st.on_execution_finished();
+                    if (!err)
+                        err = finish_err;
+                }
             }
 
             if (err)
@@ -120,17 +141,42 @@ public:
             // Required for the dynamic version to work.
             st.shared_fields.clear();
 
-            // If we are not reading rows, return
-            if (!processor().is_reading_rows())
+            // If we are not reading rows, or there is no room for them, return
+            if (!processor().is_reading_rows() || output_.max_size() == 0u)
                 return next_action();
 
-            // Read at least one message. Keep parsing state, in case a previous message
-            // was parsed partially
-            BOOST_MYSQL_YIELD(state_.resume_point, 1, st.read(proc_->sequence_number(), true))
-
-            // Process messages
-            std::tie(ec, state_.rows_read) = process_some_rows(st, *proc_, output_, *diag_);
-            return ec;
+            while (true)
+            {
+                // If we're reading from a cursor and we consumed all the fetched rows,
+                // ask the server for more. This is a new command, so sequence numbers restart
+                if (st.cursor.fetch_pending)
+                {
+                    st.cursor.fetch_pending = false;
+                    proc_->sequence_number() = 0u;
+                    BOOST_MYSQL_YIELD(
+                        state_.resume_point,
+                        1,
+                        st.write(
+                            fetch_stmt_command{st.cursor.stmt_id, st.cursor.fetch_size},
+                            proc_->sequence_number()
+                        )
+                    )
+                    if (ec)
+                        return ec;
+                }
+
+                // Read at least one message. Keep parsing state, in case a previous message
+                // was parsed partially
+                BOOST_MYSQL_YIELD(state_.resume_point, 2, st.read(proc_->sequence_number(), true))
+
+                // Process messages
+                std::tie(ec, state_.rows_read) = process_some_rows(st, *proc_, output_, *diag_);
+
+                // If we got a batch end without rows (e.g. the cursor was just opened), fetch again.
+                // Otherwise, return the rows, so memory usage is bounded by the fetch size
+                if (ec || state_.rows_read != 0u || !st.cursor.fetch_pending)
+                    return ec;
+            }
         }
 
         return next_action();
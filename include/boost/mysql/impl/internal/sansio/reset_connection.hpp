@@ -53,6 +53,20 @@ public:
                 // to the server's default, which is an unknown value that doesn't have to match
                 // what was specified in handshake. As a safety measure, clear the current charset
                 st.current_charset = character_set{};
+
+                // Resetting deallocates all prepared statements
+                st.stmt_cache.clear();
+                st.long_data_params.clear();
+
+                // The session is back to the server's defaults, discarding any setup
+                // performed after connecting (e.g. by connection pools: character set,
+                // prepared statements and session tracking variables). This is a state change.
+                // Pools mark the session clean after running their own reset pipeline
+                st.session_state_changed = true;
+
+                // The session is clean now, so this is a good point to release
+                // any memory retained by previous big reads or writes
+                st.shrink_buffers();
             }
 
             // Done
@@ -74,7 +88,8 @@ inline run_pipeline_algo_params setup_reset_connection_pipeline(connection_state
     return {
         st.write_buffer,
         {st.shared_pipeline_stages.data(), 1},
-        nullptr
+        nullptr,
+        false,
     };
 }
 
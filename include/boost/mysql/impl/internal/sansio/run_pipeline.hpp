@@ -11,6 +11,7 @@
 #include <boost/mysql/character_set.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
+#include <boost/mysql/execution_summary.hpp>
 #include <boost/mysql/is_fatal_error.hpp>
 #include <boost/mysql/pipeline.hpp>
 
@@ -21,8 +22,10 @@
 
 #include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
 #include <boost/mysql/impl/internal/sansio/execute.hpp>
+#include <boost/mysql/impl/internal/sansio/execution_summary_processor.hpp>
 #include <boost/mysql/impl/internal/sansio/ping.hpp>
 #include <boost/mysql/impl/internal/sansio/prepare_statement.hpp>
+#include <boost/mysql/impl/internal/sansio/read_execute_batch_response.hpp>
 #include <boost/mysql/impl/internal/sansio/reset_connection.hpp>
 #include <boost/mysql/impl/internal/sansio/set_character_set.hpp>
 
@@ -46,6 +49,7 @@ class run_pipeline_algo
         read_reset_connection_response_algo reset_connection;
         read_ping_response_algo ping;
         read_set_character_set_response_algo set_character_set;
+        read_execute_batch_response_algo execute_batch;
 
         any_read_algo() noexcept : nothing{} {}
     };
@@ -54,6 +58,7 @@ class run_pipeline_algo
     span<const std::uint8_t> request_buffer_;
     span<const pipeline_request_stage> stages_;
     std::vector<stage_response>* response_;
+    bool execution_summaries_;
 
     int resume_point_{0};
     std::size_t current_stage_index_{0};
@@ -61,6 +66,7 @@ class run_pipeline_algo
     bool has_hatal_error_{};  // If true, fail further stages with pipeline_ec_
     any_read_algo read_response_algo_;
     diagnostics temp_diag_;
+    execution_summary_processor summary_processor_;  // used by execution stages when execution_summaries_
 
     void setup_response()
     {
@@ -72,11 +78,15 @@ class run_pipeline_algo
             // Setup them
             for (std::size_t i = 0u; i < stages_.size(); ++i)
             {
-                // Execution stages need to be initialized to results objects.
+                // Execution stages need to be initialized to results objects,
+                // or to summaries if the user requested it. Batch executions always use summaries.
                 // Otherwise, clear any previous content
                 auto& impl = access::get_impl((*response_)[i]);
-                if (stages_[i].kind == pipeline_stage_kind::execute)
+                if (stages_[i].kind == pipeline_stage_kind::execute && !execution_summaries_)
                     impl.emplace_results();
+                else if (stages_[i].kind == pipeline_stage_kind::execute ||
+                         stages_[i].kind == pipeline_stage_kind::execute_batch)
+                    impl.emplace_summary();
                 else
                     impl.emplace_error();
             }
@@ -94,13 +104,19 @@ class run_pipeline_algo
         {
         case pipeline_stage_kind::execute:
         {
+            // Summaries are kept in a processor of our own, and copied to the response when complete
             BOOST_ASSERT(response_ != nullptr);  // we don't support execution ignoring the response
-            auto& processor = access::get_impl((*response_)[current_stage_index_]).get_processor();
-            processor.reset(stage.stage_specific.enc, st.meta_mode);
-            processor.sequence_number() = stage.seqnum;
-            read_response_algo_.execute = {temp_diag_, &processor};
+            execution_processor* processor = &summary_processor_;
+            if (!execution_summaries_)
+                processor = &access::get_impl((*response_)[current_stage_index_]).get_processor();
+            processor->reset(stage.stage_specific.enc, st.meta_mode);
+            processor->sequence_number() = stage.seqnum;
+            read_response_algo_.execute = {temp_diag_, processor, true};
             break;
         }
+        case pipeline_stage_kind::execute_batch:
+            read_response_algo_.execute_batch = {temp_diag_, stage.stage_specific.num_requests, stage.seqnum};
+            break;
         case pipeline_stage_kind::prepare_statement:
             read_response_algo_.prepare_statement = {temp_diag_, stage.seqnum};
             break;
@@ -127,7 +143,7 @@ class run_pipeline_algo
         }
     }
 
-    void on_stage_finished(const connection_state_data& st, error_code stage_ec)
+    void on_stage_finished(connection_state_data& st, error_code stage_ec)
     {
         if (stage_ec)
         {
@@ -154,12 +170,42 @@ class run_pipeline_algo
         }
         else
         {
-            if (stages_[current_stage_index_].kind == pipeline_stage_kind::prepare_statement)
+            auto kind = stages_[current_stage_index_].kind;
+            if (kind == pipeline_stage_kind::prepare_statement)
             {
                 // Propagate results. We don't support prepare statements ignoring the response
                 BOOST_ASSERT(response_ != nullptr);
                 access::get_impl((*response_)[current_stage_index_])
                     .set_result(read_response_algo_.prepare_statement.result(st));
+
+                // Prepared statements are session state, but the server doesn't report them
+                st.session_state_changed = true;
+            }
+            else if (kind == pipeline_stage_kind::close_statement)
+            {
+                // Same as above. The closed statement may be one prepared by a connection pool,
+                // which needs to prepare it again before handing out the connection
+                st.session_state_changed = true;
+            }
+            else if (kind == pipeline_stage_kind::execute && execution_summaries_)
+            {
+                // Propagate the summary. Results objects are populated in place
+                BOOST_ASSERT(response_ != nullptr);
+                access::get_impl((*response_)[current_stage_index_])
+                    .set_summary(summary_processor_.summary());
+            }
+            else if (kind == pipeline_stage_kind::execute_batch)
+            {
+                // Propagate the aggregated counters, if the user is interested in them
+                if (response_ != nullptr)
+                {
+                    const auto& totals = read_response_algo_.execute_batch.totals();
+                    execution_summary summary;
+                    summary.affected_rows = totals.affected_rows;
+                    summary.last_insert_id = totals.last_insert_id;
+                    summary.warning_count = totals.warnings;
+                    access::get_impl((*response_)[current_stage_index_]).set_summary(summary);
+                }
             }
         }
     }
@@ -169,6 +215,7 @@ class run_pipeline_algo
         switch (stages_[current_stage_index_].kind)
         {
         case pipeline_stage_kind::execute: return read_response_algo_.execute.resume(st, ec);
+        case pipeline_stage_kind::execute_batch: return read_response_algo_.execute_batch.resume(st, ec);
         case pipeline_stage_kind::prepare_statement:
             return read_response_algo_.prepare_statement.resume(st, ec);
         case pipeline_stage_kind::reset_connection:
@@ -186,7 +233,8 @@ public:
         : diag_(&diag),
           request_buffer_(params.request_buffer),
           stages_(params.request_stages),
-          response_(params.response)
+          response_(params.response),
+          execution_summaries_(params.execution_summaries)
     {
     }
 
@@ -202,10 +250,18 @@ public:
             diag_->clear();
             setup_response();
 
+            // Any cursor opened by a previous execution is no longer relevant.
+            // Execution stages never open cursors nor invoke the local infile handler
+            st.cursor = connection_state_data::cursor_state{};
+            st.local_infile_err = error_code();
+
             // If the request is empty, don't do anything
             if (stages_.empty())
                 break;
 
+            // Until all responses are read, the connection has pending data
+            st.execution_in_progress = true;
+
             // Write the request. use_ssl is attached by top_level_algo
             BOOST_MYSQL_YIELD(resume_point_, 1, next_action::write({request_buffer_, false}))
 
@@ -226,8 +282,9 @@ public:
                     continue;
                 }
 
-                // Setup the stage
+                // Setup the stage. Execution stages clear the pending data flag when they complete
                 setup_current_stage(st);
+                st.execution_in_progress = true;
 
                 // Run it until completion
                 ec.clear();
@@ -237,6 +294,10 @@ public:
                 // Process the stage's result
                 on_stage_finished(st, act.error());
             }
+
+            // If all responses were read, there is no pending data
+            if (!has_hatal_error_)
+                st.execution_in_progress = false;
         }
 
         return pipeline_ec_;
@@ -0,0 +1,81 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_SANSIO_SEND_LONG_DATA_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_SANSIO_SEND_LONG_DATA_HPP
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+
+#include <boost/mysql/detail/algo_params.hpp>
+#include <boost/mysql/detail/next_action.hpp>
+
+#include <boost/mysql/impl/internal/coroutine.hpp>
+#include <boost/mysql/impl/internal/protocol/serialization.hpp>
+#include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
+
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+class send_long_data_algo
+{
+    int resume_point_{0};
+    diagnostics* diag_;
+    send_long_data_algo_params params_;
+    std::uint8_t sequence_number_{0};
+
+public:
+    send_long_data_algo(diagnostics& diag, send_long_data_algo_params params) noexcept
+        : diag_(&diag), params_(params)
+    {
+    }
+
+    diagnostics& diag() { return *diag_; }
+
+    next_action resume(connection_state_data& st, error_code ec)
+    {
+        switch (resume_point_)
+        {
+        case 0:
+
+            // Clear diagnostics
+            diag_->clear();
+
+            // Check the parameter index
+            if (params_.param_index >= params_.num_params)
+                return error_code(client_errc::wrong_num_params);
+
+            // Send the data. The server doesn't send any response to this request.
+            // Errors (e.g. exceeding max_long_data_size) are reported when executing the statement
+            BOOST_MYSQL_YIELD(
+                resume_point_,
+                1,
+                st.write(
+                    send_long_data_command{params_.stmt_id, params_.param_index, params_.data},
+                    sequence_number_
+                )
+            )
+            if (ec)
+                return ec;
+
+            // The next execution must not send this parameter's value
+            st.add_long_data_param({params_.stmt_id, params_.param_index});
+        }
+
+        return next_action();
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
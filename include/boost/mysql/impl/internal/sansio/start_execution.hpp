@@ -14,6 +14,7 @@
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/is_fatal_error.hpp>
 
 #include <boost/mysql/detail/algo_params.hpp>
 #include <boost/mysql/detail/any_execution_request.hpp>
@@ -23,13 +24,21 @@
 #include <boost/mysql/detail/resultset_encoding.hpp>
 
 #include <boost/mysql/impl/internal/coroutine.hpp>
+#include <boost/mysql/impl/internal/protocol/capabilities.hpp>
 #include <boost/mysql/impl/internal/protocol/impl/serialization_context.hpp>
 #include <boost/mysql/impl/internal/protocol/serialization.hpp>
 #include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
+#include <boost/mysql/impl/internal/sansio/prepare_statement.hpp>
+#include <boost/mysql/impl/internal/sansio/read_execute_batch_response.hpp>
 #include <boost/mysql/impl/internal/sansio/read_resultset_head.hpp>
 
 #include <boost/core/span.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace boost {
 namespace mysql {
 namespace detail {
@@ -61,7 +70,17 @@ class start_execution_algo
 {
     int resume_point_{0};
     read_resultset_head_algo read_head_st_;
+    read_prepare_statement_response_algo read_prepare_st_;
     any_execution_request req_;
+    statement stmt_;  // for cached statements
+
+    // State for batches. Bulk executions have a single response, and pipelined requests one per row
+    struct batch_state_t
+    {
+        std::vector<std::uint8_t> seqnums;  // one per response
+        std::size_t current{};
+        execute_batch_totals totals;
+    } batch_;
 
     std::uint8_t& seqnum() { return processor().sequence_number(); }
     execution_processor& processor() { return read_head_st_.processor(); }
@@ -73,7 +92,9 @@ class start_execution_algo
         {
         case any_execution_request::type_t::query:
         case any_execution_request::type_t::query_with_params: return resultset_encoding::text;
-        case any_execution_request::type_t::stmt: return resultset_encoding::binary;
+        case any_execution_request::type_t::stmt:
+        case any_execution_request::type_t::cached_stmt:
+        case any_execution_request::type_t::stmt_batch: return resultset_encoding::binary;
         default: BOOST_ASSERT(false); return resultset_encoding::text;  // LCOV_EXCL_LINE
         }
     }
@@ -98,7 +119,108 @@ class start_execution_algo
     {
         if (data.num_params != data.params.size())
             return error_code(client_errc::wrong_num_params);
-        return st.write(execute_stmt_command{data.stmt_id, data.params}, seqnum());
+        st.cursor.stmt_id = data.stmt_id;
+        st.cursor.fetch_size = data.fetch_size;
+        bool open_cursor = data.fetch_size != 0u;
+        auto act = st.write(
+            execute_stmt_command{data.stmt_id, data.params, open_cursor, st.long_data_params},
+            seqnum()
+        );
+
+        // The server discards long data once the statement is executed
+        if (act.type() == next_action_type::write)
+            st.clear_long_data_params(data.stmt_id);
+        return act;
+    }
+
+    // Executes a statement once per row of parameters. If the server supports it (MariaDB),
+    // a single bulk request is used. Otherwise, one execution request per row is written at once,
+    // and their responses are read one by one. Responses are processed the same way in both cases,
+    // so statements returning rows are always rejected
+    next_action write_stmt_batch(connection_state_data& st, any_execution_request::data_t::stmt_batch_t data)
+    {
+        if (data.num_params == 0u || data.params.empty() || data.params.size() % data.num_params != 0u)
+            return error_code(client_errc::wrong_num_params);
+
+        // Long data would only be used by the first execution, so it's not supported
+        if (st.has_long_data_params(data.stmt_id))
+            return error_code(client_errc::batch_with_long_data);
+
+        // Bulk execution sends types only once, so all values for a parameter must have the same type
+        if ((st.mariadb_ext_capabilities & MARIADB_CLIENT_STMT_BULK_OPERATIONS) &&
+            is_bulk_executable(data.params, data.num_params))
+        {
+            auto act = st.write(
+                bulk_execute_stmt_command{data.stmt_id, data.num_params, data.params},
+                seqnum()
+            );
+            batch_.seqnums.assign(1u, seqnum());
+            return act;
+        }
+
+        // Each request starts a new sequence
+        std::size_t num_rows = data.params.size() / data.num_params;
+        st.write_buffer.clear();
+        batch_.seqnums.resize(num_rows);
+        for (std::size_t i = 0; i < num_rows; ++i)
+        {
+            auto row = data.params.subspan(i * data.num_params, data.num_params);
+            auto res = serialize_top_level(
+                execute_stmt_command{data.stmt_id, row, false, {}},
+                st.write_buffer,
+                0,
+                st.max_buffer_size()
+            );
+            if (res.err)
+                return res.err;
+            batch_.seqnums[i] = res.seqnum;
+        }
+        return next_action::write({st.write_buffer, false});
+    }
+
+    // Notifies the processor of the aggregated results of a batch, once all responses have been read
+    error_code finish_batch(connection_state_data& st)
+    {
+        // All responses have been read, even if some of them were errors
+        st.on_execution_finished();
+
+        const auto& totals = batch_.totals;
+        if (totals.err)
+            return totals.err;
+
+        // Processors store warning counts as in OK packets, so saturate the sum
+        ok_view ok{
+            totals.affected_rows,
+            totals.last_insert_id,
+            static_cast<std::uint16_t>(totals.status_flags & ~status_flags::more_results),
+            static_cast<std::uint16_t>((std::min)(totals.warnings, 0xffffu)),
+            {},
+            {},
+        };
+        return processor().on_head_ok_packet(ok, diag());
+    }
+
+    // Prepares a statement that is not in the cache. If the cache is full, the least
+    // recently used statement is closed in the same write. Closing doesn't have a response,
+    // so this doesn't cause extra round-trips. The statement is only evicted from the cache
+    // if the request could be serialized, so it's never removed without being closed
+    next_action write_prepare_cached(connection_state_data& st)
+    {
+        string_view sql = req_.data.cached_stmt.sql;
+        st.write_buffer.clear();
+        statement evicted = st.stmt_cache.peek_lru();
+        if (evicted.valid())
+            serialize_top_level_checked(close_stmt_command{evicted.id()}, st.write_buffer);
+        auto res = serialize_top_level(prepare_stmt_command{sql}, st.write_buffer, 0, st.max_buffer_size());
+        if (res.err)
+            return res.err;
+        if (evicted.valid())
+        {
+            st.stmt_cache.pop_lru();
+            st.clear_long_data_params(evicted.id());
+        }
+        read_prepare_st_.sequence_number() = res.seqnum;
+        return next_action::write({st.write_buffer, false});
     }
 
     next_action compose_request(connection_state_data& st)
@@ -109,13 +231,19 @@ class start_execution_algo
         case any_execution_request::type_t::query_with_params:
             return write_query_with_params(st, req_.data.query_with_params);
         case any_execution_request::type_t::stmt: return write_stmt(st, req_.data.stmt);
+        case any_execution_request::type_t::cached_stmt:
+            return write_stmt(
+                st,
+                {stmt_.id(), static_cast<std::uint16_t>(stmt_.num_params()), req_.data.cached_stmt.params, 0u}
+            );
+        case any_execution_request::type_t::stmt_batch: return write_stmt_batch(st, req_.data.stmt_batch);
         default: BOOST_ASSERT(false); return next_action();  // LCOV_EXCL_LINE
         }
     }
 
 public:
     start_execution_algo(diagnostics& diag, start_execution_algo_params params) noexcept
-        : read_head_st_(diag, {params.proc}), req_(params.req)
+        : read_head_st_(diag, {params.proc}), read_prepare_st_(diag, 0u), req_(params.req)
     {
     }
 
@@ -133,14 +261,75 @@ public:
             // Reset the processor
             processor().reset(get_encoding(req_.type), st.meta_mode);
 
-            // Send the execution request
-            BOOST_MYSQL_YIELD(resume_point_, 1, compose_request(st))
+            // Any cursor opened by a previous execution is no longer relevant
+            st.cursor = connection_state_data::cursor_state{};
+
+            // Until the final OK or error packet is read, the connection has pending data
+            st.execution_in_progress = true;
+            st.local_infile_err = error_code();
+
+            // Cached statements need to be prepared the first time they're used
+            if (req_.type == any_execution_request::type_t::cached_stmt)
+            {
+                stmt_ = st.stmt_cache.get(req_.data.cached_stmt.sql);
+                if (!stmt_.valid())
+                {
+                    // Client-side errors happen before anything is sent
+                    act = write_prepare_cached(st);
+                    if (act.is_done())
+                    {
+                        st.execution_in_progress = false;
+                        return act;
+                    }
+                    BOOST_MYSQL_YIELD(resume_point_, 1, act)
+                    if (ec)
+                        return ec;
+
+                    // If the server rejected the statement, its response has been fully read.
+                    // Fatal errors leave the connection in an unknown state
+                    while (!(act = read_prepare_st_.resume(st, ec)).is_done())
+                        BOOST_MYSQL_YIELD(resume_point_, 2, act)
+                    if (act.error())
+                    {
+                        if (!is_fatal_error(act.error()))
+                            st.execution_in_progress = false;
+                        return act;
+                    }
+
+                    stmt_ = read_prepare_st_.result(st);
+                    st.stmt_cache.put(req_.data.cached_stmt.sql, stmt_);
+                }
+            }
+
+            // Send the execution request. Client-side errors happen before anything is sent
+            act = compose_request(st);
+            if (act.is_done())
+            {
+                st.execution_in_progress = false;
+                return act;
+            }
+            BOOST_MYSQL_YIELD(resume_point_, 3, act)
             if (ec)
                 return ec;
 
+            // Batches don't produce resultsets, but OK or error packets that get aggregated
+            if (!batch_.seqnums.empty())
+            {
+                for (batch_.current = 0; batch_.current < batch_.seqnums.size(); ++batch_.current)
+                {
+                    BOOST_MYSQL_YIELD(resume_point_, 5, st.read(batch_.seqnums[batch_.current]))
+                    if (ec)
+                        return ec;
+                    ec = process_execute_batch_response(st, batch_.totals, diag());
+                    if (ec)
+                        return ec;
+                }
+                return finish_batch(st);
+            }
+
             // Read the first resultset's head and return its result
             while (!(act = read_head_st_.resume(st, ec)).is_done())
-                BOOST_MYSQL_YIELD(resume_point_, 2, act)
+                BOOST_MYSQL_YIELD(resume_point_, 4, act)
             return act;
         }
 
@@ -87,6 +87,11 @@ public:
                         ec = st_->reader.prepare_buffer();
                         if (ec)
                             break;
+
+                        // With compression, the message may be complete without reading any more bytes
+                        if (st_->reader.done())
+                            break;
+
                         BOOST_MYSQL_YIELD(
                             resume_point_,
                             1,
@@ -104,8 +109,8 @@ public:
                 }
                 else if (act.type() == next_action_type::write)
                 {
-                    // Write until a complete message was written
-                    bytes_to_write_ = act.write_args().buffer;
+                    // Write until a complete message was written. Compress it first, if required
+                    bytes_to_write_ = st_->prepare_write(act.write_args().buffer);
 
                     while (!bytes_to_write_.empty() && !ec)
                     {
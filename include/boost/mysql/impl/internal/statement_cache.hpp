@@ -0,0 +1,127 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_STATEMENT_CACHE_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_STATEMENT_CACHE_HPP
+
+#include <boost/mysql/statement.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// A LRU cache of prepared statements, keyed by their SQL text.
+// Statements live in the server, so the cache must be cleared whenever
+// the server deallocates them (i.e. on session reset and reconnection).
+// Caches are expected to be small (tens to a few hundreds of statements),
+// so entries are kept in a vector and looked up linearly. This avoids
+// allocating when looking up statements that are already cached.
+class statement_cache
+{
+    struct entry
+    {
+        std::string sql;
+        statement stmt;
+        std::uint64_t last_use;
+    };
+
+    std::vector<entry> entries_;
+    std::size_t capacity_;
+    std::uint64_t use_counter_{0};
+
+    entry* find(string_view sql)
+    {
+        for (auto& e : entries_)
+        {
+            if (e.sql == sql)
+                return &e;
+        }
+        return nullptr;
+    }
+
+    // Index of the least recently used entry. The cache must not be empty
+    std::size_t lru_index() const
+    {
+        BOOST_ASSERT(!entries_.empty());
+        std::size_t res = 0u;
+        for (std::size_t i = 1u; i < entries_.size(); ++i)
+        {
+            if (entries_[i].last_use < entries_[res].last_use)
+                res = i;
+        }
+        return res;
+    }
+
+public:
+    explicit statement_cache(std::size_t capacity) noexcept : capacity_(capacity)
+    {
+        BOOST_ASSERT(capacity > 0u);
+    }
+
+    std::size_t capacity() const noexcept { return capacity_; }
+    std::size_t size() const noexcept { return entries_.size(); }
+
+    // Returns the statement prepared for sql, or an invalid statement if there is none.
+    // Marks the statement as the most recently used
+    statement get(string_view sql)
+    {
+        entry* e = find(sql);
+        if (e == nullptr)
+            return statement();
+        e->last_use = ++use_counter_;
+        return e->stmt;
+    }
+
+    // If the cache is full, returns the statement that pop_lru would remove.
+    // Otherwise, returns an invalid statement. Doesn't modify the cache
+    statement peek_lru() const
+    {
+        if (entries_.size() < capacity_)
+            return statement();
+        return entries_[lru_index()].stmt;
+    }
+
+    // If the cache is full, removes the least recently used statement and returns it,
+    // so it can be closed. Otherwise, returns an invalid statement
+    statement pop_lru()
+    {
+        if (entries_.size() < capacity_)
+            return statement();
+        std::size_t idx = lru_index();
+        statement res = entries_[idx].stmt;
+        if (idx != entries_.size() - 1u)
+            entries_[idx] = std::move(entries_.back());
+        entries_.pop_back();
+        return res;
+    }
+
+    // Adds a statement to the cache. sql must not be in the cache, and
+    // the cache must have room for it (as ensured by pop_lru)
+    void put(string_view sql, statement stmt)
+    {
+        BOOST_ASSERT(find(sql) == nullptr);
+        BOOST_ASSERT(entries_.size() < capacity_);
+        entries_.push_back(entry{std::string(sql.data(), sql.size()), stmt, ++use_counter_});
+    }
+
+    // Forgets all statements. To be called when the server deallocates them
+    void clear() noexcept { entries_.clear(); }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
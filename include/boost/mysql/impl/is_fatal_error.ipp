@@ -78,6 +78,12 @@ bool boost::mysql::is_fatal_error(error_code ec) noexcept
         case client_errc::row_type_mismatch:
         case client_errc::static_row_parsing_error:
 
+        // Rows returned by a batch are not read, leaving unread packets in the network buffer
+        case client_errc::batch_returned_rows:
+
+        // The server interprets the requests following the LOAD DATA statement as file contents
+        case client_errc::local_infile_in_pipeline:
+
         // While these are currently produced only by the connection pool,
         // any timed out or cancelled operation would leave the connection in an undefined state
         case client_errc::timeout:
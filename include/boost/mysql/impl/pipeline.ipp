@@ -24,7 +24,10 @@
 #include <boost/core/span.hpp>
 #include <boost/throw_exception.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <stdexcept>
+#include <vector>
 
 boost::mysql::pipeline_request& boost::mysql::pipeline_request::add_execute(string_view query)
 {
@@ -51,12 +54,64 @@ boost::mysql::pipeline_request& boost::mysql::pipeline_request::add_execute_rang
     impl_.stages_.reserve(impl_.stages_.size() + 1);  // strong guarantee
     impl_.stages_.push_back({
         detail::pipeline_stage_kind::execute,
-        detail::serialize_top_level_checked(detail::execute_stmt_command{stmt.id(), params}, impl_.buffer_),
+        detail::serialize_top_level_checked(
+            detail::execute_stmt_command{stmt.id(), params, false, {}},
+            impl_.buffer_
+        ),
         detail::resultset_encoding::binary,
     });
     return *this;
 }
 
+boost::mysql::pipeline_request& boost::mysql::pipeline_request::add_execute_batch(
+    statement stmt,
+    span<const field_view> params
+)
+{
+    const std::size_t num_params = stmt.num_params();
+    if (num_params == 0u || params.empty() || params.size() % num_params != 0u)
+    {
+        BOOST_THROW_EXCEPTION(
+            std::invalid_argument("Wrong number of actual parameters supplied to a prepared statement")
+        );
+    }
+    impl_.stages_.reserve(impl_.stages_.size() + 1);  // strong guarantee
+
+    // Serializing several messages may fail half-way. Remove any partial output in this case
+    struct buffer_guard
+    {
+        std::vector<std::uint8_t>& buff;
+        std::size_t initial_size;
+        bool dismissed;
+
+        ~buffer_guard()
+        {
+            if (!dismissed)
+                buff.resize(initial_size);
+        }
+    } guard{impl_.buffer_, impl_.buffer_.size(), false};
+
+    // All executions are read using the same sequence number, so every row must fit in a single frame
+    const std::size_t num_rows = params.size() / num_params;
+    for (std::size_t i = 0u; i < num_rows; ++i)
+    {
+        auto seqnum = detail::serialize_top_level_checked(
+            detail::execute_stmt_command{stmt.id(), params.subspan(i * num_params, num_params), false, {}},
+            impl_.buffer_
+        );
+        if (seqnum != 1u)
+        {
+            BOOST_THROW_EXCEPTION(
+                std::invalid_argument("pipeline_request::add_execute_batch: parameters don't fit in a frame")
+            );
+        }
+    }
+    guard.dismissed = true;
+
+    impl_.stages_.push_back({detail::pipeline_stage_kind::execute_batch, std::uint8_t(1), num_rows});
+    return *this;
+}
+
 boost::mysql::pipeline_request& boost::mysql::pipeline_request::add_prepare_statement(string_view stmt_sql)
 {
     impl_.stages_.reserve(impl_.stages_.size() + 1);  // strong guarantee
@@ -116,6 +171,16 @@ void boost::mysql::stage_response::check_has_results() const
     }
 }
 
+void boost::mysql::stage_response::check_has_summary() const
+{
+    if (!has_summary())
+    {
+        BOOST_THROW_EXCEPTION(
+            std::invalid_argument("stage_response::as_summary: object doesn't contain an execution summary")
+        );
+    }
+}
+
 boost::mysql::statement boost::mysql::stage_response::as_statement() const
 {
     if (!has_statement())
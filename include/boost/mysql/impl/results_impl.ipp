@@ -48,6 +48,7 @@ void boost::mysql::detail::results_impl::reset_impl() noexcept
     meta_.clear();
     per_result_.clear();
     info_.clear();
+    session_track_.clear();
     rows_.clear();
     num_fields_at_batch_start_ = no_batch;
 }
@@ -125,6 +126,7 @@ boost::mysql::detail::per_resultset_data& boost::mysql::detail::results_impl::ad
     resultset_data.meta_offset = meta_.size();
     resultset_data.field_offset = rows_.fields().size();
     resultset_data.info_offset = info_.size();
+    resultset_data.session_track_offset = session_track_.size();
     return resultset_data;
 }
 
@@ -138,6 +140,12 @@ void boost::mysql::detail::results_impl::on_ok_packet_impl(const ok_view& pack)
     resultset_data.has_ok_packet_data = true;
     resultset_data.is_out_params = pack.is_out_params();
     info_.insert(info_.end(), pack.info.begin(), pack.info.end());
+    resultset_data.session_track_size = pack.session_state_info.size();
+    session_track_.insert(
+        session_track_.end(),
+        pack.session_state_info.data(),
+        pack.session_state_info.data() + pack.session_state_info.size()
+    );
     if (!pack.more_results())
     {
         finish_batch();
@@ -23,6 +23,8 @@ void boost::mysql::resultset::assign(resultset_view v)
         last_insert_id_ = v.last_insert_id();
         warnings_ = static_cast<std::uint16_t>(v.warning_count());
         info_.assign(v.info().begin(), v.info().end());
+        auto track = detail::access::get_impl(v.session_track());
+        session_track_.assign(track.begin(), track.end());
         is_out_params_ = v.is_out_params();
     }
     else
@@ -33,6 +35,7 @@ void boost::mysql::resultset::assign(resultset_view v)
         last_insert_id_ = 0;
         warnings_ = 0;
         info_.clear();
+        session_track_.clear();
         is_out_params_ = false;
     }
 }
@@ -0,0 +1,89 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_SESSION_TRACK_ITERATOR_IPP
+#define BOOST_MYSQL_IMPL_SESSION_TRACK_ITERATOR_IPP
+
+#pragma once
+
+#include <boost/mysql/session_track.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/session_track_iterator.hpp>
+
+#include <boost/mysql/impl/internal/protocol/impl/deserialization_context.hpp>
+#include <boost/mysql/impl/internal/protocol/impl/protocol_types.hpp>
+
+#include <boost/core/span.hpp>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Parses the data field of a session state item, according to its type.
+// If the data doesn't have the expected format, it's left untouched
+inline void parse_session_track_data(session_track_item& item)
+{
+    deserialization_context ctx(span<const std::uint8_t>(
+        reinterpret_cast<const std::uint8_t*>(item.value.data()),
+        item.value.size()
+    ));
+    string_lenenc name, value;
+    int1 encoding_spec;
+    deserialize_errc err = deserialize_errc::ok;
+
+    switch (item.type)
+    {
+    case session_track_type::system_variable: err = ctx.deserialize(name, value); break;
+    case session_track_type::gtids:
+        // The encoding specification is always zero. GTIDs are sent as text
+        err = ctx.deserialize(encoding_spec, value);
+        break;
+    case session_track_type::schema:
+    case session_track_type::state_change:
+    case session_track_type::transaction_characteristics:
+    case session_track_type::transaction_state: err = ctx.deserialize(value); break;
+    default: return;  // Unknown type, leave it as raw data
+    }
+
+    if (err == deserialize_errc::ok && ctx.size() == 0u)
+    {
+        item.name = name.value;
+        item.value = value.value;
+    }
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+void boost::mysql::detail::session_track_iterator::parse_current() noexcept
+{
+    // Are we at the end?
+    if (first_ == last_)
+    {
+        next_ = last_;
+        return;
+    }
+
+    // Each item contains a type byte and a length-encoded string with type-specific data
+    deserialization_context ctx(span<const std::uint8_t>(first_, last_));
+    int1 type;
+    string_lenenc data;
+    if (ctx.deserialize(type, data) != deserialize_errc::ok)
+    {
+        // Malformed data. Stop iterating
+        first_ = next_ = last_;
+        return;
+    }
+    next_ = ctx.first();
+
+    current_ = session_track_item{static_cast<session_track_type>(type.value), string_view(), data.value};
+    parse_session_track_data(current_);
+}
+
+#endif
@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_SHARDED_CONNECTION_POOL_IPP
+#define BOOST_MYSQL_IMPL_SHARDED_CONNECTION_POOL_IPP
+
+#pragma once
+
+#include <boost/mysql/sharded_connection_pool.hpp>
+
+#include <boost/mysql/detail/connection_pool_fwd.hpp>
+
+#include <boost/mysql/impl/internal/connection_pool/sharded_pool_impl.hpp>
+
+#include <cstddef>
+#include <memory>
+
+boost::mysql::sharded_connection_pool::sharded_connection_pool(
+    asio::any_io_executor ex,
+    pool_params&& params,
+    std::size_t num_shards,
+    int
+)
+    : impl_(std::make_shared<detail::sharded_pool_impl>(std::move(ex), std::move(params), num_shards))
+{
+}
+
+boost::mysql::sharded_connection_pool::executor_type boost::mysql::sharded_connection_pool::get_executor(
+) noexcept
+{
+    return impl_->get_executor();
+}
+
+std::size_t boost::mysql::sharded_connection_pool::num_shards() const noexcept
+{
+    return impl_->num_shards();
+}
+
+boost::mysql::pool_stats boost::mysql::sharded_connection_pool::stats() const noexcept
+{
+    return impl_->stats();
+}
+
+void boost::mysql::sharded_connection_pool::async_run_erased(
+    std::shared_ptr<detail::sharded_pool_impl> pool,
+    asio::any_completion_handler<void(error_code)> handler
+)
+{
+    pool->async_run(std::move(handler));
+}
+
+void boost::mysql::sharded_connection_pool::async_get_connection_erased(
+    std::shared_ptr<detail::sharded_pool_impl> pool,
+    std::chrono::steady_clock::duration timeout,
+    diagnostics* diag,
+    asio::any_completion_handler<void(error_code, pooled_connection)> handler
+)
+{
+    pool->async_get_connection(timeout, diag, std::move(handler));
+}
+
+void boost::mysql::sharded_connection_pool::cancel()
+{
+    BOOST_ASSERT(valid());
+    impl_->cancel();
+}
+
+#endif
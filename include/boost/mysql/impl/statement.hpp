@@ -64,6 +64,23 @@ class boost::mysql::bound_statement_iterator_range
     }
 };
 
+class boost::mysql::bound_statement_batch
+{
+    friend class statement;
+    friend struct detail::access;
+
+    struct impl
+    {
+        statement stmt;
+        span<const field_view> params;
+    } impl_;
+
+    bound_statement_batch(const statement& stmt, span<const field_view> params) noexcept
+        : impl_{stmt, params}
+    {
+    }
+};
+
 template <BOOST_MYSQL_WRITABLE_FIELD_TUPLE WritableFieldTuple, typename EnableIf>
 boost::mysql::bound_statement_tuple<typename std::decay<WritableFieldTuple>::type> boost::mysql::statement::
     bind(WritableFieldTuple&& args) const
@@ -86,6 +103,13 @@ boost::mysql::bound_statement_iterator_range<FieldViewFwdIterator> boost::mysql:
     return bound_statement_iterator_range<FieldViewFwdIterator>(*this, first, last);
 }
 
+boost::mysql::bound_statement_batch boost::mysql::statement::bind_batch(span<const field_view> params
+) const noexcept
+{
+    BOOST_ASSERT(valid());
+    return bound_statement_batch(*this, params);
+}
+
 // Execution request traits
 namespace boost {
 namespace mysql {
@@ -100,7 +124,9 @@ struct stmt_tuple_request_proxy
 
     operator any_execution_request() const
     {
-        return any_execution_request({stmt.id(), static_cast<std::uint16_t>(stmt.num_params()), params});
+        return any_execution_request(
+            {stmt.id(), static_cast<std::uint16_t>(stmt.num_params()), params, 0u}
+        );
     }
 };
 
@@ -133,11 +159,26 @@ struct execution_request_traits<bound_statement_iterator_range<FieldViewFwdItera
         auto& impl = access::get_impl(input);
         shared_fields.assign(impl.first, impl.last);
         return any_execution_request(
-            {impl.stmt.id(), static_cast<std::uint16_t>(impl.stmt.num_params()), shared_fields}
+            {impl.stmt.id(), static_cast<std::uint16_t>(impl.stmt.num_params()), shared_fields, 0u}
         );
     }
 };
 
+// Batch
+template <>
+struct execution_request_traits<bound_statement_batch>
+{
+    static any_execution_request make_request(const bound_statement_batch& input, std::vector<field_view>&)
+    {
+        auto& impl = access::get_impl(input);
+        return any_execution_request(any_execution_request::data_t::stmt_batch_t{
+            impl.stmt.id(),
+            static_cast<std::uint16_t>(impl.stmt.num_params()),
+            impl.params
+        });
+    }
+};
+
 }  // namespace detail
 }  // namespace mysql
 }  // namespace boost
@@ -11,7 +11,6 @@
 #pragma once
 
 #include <boost/mysql/detail/execution_processor/static_execution_state_impl.hpp>
-#include <boost/mysql/detail/row_impl.hpp>
 
 #include <boost/mysql/impl/internal/protocol/deserialization.hpp>
 
@@ -22,6 +21,7 @@ void boost::mysql::detail::static_execution_state_erased_impl::reset_impl() noex
     ok_data_ = ok_packet_data();
     info_.clear();
     meta_.clear();
+    db_to_cpp_.clear();
 }
 
 boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_impl::on_head_ok_packet_impl(
@@ -57,13 +57,21 @@ boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_imp
     // Record its position
     pos_map_add_field(current_pos_map(), current_name_table(), meta_index, coldef.name);
 
-    return is_last ? meta_check(diag) : error_code();
+    if (!is_last)
+        return error_code();
+
+    auto err = meta_check(diag);
+    if (err)
+        return err;
+
+    compute_db_to_cpp();
+    return error_code();
 }
 
 boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_impl::on_row_impl(
     span<const std::uint8_t> msg,
     const output_ref& ref,
-    std::vector<field_view>& fields
+    std::vector<field_view>&
 )
 
 {
@@ -71,21 +79,35 @@ boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_imp
     if (ref.type_index() != ext_.type_index(resultset_index_ - 1))
         return client_errc::row_type_mismatch;
 
-    // Allocate temporary space
-    fields.clear();
-    span<field_view> storage = add_fields(fields, meta_.size());
-
-    // deserialize the row
-    auto err = deserialize_row(encoding(), msg, meta_, storage);
+    // Get pointers to the members we will be writing to
+    std::size_t idx = resultset_index_ - 1;
+    span<void*> members = ext_.members(idx);
+    ext_.members_fn(idx)(ref, members);
+
+    // Parse each field into its member as it gets deserialized. This avoids
+    // storing the entire row as field_views. Deserialization errors take precedence
+    // over parsing errors, as in the other execution processors.
+    // Fields that don't map to any member are deserialized (to validate the message), then ignored.
+    auto parse_fns = ext_.field_parse_fns(idx);
+    error_code parse_err;
+    auto err = deserialize_row_fields(
+        encoding(),
+        msg,
+        meta_,
+        [this, parse_fns, members, &parse_err](std::size_t db_index, field_view value) {
+            std::size_t cpp_index = db_to_cpp_[db_index];
+            if (cpp_index != pos_absent)
+            {
+                auto ec = parse_fns[cpp_index](value, members[cpp_index]);
+                if (!parse_err)
+                    parse_err = ec;
+            }
+        }
+    );
     if (err)
         return err;
 
-    // parse it into the output ref
-    err = ext_.parse_fn(resultset_index_ - 1)(current_pos_map(), storage, ref);
-    if (err)
-        return err;
-
-    return error_code();
+    return parse_err;
 }
 
 boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_impl::on_row_ok_packet_impl(
@@ -95,6 +117,18 @@ boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_imp
     return on_ok_packet_impl(pack);
 }
 
+void boost::mysql::detail::static_execution_state_erased_impl::compute_db_to_cpp()
+{
+    auto pos_map = current_pos_map();
+    db_to_cpp_.assign(meta_.size(), pos_absent);
+    for (std::size_t cpp_index = 0; cpp_index < pos_map.size(); ++cpp_index)
+    {
+        // meta_check guarantees that all fields are present
+        BOOST_ASSERT(pos_map[cpp_index] < meta_.size());
+        db_to_cpp_[pos_map[cpp_index]] = cpp_index;
+    }
+}
+
 void boost::mysql::detail::static_execution_state_erased_impl::on_new_resultset() noexcept
 {
     ++resultset_index_;
@@ -12,7 +12,6 @@
 
 #include <boost/mysql/detail/config.hpp>
 #include <boost/mysql/detail/execution_processor/static_results_impl.hpp>
-#include <boost/mysql/detail/row_impl.hpp>
 
 #include <boost/mysql/impl/internal/protocol/deserialization.hpp>
 
@@ -22,6 +21,7 @@ void boost::mysql::detail::static_results_erased_impl::reset_impl() noexcept
     ext_.reset_fn()(ext_.rows());
     info_.clear();
     meta_.clear();
+    db_to_cpp_.clear();
     resultset_index_ = 0;
 }
 
@@ -59,29 +59,52 @@ boost::mysql::error_code boost::mysql::detail::static_results_erased_impl::on_me
     // Fill the pos map entry for this field, if any
     pos_map_add_field(current_pos_map(), current_name_table(), meta_index, coldef.name);
 
-    return is_last ? meta_check(diag) : error_code();
+    if (!is_last)
+        return error_code();
+
+    auto err = meta_check(diag);
+    if (err)
+        return err;
+
+    compute_db_to_cpp();
+    return error_code();
 }
 
 boost::mysql::error_code boost::mysql::detail::static_results_erased_impl::on_row_impl(
     span<const std::uint8_t> msg,
     const output_ref&,
-    std::vector<field_view>& fields
+    std::vector<field_view>&
 )
 
 {
-    auto meta = current_resultset_meta();
-
-    // Allocate temporary storage
-    fields.clear();
-    span<field_view> storage = add_fields(fields, meta.size());
-
-    // deserialize the row
-    auto err = deserialize_row(encoding(), msg, meta, storage);
+    // Add a row to the appropriate tuple element, and get pointers to its members
+    std::size_t idx = resultset_index_ - 1;
+    span<void*> members = ext_.members(idx);
+    ext_.add_row_fn(idx)(ext_.rows(), members);
+
+    // Parse each field into its member as it gets deserialized, as static_execution_state does.
+    // Deserialization errors take precedence over parsing errors.
+    // Fields that don't map to any member are deserialized (to validate the message), then ignored.
+    auto parse_fns = ext_.field_parse_fns(idx);
+    error_code parse_err;
+    auto err = deserialize_row_fields(
+        encoding(),
+        msg,
+        current_resultset_meta(),
+        [this, parse_fns, members, &parse_err](std::size_t db_index, field_view value) {
+            std::size_t cpp_index = db_to_cpp_[db_index];
+            if (cpp_index != pos_absent)
+            {
+                auto ec = parse_fns[cpp_index](value, members[cpp_index]);
+                if (!parse_err)
+                    parse_err = ec;
+            }
+        }
+    );
     if (err)
         return err;
 
-    // parse it against the appropriate tuple element
-    return ext_.parse_fn(resultset_index_ - 1)(current_pos_map(), storage, ext_.rows());
+    return parse_err;
 }
 
 boost::mysql::error_code boost::mysql::detail::static_results_erased_impl::on_row_ok_packet_impl(
@@ -91,6 +114,19 @@ boost::mysql::error_code boost::mysql::detail::static_results_erased_impl::on_ro
     return on_ok_packet_impl(pack);
 }
 
+void boost::mysql::detail::static_results_erased_impl::compute_db_to_cpp()
+{
+    auto pos_map = current_pos_map();
+    std::size_t num_fields = current_resultset().meta_size;
+    db_to_cpp_.assign(num_fields, pos_absent);
+    for (std::size_t cpp_index = 0; cpp_index < pos_map.size(); ++cpp_index)
+    {
+        // meta_check guarantees that all fields are present
+        BOOST_ASSERT(pos_map[cpp_index] < num_fields);
+        db_to_cpp_[pos_map[cpp_index]] = cpp_index;
+    }
+}
+
 boost::mysql::detail::static_per_resultset_data& boost::mysql::detail::static_results_erased_impl::
     add_resultset()
 {
@@ -0,0 +1,68 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_WITH_CURSOR_HPP
+#define BOOST_MYSQL_IMPL_WITH_CURSOR_HPP
+
+#pragma once
+
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/with_cursor.hpp>
+
+#include <boost/mysql/detail/any_execution_request.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Execution request traits
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Wraps whatever the bound statement's traits return, so the parameters
+// it may hold are kept alive until the request is used
+template <class Request>
+struct with_cursor_proxy
+{
+    Request req;
+    std::uint32_t fetch_size;
+
+    operator any_execution_request() const
+    {
+        any_execution_request res = req;
+        BOOST_ASSERT(res.type == any_execution_request::type_t::stmt);
+        res.data.stmt.fetch_size = fetch_size;
+        return res;
+    }
+};
+
+template <class BoundStatement>
+struct execution_request_traits<with_cursor_t<BoundStatement>>
+{
+    using inner_traits = execution_request_traits<BoundStatement>;
+    using inner_request_type = decltype(inner_traits::make_request(
+        std::declval<const BoundStatement&>(),
+        std::declval<std::vector<field_view>&>()
+    ));
+
+    static with_cursor_proxy<inner_request_type> make_request(
+        const with_cursor_t<BoundStatement>& input,
+        std::vector<field_view>& shared_fields
+    )
+    {
+        return {inner_traits::make_request(input.stmt, shared_fields), input.fetch_size};
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,60 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_LOCAL_INFILE_HPP
+#define BOOST_MYSQL_LOCAL_INFILE_HPP
+
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/core/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) A user-supplied data source for `LOAD DATA LOCAL INFILE` statements.
+ * \details
+ * When a `LOAD DATA LOCAL INFILE 'name' ...` statement is executed, the server asks
+ * the client for the contents of the file `'name'`. The handler, set using
+ * \ref any_connection::set_local_infile_handler, supplies these contents. No files
+ * are read from disk by the library: the handler decides what the contents are.
+ * For instance, it can generate CSV data on the fly.
+ * \n
+ * The handler is invoked with the file name requested by the server and a buffer
+ * to fill. It should copy as many bytes as it wants (up to the buffer size) into the buffer
+ * and return the number of bytes copied. Each invocation is sent to the server as a separate packet,
+ * so memory usage is bounded by the buffer size. The handler is invoked repeatedly, until it returns zero,
+ * signaling the end of the file. The next `LOAD DATA LOCAL INFILE` statement
+ * starts a new sequence of invocations.
+ * \n
+ * To abort the operation (e.g. because the requested file name is not expected),
+ * set the passed `error_code` to a non-empty value. The server is notified that
+ * no more data is available, and the operation fails with this code.
+ * Note that any data sent before the error may have been loaded by the server.
+ * In multi-statement queries, the server keeps executing the remaining statements.
+ * These are read as usual, and the error is reported once the last resultset's
+ * OK packet has been read, leaving the connection usable.
+ * \n
+ * The handler is invoked synchronously, from within the execution operation.
+ * It should not perform blocking operations.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+using local_infile_handler = std::function<
+    std::size_t(string_view file_name, span<std::uint8_t> buffer, error_code& ec)>;
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -11,6 +11,7 @@
 #include <boost/mysql/character_set.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
+#include <boost/mysql/execution_summary.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/results.hpp>
 #include <boost/mysql/statement.hpp>
@@ -41,6 +42,9 @@ namespace mysql {
  * it can contain: \n
  *   \li A \ref statement. Will happen if the stage was a prepare statement that succeeded.
  *   \li A \ref results. Will happen if the stage was a query or statement execution that succeeded.
+ *   \li An \ref execution_summary. Will happen if the stage was a batch execution that succeeded
+ *       (as created by \ref pipeline_request::add_execute_batch), or a query or statement execution
+ *       that succeeded in a request using \ref pipeline_response_mode::summary.
  *   \li An \ref error_code, \ref diagnostics pair. Will happen if the stage failed, or if it succeeded but
  *       it doesn't yield a value (as in close statement, reset connection and set character set).
  *
@@ -59,15 +63,17 @@ class stage_response
 
     struct
     {
-        variant2::variant<errcode_with_diagnostics, statement, results> value;
+        variant2::variant<errcode_with_diagnostics, statement, results, execution_summary> value;
 
         void emplace_results() { value.emplace<results>(); }
+        void emplace_summary() { value.emplace<execution_summary>(); }
         void emplace_error() { value.emplace<errcode_with_diagnostics>(); }
         detail::execution_processor& get_processor()
         {
             return detail::access::get_impl(variant2::unsafe_get<2>(value));
         }
         void set_result(statement s) { value = s; }
+        void set_summary(const execution_summary& s) { value = s; }
         void set_error(error_code ec, diagnostics&& diag)
         {
             value.emplace<0>(errcode_with_diagnostics{ec, std::move(diag)});
@@ -82,6 +88,9 @@ class stage_response
     BOOST_MYSQL_DECL
     void check_has_results() const;
 
+    BOOST_MYSQL_DECL
+    void check_has_summary() const;
+
 public:
     /**
      * \brief Default constructor.
@@ -109,11 +118,19 @@ public:
      */
     bool has_results() const noexcept { return impl_.value.index() == 2u; }
 
+    /**
+     * \brief Returns true if the object contains an execution summary.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool has_summary() const noexcept { return impl_.value.index() == 3u; }
+
     /**
      * \brief Retrieves the contained error code.
      * \details
      * If `*this` contains an error, retrieves it.
-     * Otherwise (if `this->has_statement() || this->has_results()`),
+     * Otherwise (if `this->has_statement() || this->has_results() || this->has_summary()`),
      * returns an empty (default-constructed) error code.
      *
      * \par Exception safety
@@ -129,7 +146,7 @@ public:
      * \details
      * If `*this` contains an error, retrieves the associated diagnostic information
      * by copying it.
-     * Otherwise (if `this->has_statement() || this->has_results()`),
+     * Otherwise (if `this->has_statement() || this->has_results() || this->has_summary()`),
      * returns an empty diagnostics object.
      *
      * \par Exception safety
@@ -145,7 +162,7 @@ public:
      * \details
      * If `*this` contains an error, retrieves the associated diagnostic information
      * by moving it.
-     * Otherwise (if `this->has_statement() || this->has_results()`),
+     * Otherwise (if `this->has_statement() || this->has_results() || this->has_summary()`),
      * returns an empty (default-constructed) error.
      *
      * \par Exception safety
@@ -242,6 +259,58 @@ public:
         BOOST_ASSERT(has_results());
         return variant2::unsafe_get<2>(std::move(impl_.value));
     }
+
+    /**
+     * \brief Retrieves the contained execution summary or throws an exception.
+     * \details
+     * If `*this` contains an \ref execution_summary (`this->has_summary() == true`),
+     * retrieves it. Otherwise, throws an exception.
+     *
+     * \par Exception safety
+     * Strong guarantee. Throws on invalid input.
+     * \throws std::invalid_argument If `this->has_summary() == false`
+     */
+    execution_summary as_summary() const
+    {
+        check_has_summary();
+        return variant2::unsafe_get<3>(impl_.value);
+    }
+
+    /**
+     * \brief Retrieves the contained execution summary (unchecked accessor).
+     * \details
+     * If `*this` contains an \ref execution_summary, retrieves it.
+     * Otherwise, the behavior is undefined.
+     *
+     * \par Preconditions
+     * `this->has_summary() == true`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    execution_summary get_summary() const noexcept
+    {
+        BOOST_ASSERT(has_summary());
+        return variant2::unsafe_get<3>(impl_.value);
+    }
+};
+
+/**
+ * \brief (EXPERIMENTAL) Determines how the responses of execution stages are stored.
+ * \details
+ * See \ref pipeline_request::set_response_mode.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+enum class pipeline_response_mode
+{
+    /// Each execution stage stores its rows, metadata and OK packet data in a \ref results object.
+    results,
+
+    /// Each execution stage stores an \ref execution_summary. Rows and metadata are discarded.
+    summary,
 };
 
 /**
@@ -262,6 +331,7 @@ class pipeline_request
     {
         std::vector<std::uint8_t> buffer_;
         std::vector<detail::pipeline_request_stage> stages_;
+        pipeline_response_mode response_mode_{pipeline_response_mode::results};
     } impl_;
 
     friend struct detail::access;
@@ -350,6 +420,46 @@ public:
     BOOST_MYSQL_DECL
     pipeline_request& add_execute_range(statement stmt, span<const field_view> params);
 
+    /**
+     * \brief (EXPERIMENTAL) Adds a stage that executes a prepared statement once per set of parameters.
+     * \details
+     * `params` is interpreted as a sequence of rows, each one containing `stmt.num_params()`
+     * parameters. Creates a stage that executes `stmt` once per row, as if
+     * \ref add_execute_range had been called for each of them. All the executions are written
+     * to the server with the rest of the pipeline, but they form a single stage: only a
+     * single \ref stage_response is generated for all of them.
+     * \n
+     * On success, the stage's response contains an \ref execution_summary, with
+     * the number of affected rows and warnings summed over all executions. No \ref results
+     * object is created, making this function suitable to insert or update many rows
+     * without per-row allocations.
+     * \n
+     * If any of the executions fails, the remaining ones are still performed. The stage's
+     * response contains the first error encountered, together with its diagnostics.
+     * `stmt` shouldn't generate any rows. If it does, the stage fails with
+     * \ref client_errc::batch_returned_rows, which is a fatal error.
+     *
+     * \par Exception safety
+     * Strong guarantee. Throws if `params.size()` is not a non-zero multiple of
+     * `stmt.num_params()`, or if a single row of parameters doesn't fit into a single
+     * protocol frame (16MB). Additionally, memory allocations may throw.
+     * \throws std::invalid_argument If `stmt.num_params() == 0`, `params.empty()`,
+     *         `params.size() % stmt.num_params() != 0`, or a single row of parameters is too big.
+     *
+     * \par Preconditions
+     * The passed statement should be valid (`stmt.valid() == true`).
+     *
+     * \par Object lifetimes
+     * The `params` range is copied into the request and
+     * needs not be kept alive after this function returns.
+     *
+     * \par Experimental
+     * This part of the API is experimental, and may change in successive
+     * releases without previous notice.
+     */
+    BOOST_MYSQL_DECL
+    pipeline_request& add_execute_batch(statement stmt, span<const field_view> params);
+
     /**
      * \brief Adds a prepare statement stage.
      * \details
@@ -411,6 +521,50 @@ public:
      */
     BOOST_MYSQL_DECL pipeline_request& add_set_character_set(character_set charset);
 
+    /**
+     * \brief (EXPERIMENTAL) Retrieves how the responses of execution stages are stored.
+     * \details
+     * See \ref set_response_mode.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Experimental
+     * This part of the API is experimental, and may change in successive
+     * releases without previous notice.
+     */
+    pipeline_response_mode response_mode() const noexcept { return impl_.response_mode_; }
+
+    /**
+     * \brief (EXPERIMENTAL) Sets how the responses of execution stages are stored.
+     * \details
+     * By default (\ref pipeline_response_mode::results), every stage created by
+     * \ref add_execute or \ref add_execute_range stores its response in a \ref results object.
+     * This requires allocating memory for every execution stage, even if the stage doesn't return rows.
+     * \n
+     * With \ref pipeline_response_mode::summary, these stages store an \ref execution_summary instead.
+     * Any rows and metadata sent by the server are read and discarded. This avoids per-stage
+     * allocations, and is useful for large pipelines where only errors and
+     * affected rows are relevant.
+     * \n
+     * The mode applies to all the execution stages in the request, regardless of whether they were added
+     * before or after calling this function. Stages created by \ref add_execute_batch always
+     * store an \ref execution_summary. Other stage kinds are not affected.
+     * \ref clear does not change the response mode.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Experimental
+     * This part of the API is experimental, and may change in successive
+     * releases without previous notice.
+     */
+    pipeline_request& set_response_mode(pipeline_response_mode mode) noexcept
+    {
+        impl_.response_mode_ = mode;
+        return *this;
+    }
+
     /**
      * \brief Removes all stages in the pipeline request, making the object empty again.
      * \details
@@ -10,6 +10,7 @@
 
 #include <boost/mysql/any_address.hpp>
 #include <boost/mysql/defaults.hpp>
+#include <boost/mysql/pool_stats.hpp>
 #include <boost/mysql/ssl_mode.hpp>
 
 #include <boost/mysql/detail/access.hpp>
@@ -17,11 +18,14 @@
 #include <boost/asio/any_io_executor.hpp>
 #include <boost/asio/ssl/context.hpp>
 #include <boost/asio/strand.hpp>
+#include <boost/container/container_fwd.hpp>
 #include <boost/optional/optional.hpp>
 
 #include <chrono>
 #include <cstddef>
+#include <functional>
 #include <string>
+#include <vector>
 
 namespace boost {
 namespace mysql {
@@ -116,6 +120,82 @@ struct pool_params
     /// Initial size (in bytes) of the internal buffer for the connections created by the pool.
     std::size_t initial_buffer_size{default_initial_read_buffer_size};
 
+    /**
+     * \brief The size above which connection buffers are shrunk when connections are returned.
+     * \details
+     * Connections returned to the pool are reset before being handed to other users.
+     * If, at that point, a connection's buffers are bigger than this value (e.g. because
+     * it was used to read a big resultset), their memory is released and they go back to
+     * \ref initial_buffer_size bytes. Connections returned using
+     * \ref pooled_connection::return_without_reset are not reset and keep their buffers.
+     * \n
+     * Disabled by default. See \ref any_connection_params::buffer_shrink_threshold.
+     */
+    std::size_t buffer_shrink_threshold{static_cast<std::size_t>(-1)};
+
+    /**
+     * \brief A memory resource to allocate connection read buffers from.
+     * \details
+     * If set to a non-null value, connections created by the pool will obtain memory
+     * for their read buffers from this resource.
+     * See \ref any_connection_params::buffer_memory_resource.
+     *
+     * \par Object lifetimes
+     * If set to non-null, the pointee object must be kept alive until the pool
+     * and all the connections it created are destroyed.
+     */
+    container::pmr::memory_resource* buffer_memory_resource{};
+
+    /**
+     * \brief The maximum number of statements kept by each connection's statement cache.
+     * \details
+     * Connections returned to the pool are reset, which deallocates their prepared statements
+     * and clears their cache. Connections returned using \ref pooled_connection::return_without_reset
+     * keep their cached statements. Must be greater than zero.
+     * See \ref any_connection_params::statement_cache_size.
+     */
+    std::size_t statement_cache_size{64};
+
+    /**
+     * \brief SQL statements to be prepared in every connection created by the pool.
+     * \details
+     * Each statement in this list is prepared in every connection after it's established,
+     * and every time it's reset. Prepares are pipelined with the reset, so they don't
+     * incur in extra round-trips. The resulting statements can be obtained using
+     * \ref pooled_connection::prepared_statement, using their index in this list.
+     * \n
+     * Statements must be valid SQL. If a statement fails to prepare after the connection
+     * is established, this is considered a connection establishment failure:
+     * the connection is re-established after \ref retry_interval, and the error is reported
+     * by \ref connection_pool::async_get_connection. If it fails when the connection is reset,
+     * the connection is considered faulty and re-established.
+     */
+    std::vector<std::string> prepared_statements;
+
+    /**
+     * \brief Whether to skip session resets when the session state didn't change.
+     * \details
+     * By default, connections returned to the pool are reset (unless
+     * \ref pooled_connection::return_without_reset is used), which costs a round-trip.
+     * If this option is `true`, the pool enables server-side session state tracking
+     * (via the `session_track_state_change` system variable) when connections are established
+     * and reset. Returned connections are then only reset if the server reported a session
+     * state change (like setting variables, creating temporary tables or changing the
+     * default database), a transaction is active, or statements were prepared using
+     * \ref any_connection::async_prepare_statement. Connections used only for plain queries
+     * don't incur in the reset round-trip. Connections returned in the middle of an operation
+     * (e.g. with unread rows, an open cursor or after a cancelled operation) are always reset.
+     * \n
+     * Session state tracking is negotiated by every connection, regardless of this option
+     * (see \ref results::session_track). This option enables the server-side tracking
+     * of state changes for the pool's connections.
+     * If the server doesn't support session state tracking, connections are always reset.
+     * This option requires MySQL 5.7+ or MariaDB 10.2+. Connection establishment
+     * will fail with older servers, and will be retried after \ref retry_interval.
+     * Defaults to `false`.
+     */
+    bool lazy_reset{false};
+
     /**
      * \brief Initial number of connections to create.
      * \details
@@ -138,6 +218,18 @@ struct pool_params
      */
     std::size_t max_size{151};
 
+    /**
+     * \brief Minimum number of idle connections to maintain.
+     * \details
+     * While the pool is running, it will create new connections in the background
+     * (concurrently, if required) so that at least `min_idle` connections are
+     * either idle or being established. This prevents requests from paying the cost of
+     * session establishment after a traffic spike. `max_size` is always respected.
+     * \n
+     * This value must be `<= max_size`. The default value of zero disables this feature.
+     */
+    std::size_t min_idle{0};
+
     /**
      * \brief The SSL context to use for connections using TLS.
      * \details
@@ -201,6 +293,60 @@ struct pool_params
      * This value must not be negative.
      */
     std::chrono::steady_clock::duration ping_timeout{std::chrono::seconds(10)};
+
+    /**
+     * \brief The time a connection may stay idle before being closed.
+     * \details
+     * If a connection has been idle for longer than `idle_timeout` and the pool
+     * holds more than `std::max(initial_size, min_idle)` connections, the connection
+     * will be closed and removed from the pool. This allows the pool to shrink back
+     * after a traffic spike.
+     * \n
+     * Set this interval to zero (the default) to disable it.
+     * \n
+     * This value must not be negative.
+     */
+    std::chrono::steady_clock::duration idle_timeout{0};
+
+    /**
+     * \brief The maximum time a connection may stay open.
+     * \details
+     * Connections that have been open for longer than `max_lifetime` are closed
+     * and re-established. Connections are never recycled while in use: a connection
+     * that expires while in use is recycled once it's returned to the pool.
+     * This is useful when working with proxies and load balancers that drop
+     * long-lived connections, or to rebalance connections after a failover.
+     * \n
+     * Each connection's lifetime is shortened by a random amount of up to 1/8 of
+     * `max_lifetime`, to avoid re-establishing all connections at the same time.
+     * \n
+     * Set this interval to zero (the default) to disable it.
+     * \n
+     * This value must not be negative.
+     */
+    std::chrono::steady_clock::duration max_lifetime{0};
+
+    /**
+     * \brief A function to be called with latency samples.
+     * \details
+     * If set, the pool calls this function each time a connection is handed to the user
+     * (reporting the time the request spent waiting) and each time a session is
+     * established or reset (reporting the time the operation took). This allows
+     * recording latencies in histograms, to tell pool starvation apart from server latency.
+     * See \ref connection_pool::stats for aggregated values.
+     * \n
+     * The function is invoked from within the pool's executor. It should not throw
+     * and should return quickly.
+     * \n
+     * When used with a \ref sharded_connection_pool, the function is copied into every shard,
+     * and each shard invokes it from within its own strand. Calls may thus happen
+     * concurrently from different threads, and the function must be thread-safe.
+     * If it holds state (like a histogram), make sure that copies share it safely
+     * (e.g. via a `std::shared_ptr` to a structure using atomics or a mutex).
+     * \n
+     * By default, no function is set.
+     */
+    std::function<void(pool_latency_kind, std::chrono::steady_clock::duration)> latency_observer;
 };
 
 }  // namespace mysql
@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_POOL_STATS_HPP
+#define BOOST_MYSQL_POOL_STATS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) A point-in-time snapshot of a connection pool's state and counters.
+ * \details
+ * Obtained by calling \ref connection_pool::stats. Gauges (`num_xxx` members without
+ * the `total` prefix) reflect the state of the pool when the snapshot was taken.
+ * Counters (members with the `total` prefix) are accumulated since the pool was created.
+ * \n
+ * Members are read individually, so they may be slightly inconsistent
+ * with each other if the pool is being used concurrently.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+struct pool_stats
+{
+    /// The number of connections owned by the pool, in any state.
+    std::size_t num_connections{};
+
+    /// The number of connections that are idle and ready to be handed to the user.
+    std::size_t num_idle{};
+
+    /// The number of connections that are currently in use by the user.
+    std::size_t num_in_use{};
+
+    /// The number of connections being established, reset or pinged.
+    std::size_t num_pending{};
+
+    /// The number of `async_get_connection` requests waiting for a connection to become available.
+    std::size_t num_waiting_requests{};
+
+    /// The number of connections successfully handed to the user.
+    std::uint64_t total_checkouts{};
+
+    /// The number of `async_get_connection` requests that failed because they timed out.
+    std::uint64_t total_checkout_timeouts{};
+
+    /// The time spent by successful `async_get_connection` requests waiting for a connection.
+    std::chrono::steady_clock::duration total_checkout_wait_time{};
+
+    /// The number of successful connection establishments.
+    std::uint64_t total_connects{};
+
+    /// The number of failed connection establishments.
+    std::uint64_t total_connect_errors{};
+
+    /// The number of session resets performed, both successful and failed.
+    std::uint64_t total_resets{};
+
+    /// The number of failed session resets.
+    std::uint64_t total_reset_errors{};
+
+    /// The number of session resets skipped because the session was clean (see \ref pool_params::lazy_reset).
+    std::uint64_t total_skipped_resets{};
+
+    /// The time spent performing session resets.
+    std::chrono::steady_clock::duration total_reset_time{};
+};
+
+/**
+ * \brief (EXPERIMENTAL) Identifies the kind of a latency sample reported by a connection pool.
+ * \details
+ * See \ref pool_params::latency_observer.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+enum class pool_latency_kind
+{
+    /// Time spent by a successful `async_get_connection` request waiting for a connection.
+    checkout_wait,
+
+    /// Time spent establishing a session, successfully or not.
+    connect,
+
+    /// Time spent resetting a session, successfully or not.
+    reset,
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
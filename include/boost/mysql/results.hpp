@@ -12,6 +12,7 @@
 #include <boost/mysql/resultset.hpp>
 #include <boost/mysql/resultset_view.hpp>
 #include <boost/mysql/rows_view.hpp>
+#include <boost/mysql/session_track_view.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/access.hpp>
@@ -283,6 +284,36 @@ public:
         return impl_.get_info(0);
     }
 
+    /**
+     * \brief Returns the session state changes reported by the server when executing the SQL statement.
+     * \details
+     * Session state changes are only reported if the server supports session tracking
+     * and the relevant `session_track_xxx` system variables are enabled. Otherwise,
+     * the returned view is empty. See \ref session_track_view for more info.
+     * \n
+     * For operations returning more than one resultset, returns the
+     * first resultset's session state changes.
+     *
+     * \par Preconditions
+     * `this->has_value() == true`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * This function returns a view object, with reference semantics. The returned view points into
+     * memory owned by `*this`, and will be valid as long as `*this` or an object move-constructed
+     * from `*this` are alive.
+     *
+     * \par Complexity
+     * Constant.
+     */
+    session_track_view session_track() const noexcept
+    {
+        BOOST_ASSERT(has_value());
+        return impl_.get_session_track(0);
+    }
+
     /**
      * \brief Returns an iterator pointing to the first resultset that this object contains.
      * \par Preconditions
@@ -13,7 +13,9 @@
 #include <boost/mysql/resultset_view.hpp>
 #include <boost/mysql/row_view.hpp>
 #include <boost/mysql/rows.hpp>
+#include <boost/mysql/session_track_view.hpp>
 
+#include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/config.hpp>
 
 #include <boost/assert.hpp>
@@ -263,6 +265,32 @@ public:
         return string_view(info_.data(), info_.size());
     }
 
+    /**
+     * \brief Returns the session state changes reported by the server for this resultset.
+     * \details
+     * Session state changes are only reported if the server supports session tracking
+     * and the relevant `session_track_xxx` system variables are enabled. Otherwise,
+     * the returned view is empty. See \ref session_track_view for more info.
+     *
+     * \par Preconditions
+     * `this->has_value() == true`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * The returned view and any other references obtained from it are valid as long as
+     * `*this`  or an object move-constructed from `*this` are alive.
+     *
+     * \par Complexity
+     * Constant.
+     */
+    session_track_view session_track() const noexcept
+    {
+        BOOST_ASSERT(has_value_);
+        return detail::access::construct<session_track_view>(session_track_.data(), session_track_.size());
+    }
+
     /**
      * \brief Returns whether this resultset represents a procedure OUT params.
      * \par Preconditions
@@ -288,6 +316,7 @@ private:
     std::uint64_t last_insert_id_{};
     std::uint16_t warnings_{};
     std::vector<char> info_;
+    std::vector<std::uint8_t> session_track_;
     bool is_out_params_{false};
 
     BOOST_MYSQL_DECL
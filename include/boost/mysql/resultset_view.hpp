@@ -10,6 +10,7 @@
 
 #include <boost/mysql/metadata_collection_view.hpp>
 #include <boost/mysql/rows_view.hpp>
+#include <boost/mysql/session_track_view.hpp>
 
 #include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/execution_processor/results_impl.hpp>
@@ -169,6 +170,32 @@ public:
         return impl_->get_info(index_);
     }
 
+    /**
+     * \brief Returns the session state changes reported by the server for this resultset.
+     * \details
+     * Session state changes are only reported if the server supports session tracking
+     * and the relevant `session_track_xxx` system variables are enabled. Otherwise,
+     * the returned view is empty. See \ref session_track_view for more info.
+     *
+     * \par Preconditions
+     * `this->has_value() == true`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * The returned view and any other references obtained from it are valid as long as
+     * the object that `*this` points to is alive.
+     *
+     * \par Complexity
+     * Constant.
+     */
+    session_track_view session_track() const noexcept
+    {
+        BOOST_ASSERT(has_value());
+        return impl_->get_session_track(index_);
+    }
+
     /**
      * \brief Returns whether this resultset represents a procedure OUT params.
      * \par Preconditions
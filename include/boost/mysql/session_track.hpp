@@ -0,0 +1,88 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_SESSION_TRACK_HPP
+#define BOOST_MYSQL_SESSION_TRACK_HPP
+
+#include <boost/mysql/string_view.hpp>
+
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief The type of a session state change reported by the server.
+ * \details
+ * The server reports session state changes when the `session_track_xxx` system variables are enabled.
+ * See <a href="https://dev.mysql.com/doc/refman/8.0/en/session-state-tracking.html">the MySQL docs</a>
+ * for more info.
+ * \n
+ * Servers may report types not listed here. These are exposed without further interpretation.
+ */
+enum class session_track_type : std::uint8_t
+{
+    /// A system variable changed. Enabled by `session_track_system_variables`.
+    system_variable = 0,
+
+    /// The default schema changed. Enabled by `session_track_schema`.
+    schema = 1,
+
+    /// The session state changed. Enabled by `session_track_state_change`.
+    state_change = 2,
+
+    /// The set of GTIDs changed. Enabled by `session_track_gtids`.
+    gtids = 3,
+
+    /// The characteristics of the current transaction. Enabled by `session_track_transaction_info`.
+    transaction_characteristics = 4,
+
+    /// The state of the current transaction. Enabled by `session_track_transaction_info`.
+    transaction_state = 5,
+};
+
+/**
+ * \brief A session state change reported by the server.
+ * \details
+ * Obtained by iterating a \ref session_track_view.
+ *
+ * \par Object lifetimes
+ * Strings point into the storage owned by the object the \ref session_track_view was obtained from.
+ */
+struct session_track_item
+{
+    /// The type of the change.
+    session_track_type type;
+
+    /**
+     * \brief The name of the system variable that changed.
+     * \details
+     * Only set if `type == session_track_type::system_variable`. Otherwise, empty.
+     */
+    string_view name;
+
+    /**
+     * \brief The value associated to the change.
+     * \details
+     * Its meaning depends on `type`:
+     * \n
+     * \li `system_variable`: the new value of the variable.
+     * \li `schema`: the name of the new default schema.
+     * \li `state_change`: `"1"` if the session state changed.
+     * \li `gtids`: the GTID set, as reported by the server.
+     * \li `transaction_characteristics`: SQL statements that restart the transaction with
+     *     the same characteristics.
+     * \li `transaction_state`: a string of 8 characters, describing the current transaction's state.
+     * \li Other types: the raw data sent by the server.
+     */
+    string_view value;
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
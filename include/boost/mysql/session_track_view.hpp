@@ -0,0 +1,121 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_SESSION_TRACK_VIEW_HPP
+#define BOOST_MYSQL_SESSION_TRACK_VIEW_HPP
+
+#include <boost/mysql/session_track.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/session_track_iterator.hpp>
+
+#include <boost/core/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief A non-owning, read-only reference to the session state changes reported by the server.
+ * \details
+ * Models a forward range of \ref session_track_item objects. Items are parsed lazily
+ * from the data sent by the server in OK packets when the session state changes.
+ * The server only reports changes if session tracking is supported (MySQL 5.7+ and MariaDB 10.2+)
+ * and the relevant `session_track_xxx` system variables are enabled. For instance, running
+ * `SET session_track_gtids = OWN_GTID` makes the server report the GTIDs
+ * of the transactions committed by your session, making a `SELECT @@gtid_executed` unnecessary.
+ * \n
+ * A `session_track_view` points to memory owned by an external entity
+ * (typically a \ref results or \ref execution_state object).
+ * It's valid as long as the object it was obtained from is alive and hasn't been
+ * used for another operation.
+ * \n
+ * Instances of this class are created by the library, not by the user.
+ */
+class session_track_view
+{
+public:
+#ifdef BOOST_MYSQL_DOXYGEN
+    /**
+     * \brief A forward iterator to an element.
+     * \details The exact type of the iterator is unspecified.
+     */
+    using iterator = __see_below__;
+#else
+    using iterator = detail::session_track_iterator;
+#endif
+
+    /// \copydoc iterator
+    using const_iterator = iterator;
+
+    /// The type of the elements in this collection.
+    using value_type = session_track_item;
+
+    /// The reference type.
+    using reference = const session_track_item&;
+
+    /// \copydoc reference
+    using const_reference = const session_track_item&;
+
+    /**
+     * \brief Constructs an empty view.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    session_track_view() = default;
+
+    /**
+     * \brief Returns an iterator to the first element in the collection.
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Complexity
+     * Constant.
+     */
+    iterator begin() const noexcept { return iterator(impl_.data(), impl_.data() + impl_.size()); }
+
+    /**
+     * \brief Returns an iterator to one-past-the-last element in the collection.
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Complexity
+     * Constant.
+     */
+    iterator end() const noexcept
+    {
+        return iterator(impl_.data() + impl_.size(), impl_.data() + impl_.size());
+    }
+
+    /**
+     * \brief Returns true if there are no elements in the collection.
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Complexity
+     * Constant.
+     */
+    bool empty() const noexcept { return impl_.empty(); }
+
+private:
+    // The raw session state information, as sent by the server
+    span<const std::uint8_t> impl_;
+
+    session_track_view(const std::uint8_t* data, std::size_t size) noexcept : impl_(data, size) {}
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
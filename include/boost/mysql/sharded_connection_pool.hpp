@@ -0,0 +1,342 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_SHARDED_CONNECTION_POOL_HPP
+#define BOOST_MYSQL_SHARDED_CONNECTION_POOL_HPP
+
+#include <boost/mysql/connection_pool.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/pool_params.hpp>
+#include <boost/mysql/pool_stats.hpp>
+#include <boost/mysql/with_diagnostics.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/connection_pool_fwd.hpp>
+#include <boost/mysql/detail/initiation_base.hpp>
+
+#include <boost/asio/any_completion_handler.hpp>
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/async_result.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) A thread-safe connection pool split into independent shards.
+ * \details
+ * A sharded pool contains `num_shards` independent pools (shards), each one running
+ * within its own strand and owning a fraction of the pool's connections. This
+ * avoids the contention caused by the single strand used by thread-safe \ref connection_pool
+ * objects when many threads request connections concurrently.
+ * \n
+ * Each thread has a preferred shard. \ref async_get_connection requests a connection
+ * to the preferred shard if it has idle connections. Otherwise, the request is sent to
+ * the first shard having idle connections (work stealing). If no shard has idle connections,
+ * the request is sent to the preferred shard, which will wait for a connection to become available.
+ * Selecting a shard doesn't require acquiring any lock.
+ * \n
+ * `params.initial_size` and `params.max_size` are split between shards. Each shard
+ * is otherwise configured by `params`. Connections are returned to the shard that created them.
+ * \n
+ * Sharded pools are always thread-safe. This is a move-only type.
+ *
+ * \par Thread-safety
+ * Distinct objects: safe. \n
+ * Shared objects: safe, except for move operations and \ref valid.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class sharded_connection_pool
+{
+    std::shared_ptr<detail::sharded_pool_impl> impl_;
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+
+    static constexpr std::chrono::steady_clock::duration get_default_timeout() noexcept
+    {
+        return std::chrono::seconds(30);
+    }
+
+    struct initiate_run : detail::initiation_base
+    {
+        using detail::initiation_base::initiation_base;
+
+        // Having diagnostics* here makes async_run compatible with with_diagnostics
+        template <class Handler>
+        void operator()(Handler&& h, diagnostics*, std::shared_ptr<detail::sharded_pool_impl> self)
+        {
+            async_run_erased(std::move(self), std::forward<Handler>(h));
+        }
+    };
+
+    BOOST_MYSQL_DECL
+    static void async_run_erased(
+        std::shared_ptr<detail::sharded_pool_impl> pool,
+        asio::any_completion_handler<void(error_code)> handler
+    );
+
+    struct initiate_get_connection : detail::initiation_base
+    {
+        using detail::initiation_base::initiation_base;
+
+        template <class Handler>
+        void operator()(
+            Handler&& h,
+            diagnostics* diag,
+            std::shared_ptr<detail::sharded_pool_impl> self,
+            std::chrono::steady_clock::duration timeout
+        )
+        {
+            async_get_connection_erased(std::move(self), timeout, diag, std::forward<Handler>(h));
+        }
+    };
+
+    BOOST_MYSQL_DECL
+    static void async_get_connection_erased(
+        std::shared_ptr<detail::sharded_pool_impl> pool,
+        std::chrono::steady_clock::duration timeout,
+        diagnostics* diag,
+        asio::any_completion_handler<void(error_code, pooled_connection)> handler
+    );
+
+    template <class CompletionToken>
+    auto async_get_connection_impl(
+        std::chrono::steady_clock::duration timeout,
+        diagnostics* diag,
+        CompletionToken&& token
+    )
+        -> decltype(asio::async_initiate<CompletionToken, void(error_code, pooled_connection)>(
+            std::declval<initiate_get_connection>(),
+            token,
+            diag,
+            impl_,
+            timeout
+        ))
+    {
+        BOOST_ASSERT(valid());
+        return asio::async_initiate<CompletionToken, void(error_code, pooled_connection)>(
+            initiate_get_connection{get_executor()},
+            token,
+            diag,
+            impl_,
+            timeout
+        );
+    }
+
+    BOOST_MYSQL_DECL
+    sharded_connection_pool(asio::any_io_executor ex, pool_params&& params, std::size_t num_shards, int);
+
+public:
+    /**
+     * \brief Constructs a sharded connection pool.
+     * \details
+     * Creates `num_shards` shards, splitting `params.initial_size` and `params.max_size` between them.
+     * Each shard uses a strand wrapping `ex` for its internal I/O objects, and `ex` for its connections.
+     * Otherwise, the same as the \ref connection_pool constructor.
+     *
+     * \par Exception safety
+     * Strong guarantee. Exceptions may be thrown by memory allocations.
+     * \throws std::invalid_argument In the same cases as \ref connection_pool, if `num_shards == 0`
+     *         or if `params.max_size < num_shards`.
+     */
+    sharded_connection_pool(asio::any_io_executor ex, pool_params params, std::size_t num_shards)
+        : sharded_connection_pool(std::move(ex), std::move(params), num_shards, 0)
+    {
+    }
+
+    /**
+     * \brief Constructs a sharded connection pool.
+     * \details
+     * Equivalent to `sharded_connection_pool(ctx.get_executor(), std::move(params), num_shards)`.
+     * Participates in overload resolution under the same conditions as the equivalent
+     * \ref connection_pool constructor.
+     */
+    template <
+        class ExecutionContext
+#ifndef BOOST_MYSQL_DOXYGEN
+        ,
+        class = typename std::enable_if<std::is_convertible<
+            decltype(std::declval<ExecutionContext&>().get_executor()),
+            asio::any_io_executor>::value>::type
+#endif
+        >
+    sharded_connection_pool(ExecutionContext& ctx, pool_params params, std::size_t num_shards)
+        : sharded_connection_pool(ctx.get_executor(), std::move(params), num_shards, 0)
+    {
+    }
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    sharded_connection_pool(const sharded_connection_pool&) = delete;
+    sharded_connection_pool& operator=(const sharded_connection_pool&) = delete;
+#endif
+
+    /// Move-constructor. Same semantics as \ref connection_pool's.
+    sharded_connection_pool(sharded_connection_pool&& other) = default;
+
+    /// Move assignment. Same semantics as \ref connection_pool's.
+    sharded_connection_pool& operator=(sharded_connection_pool&& other) = default;
+
+    /// Destructor.
+    ~sharded_connection_pool() = default;
+
+    /// Returns whether the object is in a moved-from state. See \ref connection_pool::valid.
+    bool valid() const noexcept { return impl_.get() != nullptr; }
+
+    /// The executor type associated to this object.
+    using executor_type = asio::any_io_executor;
+
+    /**
+     * \brief Retrieves the executor associated to this object.
+     * \details
+     * Returns a strand wrapping the executor passed to the constructor.
+     * This strand is only used to coordinate shards in \ref async_run.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    BOOST_MYSQL_DECL
+    executor_type get_executor() noexcept;
+
+    /**
+     * \brief Returns the number of shards in this pool.
+     * \par Preconditions
+     * `this->valid() == true`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    BOOST_MYSQL_DECL
+    std::size_t num_shards() const noexcept;
+
+    /**
+     * \brief Returns a snapshot of the pool's state and accumulated counters, summed over all shards.
+     * \details
+     * Shards are read one after another, so the sum is not an atomic snapshot of the entire pool.
+     * Otherwise, the same as \ref connection_pool::stats.
+     */
+    BOOST_MYSQL_DECL
+    pool_stats stats() const noexcept;
+
+    /**
+     * \brief Runs the tasks in charge of managing connections in all shards.
+     * \details
+     * Equivalent to \ref connection_pool::async_run, for all shards.
+     * The operation completes once all shards have been cancelled
+     * and all their internal operations have completed.
+     */
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_run(CompletionToken&& token = {})
+        BOOST_MYSQL_RETURN_TYPE(decltype(asio::async_initiate<CompletionToken, void(error_code)>(
+            std::declval<initiate_run>(),
+            token,
+            static_cast<diagnostics*>(nullptr),
+            impl_
+        )))
+    {
+        BOOST_ASSERT(valid());
+        return asio::async_initiate<CompletionToken, void(error_code)>(
+            initiate_run{get_executor()},
+            token,
+            static_cast<diagnostics*>(nullptr),
+            impl_
+        );
+    }
+
+    /// \copydoc async_get_connection(std::chrono::steady_clock::duration,diagnostics&,CompletionToken&&)
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::pooled_connection))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_get_connection(CompletionToken&& token = {}) BOOST_MYSQL_RETURN_TYPE(
+        decltype(async_get_connection_impl({}, nullptr, std::forward<CompletionToken>(token)))
+    )
+    {
+        return async_get_connection_impl(
+            get_default_timeout(),
+            nullptr,
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /// \copydoc async_get_connection(std::chrono::steady_clock::duration,diagnostics&,CompletionToken&&)
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::pooled_connection))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_get_connection(diagnostics& diag, CompletionToken&& token = {}) BOOST_MYSQL_RETURN_TYPE(
+        decltype(async_get_connection_impl({}, nullptr, std::forward<CompletionToken>(token)))
+    )
+    {
+        return async_get_connection_impl(get_default_timeout(), &diag, std::forward<CompletionToken>(token));
+    }
+
+    /// \copydoc async_get_connection(std::chrono::steady_clock::duration,diagnostics&,CompletionToken&&)
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::pooled_connection))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_get_connection(std::chrono::steady_clock::duration timeout, CompletionToken&& token = {})
+        BOOST_MYSQL_RETURN_TYPE(
+            decltype(async_get_connection_impl({}, nullptr, std::forward<CompletionToken>(token)))
+        )
+    {
+        return async_get_connection_impl(timeout, nullptr, std::forward<CompletionToken>(token));
+    }
+
+    /**
+     * \brief Retrieves a connection from the pool.
+     * \details
+     * Selects a shard as described in the class documentation and retrieves
+     * a connection from it, with the same semantics as \ref connection_pool::async_get_connection.
+     * The connection is returned to its shard when the \ref pooled_connection is destroyed.
+     *
+     * \par Executor
+     * This function will run entirely in the selected shard's strand.
+     */
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::pooled_connection))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_get_connection(
+        std::chrono::steady_clock::duration timeout,
+        diagnostics& diag,
+        CompletionToken&& token = {}
+    )
+        BOOST_MYSQL_RETURN_TYPE(
+            decltype(async_get_connection_impl({}, nullptr, std::forward<CompletionToken>(token)))
+        )
+    {
+        return async_get_connection_impl(timeout, &diag, std::forward<CompletionToken>(token));
+    }
+
+    /**
+     * \brief Cancels all shards.
+     * \details
+     * Equivalent to calling \ref connection_pool::cancel on every shard.
+     */
+    BOOST_MYSQL_DECL
+    void cancel();
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/sharded_connection_pool.ipp>
+#endif
+
+#endif
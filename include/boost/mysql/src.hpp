@@ -19,8 +19,10 @@
 #endif
 
 #include <boost/mysql/impl/any_connection.ipp>
+#include <boost/mysql/impl/arrow_execution_state_impl.ipp>
 #include <boost/mysql/impl/character_set.ipp>
 #include <boost/mysql/impl/column_type.ipp>
+#include <boost/mysql/impl/columnar_results_impl.ipp>
 #include <boost/mysql/impl/connection_impl.ipp>
 #include <boost/mysql/impl/connection_pool.ipp>
 #include <boost/mysql/impl/date.ipp>
@@ -41,6 +43,8 @@
 #include <boost/mysql/impl/results_impl.ipp>
 #include <boost/mysql/impl/resultset.ipp>
 #include <boost/mysql/impl/row_impl.ipp>
+#include <boost/mysql/impl/session_track_iterator.ipp>
+#include <boost/mysql/impl/sharded_connection_pool.ipp>
 #include <boost/mysql/impl/static_execution_state_impl.ipp>
 #include <boost/mysql/impl/static_results_impl.ipp>
 
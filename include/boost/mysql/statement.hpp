@@ -8,10 +8,13 @@
 #ifndef BOOST_MYSQL_STATEMENT_HPP
 #define BOOST_MYSQL_STATEMENT_HPP
 
+#include <boost/mysql/field_view.hpp>
+
 #include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/writable_field_traits.hpp>
 
 #include <boost/assert.hpp>
+#include <boost/core/span.hpp>
 
 #include <cstdint>
 #include <tuple>
@@ -38,6 +41,18 @@ class bound_statement_tuple;
 template <BOOST_MYSQL_FIELD_VIEW_FORWARD_ITERATOR FieldViewFwdIterator>
 class bound_statement_iterator_range;
 
+/**
+ * \brief (EXPERIMENTAL) A statement bound to several rows of parameters, executed once per row.
+ * \details
+ * This class satisfies `ExecutionRequest`. Objects of this type are created using
+ * \ref statement::bind_batch.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class bound_statement_batch;
+
 /**
  * \brief Represents a server-side prepared statement.
  * \details
@@ -185,6 +200,54 @@ public:
         FieldViewFwdIterator params_last
     ) const;
 
+    /**
+     * \brief (EXPERIMENTAL) Binds several rows of parameters to a statement, to execute it once per row.
+     * \details
+     * Creates an object that packages `*this` and the parameters `params`, which are interpreted
+     * as a sequence of rows, each one containing `this->num_params()` parameters (row-major order).
+     * This object can be passed to \ref any_connection::execute, \ref any_connection::start_execution
+     * and their async counterparts. The statement is executed once per row, and the result is
+     * a single resultset without rows. Its `affected_rows` and `warning_count` are the sum
+     * of the individual executions', and `last_insert_id` is the first non-zero ID generated.
+     * \n
+     * This is intended for statements that don't return rows, like `INSERT` or `UPDATE`.
+     * If any execution returns rows, the operation fails with \ref client_errc::batch_returned_rows.
+     * This is the case for both MySQL and MariaDB.
+     * \n
+     * With MariaDB, all rows are sent in a single `COM_STMT_BULK_EXECUTE` request, as long as
+     * all non-NULL values for a given parameter have the same type. Otherwise, and with MySQL,
+     * one execution request per row is sent in a single write, and all responses are read together.
+     * In both cases, a single round-trip is performed. If any execution fails, the first error is
+     * reported. Executions are independent of each other, so a failure doesn't prevent the
+     * remaining rows from being executed (except with MariaDB's bulk requests).
+     * Wrap the batch in a transaction if you need atomicity.
+     * \n
+     * All rows are serialized in a single buffer, subject to \ref any_connection_params::max_buffer_size.
+     * Split very large batches into several smaller ones.
+     * Parameters sent using \ref any_connection::send_long_data are not supported. If any of the
+     * statement's parameters has pending long data, the execution fails with
+     * \ref client_errc::batch_with_long_data, without sending anything to the server.
+     * \n
+     * If `params.size()` is zero or not a multiple of `this->num_params()`, the execution
+     * fails with \ref client_errc::wrong_num_params. This function doesn't involve communication
+     * with the server.
+     *
+     * \par Preconditions
+     * `this->valid() == true`
+     *
+     * \par Object lifetimes
+     * The returned object doesn't own `params`, which should be kept alive until
+     * the execution operation completes.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Experimental
+     * This part of the API is experimental, and may change in successive
+     * releases without previous notice.
+     */
+    inline bound_statement_batch bind_batch(span<const field_view> params) const noexcept;
+
 private:
     bool valid_{false};
     std::uint32_t id_{0};
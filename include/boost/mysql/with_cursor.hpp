@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_WITH_CURSOR_HPP
+#define BOOST_MYSQL_WITH_CURSOR_HPP
+
+#include <boost/assert.hpp>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief A bound statement that is executed using a server-side cursor.
+ * \details
+ * Satisfies `ExecutionRequest` and can thus be passed to \ref any_connection::execute,
+ * \ref any_connection::start_execution and its async counterparts.
+ * \n
+ * When executed, the statement is run with a read-only cursor. Instead of sending all
+ * the rows at once, the server sends rows in batches of `fetch_size` rows, as they are requested
+ * by \ref any_connection::read_some_rows. This bounds the amount of memory used by both the
+ * client and the network buffers, since the server will never send more than `fetch_size`
+ * rows that the client hasn't asked for. Each batch requires a round-trip to the server,
+ * so `fetch_size` trades memory for latency.
+ * \n
+ * Cursors are only supported by statements that produce a single resultset
+ * (e.g. `SELECT` statements). The server ignores the cursor for other statements,
+ * and they are executed normally.
+ * \n
+ * Objects of this type are usually created using \ref with_cursor.
+ *
+ * \par Object lifetimes
+ * `stmt` is stored by value, and follows the same rules as the bound statement types
+ * returned by \ref statement::bind.
+ */
+template <class BoundStatement>
+struct with_cursor_t
+{
+    /// The bound statement to execute, as returned by \ref statement::bind.
+    BoundStatement stmt;
+
+    /// The number of rows to request to the server each time. Must not be zero.
+    std::uint32_t fetch_size;
+};
+
+/**
+ * \brief Creates a bound statement that will be executed using a server-side cursor.
+ * \details
+ * `stmt` should be a bound statement, as returned by \ref statement::bind.
+ * It is decay-copied into the resulting object.
+ * \n
+ * See \ref with_cursor_t for details on how the execution request works.
+ * This function does not involve communication with the server.
+ *
+ * \par Preconditions
+ * `fetch_size > 0`
+ *
+ * \par Exception safety
+ * Strong guarantee. Any exception thrown when copying `stmt` will be propagated.
+ */
+template <class BoundStatement>
+with_cursor_t<typename std::decay<BoundStatement>::type> with_cursor(
+    BoundStatement&& stmt,
+    std::uint32_t fetch_size
+)
+{
+    BOOST_ASSERT(fetch_size > 0u);
+    return {std::forward<BoundStatement>(stmt), fetch_size};
+}
+
+}  // namespace mysql
+}  // namespace boost
+
+#include <boost/mysql/impl/with_cursor.hpp>
+
+#endif
@@ -0,0 +1,52 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_TEST_UNIT_INCLUDE_TEST_UNIT_COUNTING_MEMORY_RESOURCE_HPP
+#define BOOST_MYSQL_TEST_UNIT_INCLUDE_TEST_UNIT_COUNTING_MEMORY_RESOURCE_HPP
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <cstddef>
+#include <new>
+
+namespace boost {
+namespace mysql {
+namespace test {
+
+// A memory resource that uses operator new and keeps track of the memory it handed out
+class counting_memory_resource final : public container::pmr::memory_resource
+{
+    void* do_allocate(std::size_t bytes, std::size_t) override
+    {
+        ++num_allocations;
+        bytes_allocated += bytes;
+        return ::operator new(bytes);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t) noexcept override
+    {
+        ++num_deallocations;
+        bytes_allocated -= bytes;
+        ::operator delete(p);
+    }
+
+    bool do_is_equal(const container::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+public:
+    std::size_t num_allocations{};
+    std::size_t num_deallocations{};
+    std::size_t bytes_allocated{};
+};
+
+}  // namespace test
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -10,6 +10,7 @@
 
 #include <boost/mysql/string_view.hpp>
 
+#include <boost/mysql/impl/internal/protocol/compression.hpp>
 #include <boost/mysql/impl/internal/protocol/frame_header.hpp>
 #include <boost/mysql/impl/internal/protocol/impl/serialization_context.hpp>
 
@@ -48,6 +49,33 @@ inline std::vector<std::uint8_t> create_empty_frame(std::uint8_t seqnum)
     return create_frame(seqnum, boost::span<const std::uint8_t>());
 }
 
+// A frame of the compressed protocol, with an uncompressed payload
+inline std::vector<std::uint8_t> create_compressed_frame(
+    std::uint8_t seqnum,
+    span<const std::uint8_t> payload
+)
+{
+    BOOST_ASSERT(payload.size() <= 0xffffff);
+    std::vector<std::uint8_t> res(detail::compressed_frame_header_size);
+    detail::serialize_compressed_frame_header(
+        span<std::uint8_t, detail::compressed_frame_header_size>{
+            res.data(),
+            detail::compressed_frame_header_size
+        },
+        detail::compressed_frame_header{static_cast<std::uint32_t>(payload.size()), seqnum, 0u}
+    );
+    concat(res, payload);
+    return res;
+}
+
+inline std::vector<std::uint8_t> create_compressed_frame(
+    std::uint8_t seqnum,
+    const std::vector<std::uint8_t>& payload
+)
+{
+    return create_compressed_frame(seqnum, boost::span<const std::uint8_t>(payload));
+}
+
 }  // namespace test
 }  // namespace mysql
 }  // namespace boost
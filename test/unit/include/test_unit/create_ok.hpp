@@ -66,11 +66,27 @@ public:
         flag(detail::status_flags::no_backslash_escapes, v);
         return *this;
     }
+    ok_builder& cursor_exists(bool v) noexcept
+    {
+        flag(detail::status_flags::cursor_exists, v);
+        return *this;
+    }
+    ok_builder& last_row_sent(bool v) noexcept
+    {
+        flag(detail::status_flags::last_row_sent, v);
+        return *this;
+    }
     ok_builder& info(string_view v) noexcept
     {
         ok_.info = v;
         return *this;
     }
+    ok_builder& session_state_info(string_view v) noexcept
+    {
+        flag(detail::status_flags::session_state_changed, !v.empty());
+        ok_.session_state_info = v;
+        return *this;
+    }
     detail::ok_view build() const noexcept { return ok_; }
 };
 
@@ -30,11 +30,16 @@ inline std::vector<std::uint8_t> serialize_ok_impl(const detail::ok_view& pack,
             detail::int2{pack.status_flags},
             detail::int2{pack.warnings}
         );
-        // When info is empty, it's actually omitted in the ok_packet
-        if (!pack.info.empty())
+        // When info is empty, it's actually omitted in the ok_packet,
+        // unless session state information follows
+        if (!pack.info.empty() || !pack.session_state_info.empty())
         {
             detail::string_lenenc{pack.info}.serialize(ctx);
         }
+        if (!pack.session_state_info.empty())
+        {
+            detail::string_lenenc{pack.session_state_info}.serialize(ctx);
+        }
     });
 }
 
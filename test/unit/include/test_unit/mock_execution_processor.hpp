@@ -124,6 +124,7 @@ public:
     mock_execution_processor() = default;
     std::uint64_t affected_rows() const noexcept { return ok_packet_.affected_rows; }
     std::uint64_t last_insert_id() const noexcept { return ok_packet_.last_insert_id; }
+    unsigned warning_count() const noexcept { return ok_packet_.warnings; }
     string_view info() const noexcept { return ok_packet_.info; }
     std::size_t num_meta() const noexcept { return num_meta_; }
     const std::vector<metadata>& meta() const noexcept { return meta_; }
@@ -145,6 +146,7 @@ private:
     {
         std::uint64_t affected_rows{};
         std::uint64_t last_insert_id{};
+        std::uint16_t warnings{};
         std::string info;
     } ok_packet_{};
     std::size_t num_meta_{};
@@ -168,6 +170,7 @@ private:
     {
         ok_packet_.affected_rows = pack.affected_rows;
         ok_packet_.last_insert_id = pack.last_insert_id;
+        ok_packet_.warnings = pack.warnings;
         ok_packet_.info = pack.info;
     }
 
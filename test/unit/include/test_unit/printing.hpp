@@ -8,6 +8,7 @@
 #ifndef BOOST_MYSQL_TEST_UNIT_INCLUDE_TEST_UNIT_PRINTING_HPP
 #define BOOST_MYSQL_TEST_UNIT_INCLUDE_TEST_UNIT_PRINTING_HPP
 
+#include <cstdint>
 #include <iosfwd>
 
 namespace boost {
@@ -17,6 +18,14 @@ namespace mysql {
 enum class address_type;
 std::ostream& operator<<(std::ostream& os, address_type value);
 
+// pool_latency_kind
+enum class pool_latency_kind;
+std::ostream& operator<<(std::ostream& os, pool_latency_kind value);
+
+// session_track_type
+enum class session_track_type : std::uint8_t;
+std::ostream& operator<<(std::ostream& os, session_track_type value);
+
 namespace detail {
 
 // capabilities
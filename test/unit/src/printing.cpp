@@ -8,6 +8,8 @@
 #include <boost/mysql/any_address.hpp>
 #include <boost/mysql/character_set.hpp>
 #include <boost/mysql/error_with_diagnostics.hpp>
+#include <boost/mysql/pool_stats.hpp>
+#include <boost/mysql/session_track.hpp>
 
 #include <boost/mysql/detail/next_action.hpp>
 #include <boost/mysql/detail/pipeline.hpp>
@@ -38,6 +40,38 @@ static const char* to_string(address_type v)
 
 std::ostream& boost::mysql::operator<<(std::ostream& os, address_type v) { return os << ::to_string(v); }
 
+// pool_latency_kind
+static const char* to_string(pool_latency_kind v)
+{
+    switch (v)
+    {
+    case pool_latency_kind::checkout_wait: return "pool_latency_kind::checkout_wait";
+    case pool_latency_kind::connect: return "pool_latency_kind::connect";
+    case pool_latency_kind::reset: return "pool_latency_kind::reset";
+    default: return "<unknown pool_latency_kind>";
+    }
+}
+
+std::ostream& boost::mysql::operator<<(std::ostream& os, pool_latency_kind v) { return os << ::to_string(v); }
+
+// session_track_type
+static const char* to_string(session_track_type v)
+{
+    switch (v)
+    {
+    case session_track_type::system_variable: return "session_track_type::system_variable";
+    case session_track_type::schema: return "session_track_type::schema";
+    case session_track_type::state_change: return "session_track_type::state_change";
+    case session_track_type::gtids: return "session_track_type::gtids";
+    case session_track_type::transaction_characteristics:
+        return "session_track_type::transaction_characteristics";
+    case session_track_type::transaction_state: return "session_track_type::transaction_state";
+    default: return "<unknown session_track_type>";
+    }
+}
+
+std::ostream& boost::mysql::operator<<(std::ostream& os, session_track_type v) { return os << ::to_string(v); }
+
 // capabilities
 std::ostream& boost::mysql::detail::operator<<(std::ostream& os, const capabilities& v)
 {
@@ -110,6 +144,7 @@ static const char* to_string(detail::pipeline_stage_kind v)
     case detail::pipeline_stage_kind::reset_connection: return "pipeline_stage_kind::reset_connection";
     case detail::pipeline_stage_kind::set_character_set: return "pipeline_stage_kind::set_character_set";
     case detail::pipeline_stage_kind::ping: return "pipeline_stage_kind::ping";
+    case detail::pipeline_stage_kind::execute_batch: return "pipeline_stage_kind::execute_batch";
     default: return "<unknown pipeline_stage_kind>";
     }
 }
@@ -129,6 +164,8 @@ bool boost::mysql::detail::operator==(const pipeline_request_stage& lhs, const p
     case pipeline_stage_kind::execute: return lhs.stage_specific.enc == rhs.stage_specific.enc;
     case pipeline_stage_kind::set_character_set:
         return lhs.stage_specific.charset == rhs.stage_specific.charset;
+    case pipeline_stage_kind::execute_batch:
+        return lhs.stage_specific.num_requests == rhs.stage_specific.num_requests;
     default: return true;
     }
 }
@@ -140,6 +177,9 @@ std::ostream& boost::mysql::detail::operator<<(std::ostream& os, pipeline_reques
     {
     case pipeline_stage_kind::execute: os << ", .enc = " << v.stage_specific.enc; break;
     case pipeline_stage_kind::set_character_set: os << ", .charset = " << v.stage_specific.charset; break;
+    case pipeline_stage_kind::execute_batch:
+        os << ", .num_requests = " << v.stage_specific.num_requests;
+        break;
     default: break;
     }
     return os << " }";
@@ -158,6 +198,8 @@ static const char* to_string(detail::connection_status v)
     case detail::connection_status::ping_in_progress: return "connection_status::ping_in_progress";
     case detail::connection_status::idle: return "connection_status::idle";
     case detail::connection_status::in_use: return "connection_status::in_use";
+    case detail::connection_status::recycle_in_progress: return "connection_status::recycle_in_progress";
+    case detail::connection_status::close_in_progress: return "connection_status::close_in_progress";
     default: return "<unknown connection_status>";
     }
 }
@@ -196,6 +238,7 @@ static const char* to_string(detail::next_connection_action v)
     case detail::next_connection_action::idle_wait: return "next_connection_action::idle_wait";
     case detail::next_connection_action::reset: return "next_connection_action::reset";
     case detail::next_connection_action::ping: return "next_connection_action::ping";
+    case detail::next_connection_action::close: return "next_connection_action::close";
     default: return "<unknown next_connection_action>";
     }
 }
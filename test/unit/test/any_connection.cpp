@@ -75,6 +75,14 @@ BOOST_AUTO_TEST_CASE(init_ctor_error_max_buffer_size)
     BOOST_CHECK_THROW(any_connection(ctx, params), std::invalid_argument);
 }
 
+BOOST_AUTO_TEST_CASE(init_ctor_error_statement_cache_size)
+{
+    asio::io_context ctx;
+    any_connection_params params;
+    params.statement_cache_size = 0u;
+    BOOST_CHECK_THROW(any_connection(ctx, params), std::invalid_argument);
+}
+
 // move ctor
 BOOST_AUTO_TEST_CASE(move_ctor)
 {
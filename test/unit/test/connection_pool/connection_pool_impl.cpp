@@ -15,6 +15,7 @@
 #include <boost/mysql/mysql_collations.hpp>
 #include <boost/mysql/pipeline.hpp>
 #include <boost/mysql/pool_params.hpp>
+#include <boost/mysql/pool_stats.hpp>
 #include <boost/mysql/ssl_mode.hpp>
 
 #include <boost/mysql/detail/access.hpp>
@@ -24,6 +25,7 @@
 #include <boost/mysql/impl/internal/connection_pool/connection_pool_impl.hpp>
 #include <boost/mysql/impl/internal/connection_pool/internal_pool_params.hpp>
 #include <boost/mysql/impl/internal/connection_pool/sansio_connection_node.hpp>
+#include <boost/mysql/impl/internal/connection_pool/sharded_pool_impl.hpp>
 
 #include <boost/asio/any_completion_handler.hpp>
 #include <boost/asio/any_io_executor.hpp>
@@ -35,21 +37,29 @@
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/post.hpp>
 #include <boost/asio/ssl/context.hpp>
+#include <boost/asio/strand.hpp>
 #include <boost/asio/steady_timer.hpp>
 #include <boost/core/span.hpp>
 #include <boost/test/tools/detail/per_element_manip.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <memory>
 #include <ostream>
+#include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "mock_timer.hpp"
 #include "test_common/create_diagnostics.hpp"
 #include "test_common/printing.hpp"
 #include "test_common/tracker_executor.hpp"
+#include "test_unit/counting_memory_resource.hpp"
+#include "test_unit/create_statement.hpp"
 #include "test_unit/printing.hpp"
 
 // These tests rely on channels, which are not compatible with this
@@ -78,6 +88,7 @@ enum class fn_type
     connect,
     pipeline,
     ping,
+    close,
 };
 
 std::ostream& operator<<(std::ostream& os, fn_type t)
@@ -87,6 +98,7 @@ std::ostream& operator<<(std::ostream& os, fn_type t)
     case fn_type::connect: return os << "fn_type::connect";
     case fn_type::pipeline: return os << "fn_type::pipeline";
     case fn_type::ping: return os << "fn_type::ping";
+    case fn_type::close: return os << "fn_type::close";
     default: return os << "<unknown fn_type>";
     }
 }
@@ -195,32 +207,68 @@ class mock_connection
         }
     };
 
+    static bool has_tracking_stage(const pipeline_request& req)
+    {
+        const auto& stages = detail::access::get_impl(req).stages_;
+        return stages.back().kind == detail::pipeline_stage_kind::execute;
+    }
+
     static void check_stages(const pipeline_request& req)
     {
-        const detail::pipeline_request_stage expected_stages[] = {
+        // Reset and set character set, followed by a prepare statement
+        // for each statement registered in the pool. If lazy resets are enabled,
+        // a query enabling session tracking comes last
+        const auto& stages = detail::access::get_impl(req).stages_;
+        bool has_tracking = has_tracking_stage(req);
+        std::vector<detail::pipeline_request_stage> expected_stages{
             {detail::pipeline_stage_kind::reset_connection,  1, {}             },
             {detail::pipeline_stage_kind::set_character_set, 1, utf8mb4_charset},
         };
-        BOOST_TEST(detail::access::get_impl(req).stages_ == expected_stages, per_element());
+        for (std::size_t i = 2; i < stages.size() - (has_tracking ? 1u : 0u); ++i)
+            expected_stages.push_back({detail::pipeline_stage_kind::prepare_statement, 1, {}});
+        if (has_tracking)
+            expected_stages.push_back(
+                {detail::pipeline_stage_kind::execute, 1, detail::resultset_encoding::text}
+            );
+        BOOST_TEST(stages == expected_stages, per_element());
     }
 
-    static void set_response(std::vector<stage_response>& res)
+    static void set_response(const pipeline_request& req, std::vector<stage_response>& res)
     {
-        // Response should have two items, set to empty errors
-        res.resize(2);
-        for (auto& item : res)
-            detail::access::get_impl(item).emplace_error();
+        // The reset and set character set stages are set to empty errors.
+        // Prepare statement stages get statements with IDs 1, 2...
+        // The session tracking stage, if present, gets empty results
+        res.resize(detail::access::get_impl(req).stages_.size());
+        bool has_tracking = has_tracking_stage(req);
+        for (std::size_t i = 0; i < res.size(); ++i)
+        {
+            if (i < 2u)
+                detail::access::get_impl(res[i]).emplace_error();
+            else if (has_tracking && i == res.size() - 1u)
+                detail::access::get_impl(res[i]).emplace_results();
+            else
+                detail::access::get_impl(res[i]).set_result(
+                    statement_builder().id(static_cast<std::uint32_t>(i - 1)).build()
+                );
+        }
     }
 
 public:
     boost::mysql::any_connection_params ctor_params;
     boost::mysql::connect_params last_connect_params;
 
+    // Used by lazy resets. Emulates the session state tracked by any_connection
+    bool session_reset_required{true};
+
     mock_connection(asio::any_io_executor ex, boost::mysql::any_connection_params ctor_params)
         : impl_{ex, ex}, ctor_params(ctor_params)
     {
     }
 
+    // Emulates the effect of a successful any_connection::reset_connection, issued by the user.
+    // The server's defaults are restored, undoing the pool's setup
+    void emulate_manual_reset() { session_reset_required = true; }
+
     template <class CompletionToken>
     auto async_connect(const connect_params& params, diagnostics& diag, CompletionToken&& token)
         -> decltype(impl_.op_impl(fn_type::connect, &diag, std::forward<CompletionToken>(token)))
@@ -236,16 +284,25 @@ public:
         return impl_.op_impl(fn_type::ping, nullptr, std::forward<CompletionToken>(token));
     }
 
+    template <class CompletionToken>
+    auto async_close(CompletionToken&& token
+    ) -> decltype(impl_.op_impl(fn_type::close, nullptr, std::forward<CompletionToken>(token)))
+    {
+        return impl_.op_impl(fn_type::close, nullptr, std::forward<CompletionToken>(token));
+    }
+
     template <class CompletionToken>
     auto async_run_pipeline(
         const pipeline_request& req,
         std::vector<stage_response>& res,
+        diagnostics& diag,
         CompletionToken&& token
-    ) -> decltype(impl_.op_impl(fn_type::pipeline, nullptr, std::forward<CompletionToken>(token)))
+    ) -> decltype(impl_.op_impl(fn_type::pipeline, &diag, std::forward<CompletionToken>(token)))
     {
         check_stages(req);
-        set_response(res);  // This should technically happen after initiation, but is enough for these tests
-        return impl_.op_impl(fn_type::pipeline, nullptr, std::forward<CompletionToken>(token));
+        // This should technically happen after initiation, but is enough for these tests
+        set_response(req, res);
+        return impl_.op_impl(fn_type::pipeline, &diag, std::forward<CompletionToken>(token));
     }
 
     void step(
@@ -268,11 +325,21 @@ struct mock_io_traits
 {
     using connection_type = mock_connection;
     using timer_type = mock_timer;
+
+    static steady_clock::time_point now(const asio::any_io_executor& ex)
+    {
+        return asio::use_service<mock_timer_service>(ex.context()).current_time();
+    }
+
+    static bool session_reset_required(const mock_connection& conn) { return conn.session_reset_required; }
+
+    static void mark_session_clean(mock_connection& conn) { conn.session_reset_required = false; }
 };
 
 struct mock_pooled_connection;
 using mock_node = detail::basic_connection_node<mock_io_traits>;
 using mock_pool = detail::basic_pool_impl<mock_io_traits, mock_pooled_connection>;
+using mock_sharded_pool = detail::basic_sharded_pool_impl<mock_io_traits, mock_pooled_connection>;
 
 // Mock for pooled_connection
 struct mock_pooled_connection
@@ -682,6 +749,216 @@ BOOST_AUTO_TEST_CASE(lifecycle_reset_success)
     pool_test<op>(pool_params{});
 }
 
+BOOST_AUTO_TEST_CASE(lifecycle_prepared_statements)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+
+        static diagnostics expected_diag() { return create_server_diag("Bad statement!"); }
+
+        void invoke()
+        {
+            auto& node = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // After connecting, a reset is issued to prepare the statements
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::reset_in_progress);
+                check_shared_st(error_code(), diagnostics(), 1, 0);
+
+                // If it fails, this counts as a connect failure. The connection sleeps before
+                // reconnecting, and diagnostics are stored in shared state
+                BOOST_ASIO_CORO_YIELD
+                step(node, fn_type::pipeline, common_server_errc::er_parse_error, expected_diag());
+                wait_for_status(node, connection_status::sleep_connect_failed_in_progress);
+                check_shared_st(common_server_errc::er_parse_error, expected_diag(), 1, 0);
+
+                // Advance until it's time to retry again
+                get_timer_service().advance_time_by(std::chrono::seconds(2));
+                wait_for_status(node, connection_status::connect_in_progress);
+                check_shared_st(common_server_errc::er_parse_error, expected_diag(), 1, 0);
+
+                // Connect and reset successfully
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::reset_in_progress);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::pipeline);
+                wait_for_status(node, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 1);
+
+                // Statements are available to the user
+                node.mark_as_in_use();
+                BOOST_TEST(node.prepared_statement(0).id() == 1u);
+                BOOST_TEST(node.prepared_statement(1).id() == 2u);
+
+                // Returning the connection prepares them again
+                return_connection(node, true);
+                wait_for_status(node, connection_status::reset_in_progress);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::pipeline);
+                wait_for_status(node, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 1);
+                node.mark_as_in_use();
+                BOOST_TEST(node.prepared_statement(1).id() == 2u);
+            }
+        }
+    };
+
+    pool_params params;
+    params.prepared_statements = {"SELECT 1", "SELECT ?"};
+    params.retry_interval = std::chrono::seconds(2);
+
+    pool_test<op>(std::move(params));
+}
+
+BOOST_AUTO_TEST_CASE(lifecycle_lazy_reset)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+
+        void invoke()
+        {
+            auto& node = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // After connecting, a reset is issued to enable session tracking
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::reset_in_progress);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::pipeline);
+                wait_for_status(node, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 1);
+
+                // The reset pipeline leaves the session clean
+                BOOST_TEST(!node.connection().session_reset_required);
+
+                // Returning a connection with a clean session doesn't reset it
+                node.mark_as_in_use();
+                return_connection(node, true);
+                wait_for_status(node, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 1);
+                BOOST_TEST(pool_.stats().total_skipped_resets == 1u);
+                BOOST_TEST(pool_.stats().total_resets == 1u);
+
+                // If the user modified the session, it's reset
+                node.mark_as_in_use();
+                node.connection().session_reset_required = true;
+                return_connection(node, true);
+                wait_for_status(node, connection_status::reset_in_progress);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::pipeline);
+                wait_for_status(node, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 1);
+                BOOST_TEST(!node.connection().session_reset_required);
+                BOOST_TEST(pool_.stats().total_skipped_resets == 1u);
+                BOOST_TEST(pool_.stats().total_resets == 2u);
+            }
+        }
+    };
+
+    pool_params params;
+    params.lazy_reset = true;
+
+    pool_test<op>(std::move(params));
+}
+
+// A connection that was reset by the user lost the setup performed by the pool's
+// reset pipeline (character set, prepared statements and session tracking).
+// Returning it runs the pipeline again, even with lazy resets
+BOOST_AUTO_TEST_CASE(lifecycle_lazy_reset_manual_reset)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+
+        void invoke()
+        {
+            auto& node = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // Connect and reset
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::reset_in_progress);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::pipeline);
+                wait_for_status(node, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 1);
+
+                // The user resets the connection manually and returns it
+                node.mark_as_in_use();
+                node.connection().emulate_manual_reset();
+                return_connection(node, true);
+
+                // The pool's reset pipeline runs
+                wait_for_status(node, connection_status::reset_in_progress);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::pipeline);
+                wait_for_status(node, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 1);
+                BOOST_TEST(!node.connection().session_reset_required);
+                BOOST_TEST(pool_.stats().total_skipped_resets == 0u);
+                BOOST_TEST(pool_.stats().total_resets == 2u);
+            }
+        }
+    };
+
+    pool_params params;
+    params.lazy_reset = true;
+
+    pool_test<op>(std::move(params));
+}
+
+// A connection returned in the middle of a resultset (unread rows, open cursors
+// or cancelled operations) always requires a reset, even if the session wasn't modified.
+// The pending data makes the reset fail, which triggers a reconnection
+BOOST_AUTO_TEST_CASE(lifecycle_lazy_reset_pending_data)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+
+        void invoke()
+        {
+            auto& node = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // Connect and reset
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::reset_in_progress);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::pipeline);
+                wait_for_status(node, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 1);
+
+                // The user starts an execution and returns the connection before reading all rows.
+                // The connection reports that a reset is required
+                node.mark_as_in_use();
+                node.connection().session_reset_required = true;
+                return_connection(node, true);
+                wait_for_status(node, connection_status::reset_in_progress);
+
+                // The server's pending rows make the reset fail. We reconnect
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::pipeline, client_errc::sequence_number_mismatch);
+                wait_for_status(node, connection_status::connect_in_progress);
+                check_shared_st(error_code(), diagnostics(), 1, 0);
+                BOOST_TEST(pool_.stats().total_skipped_resets == 0u);
+
+                // Reconnect and reset succeed. We're idle again
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::reset_in_progress);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::pipeline);
+                wait_for_status(node, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 1);
+                BOOST_TEST(!node.connection().session_reset_required);
+            }
+        }
+    };
+
+    pool_params params;
+    params.lazy_reset = true;
+
+    pool_test<op>(std::move(params));
+}
+
 BOOST_AUTO_TEST_CASE(lifecycle_reset_error)
 {
     struct op : pool_test_op<op>
@@ -979,6 +1256,120 @@ BOOST_AUTO_TEST_CASE(lifecycle_ping_disabled)
     pool_test<op>(std::move(params));
 }
 
+BOOST_AUTO_TEST_CASE(lifecycle_max_lifetime)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+
+        void invoke()
+        {
+            auto& node = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // Wait until a connection is successfully connected
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::idle);
+
+                // Wait until max lifetime ellapses. The connection is closed and re-established
+                get_timer_service().advance_time_by(std::chrono::seconds(80));
+                wait_for_status(node, connection_status::recycle_in_progress);
+                check_shared_st(error_code(), diagnostics(), 1, 0);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::close);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 1);
+
+                // Connections in use are not recycled
+                BOOST_ASIO_CORO_YIELD wait_for_task(create_task(), node);
+                get_timer_service().advance_time_by(std::chrono::seconds(80));
+                BOOST_ASIO_CORO_YIELD asio::post(std::move(*this));
+                BOOST_TEST(node.status() == connection_status::in_use);
+
+                // When returned, the connection is recycled without being reset
+                return_connection(node, true);
+                wait_for_status(node, connection_status::recycle_in_progress);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::close);
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 1);
+            }
+        }
+    };
+
+    pool_params params;
+    params.max_lifetime = std::chrono::seconds(80);
+
+    pool_test<op>(std::move(params));
+}
+
+// Each pool seeds its own generator for the max_lifetime jitter, so pools
+// created at the same time don't recycle their connections in lockstep
+BOOST_AUTO_TEST_CASE(lifecycle_max_lifetime_jitter_seed)
+{
+    detail::conn_shared_state<mock_io_traits> st1, st2;
+    std::vector<std::uint32_t> values1, values2;
+    for (int i = 0; i < 4; ++i)
+    {
+        values1.push_back(static_cast<std::uint32_t>(st1.lifetime_rng()));
+        values2.push_back(static_cast<std::uint32_t>(st2.lifetime_rng()));
+    }
+    BOOST_TEST(values1 != values2);
+}
+
+BOOST_AUTO_TEST_CASE(lifecycle_idle_timeout)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+        mock_node* node2{};
+
+        void invoke()
+        {
+            auto& node1 = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // Get a connection. Another request causes a second connection to be created
+                BOOST_ASIO_CORO_YIELD step(node1, fn_type::connect);
+                BOOST_ASIO_CORO_YIELD wait_for_task(create_task(), node1);
+                create_task();
+                wait_for_num_nodes(2);
+                node2 = &pool_.nodes().back();
+                BOOST_ASIO_CORO_YIELD step(*node2, fn_type::connect);
+                wait_for_status(*node2, connection_status::in_use);
+
+                // Return the second connection. After it's been idle for idle_timeout,
+                // it gets closed and removed from the pool
+                return_connection(*node2, false);
+                wait_for_status(*node2, connection_status::idle);
+                get_timer_service().advance_time_by(std::chrono::seconds(100));
+                wait_for_status(*node2, connection_status::close_in_progress);
+                check_shared_st(error_code(), diagnostics(), 0, 0);
+                BOOST_ASIO_CORO_YIELD step(*node2, fn_type::close);
+                wait_for_num_nodes(1);
+                check_shared_st(error_code(), diagnostics(), 0, 0);
+
+                // The pool doesn't shrink below initial_size
+                return_connection(node1, false);
+                wait_for_status(node1, connection_status::idle);
+                get_timer_service().advance_time_by(std::chrono::seconds(200));
+                BOOST_ASIO_CORO_YIELD asio::post(std::move(*this));
+                BOOST_TEST(node1.status() == connection_status::idle);
+                BOOST_TEST(pool_.nodes().size() == 1u);
+            }
+        }
+    };
+
+    pool_params params;
+    params.initial_size = 1;
+    params.max_size = 2;
+    params.idle_timeout = std::chrono::seconds(100);
+
+    pool_test<op>(std::move(params));
+}
+
 // async_get_connection
 BOOST_AUTO_TEST_CASE(get_connection_wait_success)
 {
@@ -1008,11 +1399,12 @@ BOOST_AUTO_TEST_CASE(get_connection_wait_success)
                 get_timer_service().advance_time_by(std::chrono::seconds(2));
                 BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
 
-                // Request is fulfilled
+                // Request is fulfilled. The timer used for the wait is recycled
                 BOOST_ASIO_CORO_YIELD wait_for_task(task, node);
                 BOOST_TEST(node.status() == connection_status::in_use);
                 BOOST_TEST(pool_.nodes().size() == 1u);
                 BOOST_TEST(num_pending_requests() == 0u);
+                BOOST_TEST(pool_.timer_pool().size() == 1u);
             }
         }
     };
@@ -1047,6 +1439,8 @@ BOOST_AUTO_TEST_CASE(get_connection_wait_timeout_no_diag)
                 BOOST_TEST(*diag == diagnostics());
                 BOOST_TEST(pool_.nodes().size() == 1u);
                 BOOST_TEST(num_pending_requests() == 0u);
+                BOOST_TEST(pool_.stats().total_checkout_timeouts == 1u);
+                BOOST_TEST(pool_.stats().num_waiting_requests == 0u);
             }
         }
     };
@@ -1134,6 +1528,80 @@ BOOST_AUTO_TEST_CASE(get_connection_wait_timeout_with_diag_nullptr)
     pool_test<op>(pool_params{});
 }
 
+BOOST_AUTO_TEST_CASE(try_get_connection)
+{
+    struct op : pool_test_op<op>
+    {
+        using pool_test_op<op>::pool_test_op;
+
+        void invoke()
+        {
+            auto& node = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // No idle connections yet. Nothing is returned, and no connection request is issued
+                wait_for_status(node, connection_status::connect_in_progress);
+                BOOST_TEST(pool_.try_get_connection_unsafe().node == nullptr);
+                BOOST_TEST(num_pending_requests() == 0u);
+                BOOST_TEST(pool_.nodes().size() == 1u);
+
+                // Once the connection is idle, it's returned immediately
+                BOOST_ASIO_CORO_YIELD step(node, fn_type::connect);
+                wait_for_status(node, connection_status::idle);
+                {
+                    auto conn = pool_.try_get_connection_unsafe();
+                    BOOST_TEST(conn.node == &node);
+                    BOOST_TEST(conn.pool.get() == &pool_);
+                }
+                BOOST_TEST(node.status() == connection_status::in_use);
+                check_shared_st(error_code(), diagnostics(), 0, 0);
+
+                // The connection is no longer idle
+                BOOST_TEST(pool_.try_get_connection_unsafe().node == nullptr);
+            }
+        }
+    };
+
+    pool_test<op>(pool_params{});
+}
+
+BOOST_AUTO_TEST_CASE(try_get_connection_not_running)
+{
+    asio::io_context ctx;
+    auto pool = std::make_shared<mock_pool>(
+        pool_executor_params{ctx.get_executor(), ctx.get_executor()},
+        pool_params{}
+    );
+    BOOST_TEST(pool->try_get_connection_unsafe().node == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(running_in_pool_executor)
+{
+    asio::io_context ctx;
+
+    // Not a strand: we can't tell, so we assume it's fine
+    auto pool = std::make_shared<mock_pool>(
+        pool_executor_params{ctx.get_executor(), ctx.get_executor()},
+        pool_params{}
+    );
+    BOOST_TEST(pool->running_in_pool_executor());
+
+    // A strand: only within the strand
+    auto safe_pool = std::make_shared<mock_pool>(
+        pool_executor_params::thread_safe(ctx.get_executor()),
+        pool_params{}
+    );
+    BOOST_TEST(!safe_pool->running_in_pool_executor());
+    bool called = false;
+    asio::post(safe_pool->get_executor(), [&] {
+        BOOST_TEST(safe_pool->running_in_pool_executor());
+        called = true;
+    });
+    ctx.run();
+    BOOST_TEST(called);
+}
+
 BOOST_AUTO_TEST_CASE(get_connection_immediate_completion)
 {
     struct op : pool_test_op<op>
@@ -1335,9 +1803,162 @@ BOOST_AUTO_TEST_CASE(get_connection_initial_size_0)
     pool_test<op>(std::move(params));
 }
 
+// min_idle connections are kept idle or being established
+BOOST_AUTO_TEST_CASE(get_connection_min_idle)
+{
+    struct op : pool_test_op<op, 2>
+    {
+        using pool_test_op<op, 2>::pool_test_op;
+
+        void invoke()
+        {
+            auto& node1 = pool_.nodes().front();
+            auto& node2 = *std::next(pool_.nodes().begin());
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // Two connections are created when the pool starts running, even if initial_size == 1
+                check_shared_st(error_code(), diagnostics(), 2, 0);
+                BOOST_ASIO_CORO_YIELD step(node1, fn_type::connect);
+                BOOST_ASIO_CORO_YIELD step(node2, fn_type::connect);
+                wait_for_status(node2, connection_status::idle);
+                check_shared_st(error_code(), diagnostics(), 0, 2);
+
+                // Taking a connection creates a new one in the background
+                BOOST_ASIO_CORO_YIELD wait_for_task(create_task(), node1);
+                wait_for_num_nodes(3);
+                check_shared_st(error_code(), diagnostics(), 1, 1);
+
+                // Taking another one doesn't create any more, since max_size is respected
+                BOOST_ASIO_CORO_YIELD wait_for_task(create_task(), node2);
+                wait_for_num_nodes(3);
+                check_shared_st(error_code(), diagnostics(), 1, 0);
+
+                // The new connection becomes idle and can be used
+                BOOST_ASIO_CORO_YIELD step(pool_.nodes().back(), fn_type::connect);
+                BOOST_ASIO_CORO_YIELD wait_for_task(create_task(), pool_.nodes().back());
+                wait_for_num_nodes(3);
+                check_shared_st(error_code(), diagnostics(), 0, 0);
+            }
+        }
+    };
+
+    pool_params params;
+    params.initial_size = 1;
+    params.min_idle = 2;
+    params.max_size = 3;
+
+    pool_test<op>(std::move(params));
+}
+
+BOOST_AUTO_TEST_CASE(stats)
+{
+    using latency_samples = std::vector<std::pair<pool_latency_kind, steady_clock::duration>>;
+
+    struct op : pool_test_op<op>
+    {
+        std::shared_ptr<latency_samples> samples;
+        mock_node* node2{};
+        get_connection_task task2;
+
+        op(mock_pool& pool, bool& finished, std::shared_ptr<latency_samples> samples)
+            : pool_test_op<op>(pool, finished), samples(std::move(samples))
+        {
+        }
+
+        void invoke()
+        {
+            auto& node1 = pool_.nodes().front();
+
+            BOOST_ASIO_CORO_REENTER(*this)
+            {
+                // The initial connection is being established
+                BOOST_TEST(pool_.stats().num_connections == 1u);
+                BOOST_TEST(pool_.stats().num_pending == 1u);
+
+                // Connect succeeds after some time
+                get_timer_service().advance_time_by(std::chrono::milliseconds(10));
+                BOOST_ASIO_CORO_YIELD step(node1, fn_type::connect);
+                wait_for_status(node1, connection_status::idle);
+                BOOST_TEST(pool_.stats().num_pending == 0u);
+                BOOST_TEST(pool_.stats().num_idle == 1u);
+                BOOST_TEST(pool_.stats().total_connects == 1u);
+
+                // Getting a connection without waiting
+                BOOST_ASIO_CORO_YIELD wait_for_task(create_task(), node1);
+                BOOST_TEST(pool_.stats().num_idle == 0u);
+                BOOST_TEST(pool_.stats().num_in_use == 1u);
+                BOOST_TEST(pool_.stats().total_checkouts == 1u);
+
+                // A request that has to wait for a new connection
+                task2 = create_task();
+                wait_for_num_requests(1);
+                BOOST_TEST(pool_.stats().num_waiting_requests == 1u);
+                BOOST_TEST(pool_.stats().num_connections == 2u);
+                node2 = &pool_.nodes().back();
+                get_timer_service().advance_time_by(std::chrono::seconds(1));
+                BOOST_ASIO_CORO_YIELD step(*node2, fn_type::connect, common_server_errc::er_bad_db_error);
+                wait_for_status(*node2, connection_status::sleep_connect_failed_in_progress);
+                get_timer_service().advance_time_by(std::chrono::seconds(1));
+                BOOST_ASIO_CORO_YIELD step(*node2, fn_type::connect);
+                BOOST_ASIO_CORO_YIELD wait_for_task(task2, *node2);
+                BOOST_TEST(pool_.stats().num_waiting_requests == 0u);
+                BOOST_TEST(pool_.stats().num_in_use == 2u);
+                BOOST_TEST(pool_.stats().total_checkouts == 2u);
+                BOOST_TEST(pool_.stats().total_checkout_wait_time == std::chrono::seconds(2));
+                BOOST_TEST(pool_.stats().total_connects == 2u);
+                BOOST_TEST(pool_.stats().total_connect_errors == 1u);
+
+                // Returning a connection with reset
+                return_connection(node1, true);
+                wait_for_status(node1, connection_status::reset_in_progress);
+                get_timer_service().advance_time_by(std::chrono::milliseconds(5));
+                BOOST_ASIO_CORO_YIELD step(node1, fn_type::pipeline);
+                wait_for_status(node1, connection_status::idle);
+                BOOST_TEST(pool_.stats().num_in_use == 1u);
+                BOOST_TEST(pool_.stats().num_idle == 1u);
+                BOOST_TEST(pool_.stats().total_resets == 1u);
+                BOOST_TEST(pool_.stats().total_reset_errors == 0u);
+                BOOST_TEST(pool_.stats().total_reset_time == std::chrono::milliseconds(5));
+
+                // All samples were reported
+                const latency_samples expected{
+                    {pool_latency_kind::connect,       std::chrono::milliseconds(10)},
+                    {pool_latency_kind::checkout_wait, steady_clock::duration(0)    },
+                    {pool_latency_kind::connect,       std::chrono::seconds(1)      },
+                    {pool_latency_kind::connect,       std::chrono::seconds(0)      },
+                    {pool_latency_kind::checkout_wait, std::chrono::seconds(2)      },
+                    {pool_latency_kind::reset,         std::chrono::milliseconds(5) },
+                };
+                BOOST_TEST(samples->size() == expected.size());
+                for (std::size_t i = 0; i < (std::min)(samples->size(), expected.size()); ++i)
+                {
+                    BOOST_TEST_CONTEXT(i)
+                    {
+                        BOOST_TEST((*samples)[i].first == expected[i].first);
+                        BOOST_TEST(((*samples)[i].second == expected[i].second));
+                    }
+                }
+            }
+        }
+    };
+
+    auto samples = std::make_shared<latency_samples>();
+    pool_params params;
+    params.max_size = 2;
+    params.retry_interval = std::chrono::seconds(1);
+    params.latency_observer = [samples](pool_latency_kind kind, steady_clock::duration dur) {
+        samples->emplace_back(kind, dur);
+    };
+
+    pool_test<op>(std::move(params), samples);
+}
+
 // pool_params have the intended effect
 BOOST_AUTO_TEST_CASE(params_ssl_ctx_buffsize)
 {
+    static counting_memory_resource resource;
+
     struct op : pool_test_op<op>
     {
         asio::ssl::context::native_handle_type expected_handle;
@@ -1355,14 +1976,20 @@ BOOST_AUTO_TEST_CASE(params_ssl_ctx_buffsize)
                 BOOST_TEST_REQUIRE(ctor_params.ssl_context != nullptr);
                 BOOST_TEST(ctor_params.ssl_context->native_handle() == expected_handle);
                 BOOST_TEST(ctor_params.initial_buffer_size == 16u);
+                BOOST_TEST(ctor_params.buffer_shrink_threshold == 1024u);
+                BOOST_TEST(ctor_params.buffer_memory_resource == &resource);
+                BOOST_TEST(ctor_params.statement_cache_size == 10u);
             }
         }
     };
 
-    // Pass a custom ssl context and buffer size
+    // Pass a custom ssl context and buffer params
     pool_params params;
     params.ssl_ctx.emplace(boost::asio::ssl::context::tlsv12_client);
     params.initial_buffer_size = 16u;
+    params.buffer_shrink_threshold = 1024u;
+    params.buffer_memory_resource = &resource;
+    params.statement_cache_size = 10u;
 
     // SSL context matching is performed using the underlying handle
     // because ssl::context provides no way to query the options previously set
@@ -1450,6 +2077,73 @@ BOOST_AUTO_TEST_CASE(params_connect_2)
     pool_test<op>(std::move(params));
 }
 
+// sharded pools
+BOOST_AUTO_TEST_CASE(sharded_select_shard)
+{
+    asio::io_context ctx;
+    pool_params params;
+    params.max_size = 10;
+    auto pool = std::make_shared<mock_sharded_pool>(ctx.get_executor(), std::move(params), 3);
+
+    // Sizes are split between shards
+    BOOST_TEST(pool->num_shards() == 3u);
+    BOOST_TEST(pool->shard(0).params().max_size == 4u);
+    BOOST_TEST(pool->shard(1).params().max_size == 3u);
+    BOOST_TEST(pool->shard(2).params().max_size == 3u);
+
+    // No shard has idle connections: the home shard is selected
+    BOOST_TEST(pool->select_shard(1) == 1u);
+
+    // Another shard has idle connections: steal from it
+    pool->shard(0).shared_state().num_idle = 2;
+    BOOST_TEST(pool->select_shard(1) == 0u);
+    pool->shard(2).shared_state().num_idle = 1;
+    BOOST_TEST(pool->select_shard(1) == 2u);
+
+    // The home shard has idle connections: use it
+    pool->shard(1).shared_state().num_idle = 1;
+    BOOST_TEST(pool->select_shard(1) == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(sharded_select_shard_capacity)
+{
+    asio::io_context ctx;
+    pool_params params;
+    params.max_size = 10;
+    auto pool = std::make_shared<mock_sharded_pool>(ctx.get_executor(), std::move(params), 3);
+
+    // No shard has idle connections, and all can grow: the home shard is selected
+    BOOST_TEST(pool->select_shard(1) == 1u);
+
+    // The home shard is full, but other shards have spare capacity: use them
+    pool->shard(1).shared_state().counters.num_connections = 3u;
+    BOOST_TEST(pool->select_shard(1) == 2u);
+    pool->shard(2).shared_state().counters.num_connections = 3u;
+    BOOST_TEST(pool->select_shard(1) == 0u);
+
+    // All shards are full: the home shard is selected
+    pool->shard(0).shared_state().counters.num_connections = 4u;
+    BOOST_TEST(pool->select_shard(1) == 1u);
+
+    // Shards with idle connections are preferred over shards with spare capacity
+    pool->shard(0).shared_state().counters.num_connections = 2u;
+    pool->shard(2).shared_state().num_idle = 1;
+    BOOST_TEST(pool->select_shard(1) == 2u);
+}
+
+BOOST_AUTO_TEST_CASE(sharded_invalid_params)
+{
+    asio::io_context ctx;
+
+    // Zero shards
+    BOOST_CHECK_THROW(mock_sharded_pool(ctx.get_executor(), pool_params{}, 0), std::invalid_argument);
+
+    // Not enough connections for each shard to have one
+    pool_params params;
+    params.max_size = 2;
+    BOOST_CHECK_THROW(mock_sharded_pool(ctx.get_executor(), std::move(params), 3), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
@@ -146,6 +146,76 @@ BOOST_AUTO_TEST_CASE(ping_success)
     nod.check(connection_status::idle, exit_pending | enter_idle);
 }
 
+BOOST_AUTO_TEST_CASE(idle_timeout)
+{
+    // Connection idle
+    mock_node nod(connection_status::idle);
+
+    // Time elapses, and the connection has been idle for too long
+    auto act = nod.resume(error_code(), collection_state::none, connection_expiry::idle_timeout);
+    BOOST_TEST(act == next_connection_action::close);
+    nod.check(connection_status::close_in_progress, exit_idle);
+
+    // Close succeeds, we're done
+    act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::none);
+    nod.check(connection_status::terminated, 0);
+}
+
+BOOST_AUTO_TEST_CASE(max_lifetime_idle)
+{
+    // Connection idle
+    mock_node nod(connection_status::idle);
+
+    // Time elapses, and the connection has been alive for too long
+    auto act = nod.resume(error_code(), collection_state::none, connection_expiry::max_lifetime);
+    BOOST_TEST(act == next_connection_action::close);
+    nod.check(connection_status::recycle_in_progress, exit_idle | enter_pending);
+
+    // Close succeeds, we reconnect
+    act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::connect);
+    nod.check(connection_status::connect_in_progress, 0);
+
+    // Connect succeeds, we're idle again
+    act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::idle_wait);
+    nod.check(connection_status::idle, exit_pending | enter_idle);
+}
+
+BOOST_AUTO_TEST_CASE(max_lifetime_collect)
+{
+    for (auto col_st : {collection_state::needs_collect, collection_state::needs_collect_with_reset})
+    {
+        BOOST_TEST_CONTEXT(static_cast<int>(col_st))
+        {
+            // Connection in use
+            mock_node nod(connection_status::in_use);
+
+            // Returned by the user after its lifetime expired. No reset is performed
+            auto act = nod.resume(error_code(), col_st, connection_expiry::max_lifetime);
+            BOOST_TEST(act == next_connection_action::close);
+            nod.check(connection_status::recycle_in_progress, enter_pending);
+
+            // Close succeeds, we reconnect
+            act = nod.resume(error_code(), collection_state::none);
+            BOOST_TEST(act == next_connection_action::connect);
+            nod.check(connection_status::connect_in_progress, 0);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(max_lifetime_still_in_use)
+{
+    // Connection in use
+    mock_node nod(connection_status::in_use);
+
+    // Connections are never recycled while in use
+    auto act = nod.resume(error_code(), collection_state::none, connection_expiry::max_lifetime);
+    BOOST_TEST(act == next_connection_action::idle_wait);
+    nod.check(connection_status::in_use, 0);
+}
+
 // Error state transitions
 BOOST_AUTO_TEST_CASE(connect_error)
 {
@@ -168,6 +238,37 @@ BOOST_AUTO_TEST_CASE(connect_error)
     nod.check(connection_status::idle, exit_pending | enter_idle);
 }
 
+BOOST_AUTO_TEST_CASE(reset_after_connect)
+{
+    // Connection trying to connect, with statements to prepare
+    mock_node nod(connection_status::connect_in_progress, true);
+
+    // Connect success issues a reset
+    auto act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::reset);
+    nod.check(connection_status::reset_in_progress, 0);
+    BOOST_TEST(nod.reset_follows_connect());
+
+    // Reset fails. This counts as a connect failure, so we sleep before reconnecting
+    act = nod.resume(client_errc::timeout, collection_state::none);
+    BOOST_TEST(act == next_connection_action::sleep_connect_failed);
+    nod.check(connection_status::sleep_connect_failed_in_progress, 0);
+    BOOST_TEST(!nod.reset_follows_connect());
+
+    // Sleep done
+    act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::connect);
+    nod.check(connection_status::connect_in_progress, 0);
+
+    // Connect and reset succeed, we're idle
+    act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::reset);
+    nod.check(connection_status::reset_in_progress, 0);
+    act = nod.resume(error_code(), collection_state::none);
+    BOOST_TEST(act == next_connection_action::idle_wait);
+    nod.check(connection_status::idle, exit_pending | enter_idle);
+}
+
 BOOST_AUTO_TEST_CASE(ping_error)
 {
     // Connection idle
@@ -198,8 +299,9 @@ BOOST_AUTO_TEST_CASE(reset_error)
     auto act = nod.resume(error_code(), collection_state::needs_collect_with_reset);
     BOOST_TEST(act == next_connection_action::reset);
     nod.check(connection_status::reset_in_progress, enter_pending);
+    BOOST_TEST(!nod.reset_follows_connect());
 
-    // Reset fails
+    // Reset fails. We reconnect immediately
     act = nod.resume(client_errc::timeout, collection_state::none);
     BOOST_TEST(act == next_connection_action::connect);
     nod.check(connection_status::connect_in_progress, 0);
@@ -210,6 +312,20 @@ BOOST_AUTO_TEST_CASE(reset_error)
     nod.check(connection_status::idle, exit_pending | enter_idle);
 }
 
+BOOST_AUTO_TEST_CASE(close_error)
+{
+    // Errors closing connections are ignored
+    mock_node nod(connection_status::recycle_in_progress);
+    auto act = nod.resume(client_errc::timeout, collection_state::none);
+    BOOST_TEST(act == next_connection_action::connect);
+    nod.check(connection_status::connect_in_progress, 0);
+
+    mock_node nod2(connection_status::close_in_progress);
+    act = nod2.resume(client_errc::timeout, collection_state::none);
+    BOOST_TEST(act == next_connection_action::none);
+    nod2.check(connection_status::terminated, 0);
+}
+
 BOOST_AUTO_TEST_CASE(sleep_between_retries_fail)
 {
     // Note: this is an edge case. This op should not fail unless
@@ -271,6 +387,8 @@ BOOST_AUTO_TEST_CASE(cancel)
         {connection_status::in_use,                           0           },
         {connection_status::ping_in_progress,                 exit_pending},
         {connection_status::reset_in_progress,                exit_pending},
+        {connection_status::recycle_in_progress,              exit_pending},
+        {connection_status::close_in_progress,                0           },
     };
 
     for (const auto& tc : test_cases)
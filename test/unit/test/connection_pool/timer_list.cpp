@@ -229,4 +229,61 @@ BOOST_FIXTURE_TEST_CASE(auto_unlink, fixture)
     BOOST_TEST(l.size() == 0u);
 }
 
+BOOST_FIXTURE_TEST_CASE(timer_block_pool_recycle, fixture)
+{
+    timer_block_pool<asio::steady_timer> pool(2);
+
+    // Nothing to recycle, so a new block is allocated
+    auto blk1 = pool.acquire(ctx.get_executor());
+    auto blk2 = pool.acquire(ctx.get_executor());
+    BOOST_TEST(blk1.get() != blk2.get());
+    BOOST_TEST(pool.size() == 0u);
+
+    // Releasing a block removes it from the list it was in
+    l.push_back(*blk1);
+    l.push_back(*blk2);
+    auto* blk1_ptr = blk1.get();
+    pool.release(std::move(blk1));
+    BOOST_TEST(l.size() == 1u);
+    BOOST_TEST(pool.size() == 1u);
+
+    // Acquiring reuses the released block
+    auto blk3 = pool.acquire(ctx.get_executor());
+    BOOST_TEST(blk3.get() == blk1_ptr);
+    BOOST_TEST(pool.size() == 0u);
+
+    // Blocks still in the pool are freed by its destructor
+    pool.release(std::move(blk2));
+    pool.release(std::move(blk3));
+    BOOST_TEST(l.size() == 0u);
+    BOOST_TEST(pool.size() == 2u);
+}
+
+BOOST_FIXTURE_TEST_CASE(timer_block_pool_max_free, fixture)
+{
+    timer_block_pool<asio::steady_timer> pool(2);
+
+    // Acquire more blocks than the pool can hold, as happens during spikes of waiting requests
+    auto blk1 = pool.acquire(ctx.get_executor());
+    auto blk2 = pool.acquire(ctx.get_executor());
+    auto blk3 = pool.acquire(ctx.get_executor());
+    l.push_back(*blk3);
+
+    // Blocks are kept until the limit is reached
+    pool.release(std::move(blk1));
+    pool.release(std::move(blk2));
+    BOOST_TEST(pool.size() == 2u);
+
+    // Blocks released beyond the limit are deallocated, and still removed from their lists
+    pool.release(std::move(blk3));
+    BOOST_TEST(pool.size() == 2u);
+    BOOST_TEST(l.size() == 0u);
+
+    // Kept blocks can be reused
+    auto blk4 = pool.acquire(ctx.get_executor());
+    BOOST_TEST(pool.size() == 1u);
+    pool.release(std::move(blk4));
+    BOOST_TEST(pool.size() == 2u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
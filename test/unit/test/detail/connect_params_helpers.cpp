@@ -6,6 +6,7 @@
 //
 
 #include <boost/mysql/any_address.hpp>
+#include <boost/mysql/compression_algorithm.hpp>
 #include <boost/mysql/connect_params.hpp>
 #include <boost/mysql/ssl_mode.hpp>
 #include <boost/mysql/string_view.hpp>
@@ -19,6 +20,7 @@
 
 using namespace boost::mysql::detail;
 using boost::mysql::address_type;
+using boost::mysql::compression_algorithm;
 using boost::mysql::connect_params;
 using boost::mysql::ssl_mode;
 using boost::mysql::string_view;
@@ -62,6 +64,8 @@ BOOST_AUTO_TEST_CASE(make_hparams_1)
     input.connection_collation = std::uint16_t(100);
     input.ssl = ssl_mode::require;
     input.multi_queries = true;
+    input.compression = compression_algorithm::zlib;
+    input.compression_threshold = 1024u;
 
     auto hparams = make_hparams(input);
 
@@ -71,6 +75,8 @@ BOOST_AUTO_TEST_CASE(make_hparams_1)
     BOOST_TEST(hparams.connection_collation() == std::uint16_t(100));
     BOOST_TEST(hparams.ssl() == ssl_mode::require);
     BOOST_TEST(hparams.multi_queries());
+    BOOST_TEST((hparams.compression() == compression_algorithm::zlib));
+    BOOST_TEST(hparams.compression_threshold() == 1024u);
 }
 
 BOOST_AUTO_TEST_CASE(make_hparams_2)
@@ -92,6 +98,8 @@ BOOST_AUTO_TEST_CASE(make_hparams_2)
     BOOST_TEST(hparams.connection_collation() == std::uint16_t(200));
     BOOST_TEST(hparams.ssl() == ssl_mode::disable);  // SSL mode was adjusted (UNIX)
     BOOST_TEST(!hparams.multi_queries());
+    BOOST_TEST((hparams.compression() == compression_algorithm::none));
+    BOOST_TEST(hparams.compression_threshold() == 50u);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
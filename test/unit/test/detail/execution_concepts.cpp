@@ -101,6 +101,8 @@ static_assert(!execution_state_type<static_results<row1, row2>>, "");
 static_assert(execution_state_type<execution_state>, "");
 static_assert(execution_state_type<static_execution_state<row1>>, "");
 static_assert(execution_state_type<static_execution_state<row1, row2>>, "");
+static_assert(execution_state_type<columnar_results>, "");
+static_assert(execution_state_type<arrow_execution_state>, "");
 
 // -----
 // results_type
@@ -113,6 +115,8 @@ static_assert(!results_type<static_execution_state<row1, row2>>, "");
 static_assert(results_type<results>, "");
 static_assert(results_type<static_results<row1>>, "");
 static_assert(results_type<static_results<row1, row2>>, "");
+static_assert(results_type<columnar_results>, "");
+static_assert(!results_type<arrow_execution_state>, "");
 
 }  // namespace
 
@@ -34,6 +34,8 @@
 using namespace boost::mysql;
 using namespace boost::mysql::test;
 using boost::span;
+using detail::get_field_parse_fns;
+using detail::get_member_addresses;
 using detail::get_row_name_table;
 using detail::get_row_size;
 using detail::get_type_index;
@@ -544,6 +546,32 @@ BOOST_AUTO_TEST_CASE(parse_empty_struct)
     BOOST_TEST(err == error_code());
 }
 
+// field-by-field parsing
+static_assert(get_field_parse_fns<sempty>().size() == 0u, "");
+static_assert(get_field_parse_fns<sinherit>().size() == 3u, "");
+
+BOOST_AUTO_TEST_CASE(parse_fields)
+{
+    sinherit value;
+    void* members[3]{};
+    get_member_addresses<sinherit>(value, members);
+    BOOST_TEST(members[0] == &value.i);
+    BOOST_TEST(members[1] == &value.f);
+    BOOST_TEST(members[2] == &value.double_field);
+
+    // Fields can be parsed in any order
+    auto fns = get_field_parse_fns<sinherit>();
+    BOOST_TEST(fns[2](field_view(8.1), members[2]) == error_code());
+    BOOST_TEST(fns[0](field_view(42), members[0]) == error_code());
+    BOOST_TEST(fns[1](field_view(4.3f), members[1]) == error_code());
+    BOOST_TEST(value.i == 42);
+    BOOST_TEST(value.f == 4.3f);
+    BOOST_TEST(value.double_field == 8.1);
+
+    // Errors are reported
+    BOOST_TEST(fns[0](field_view(), members[0]) == client_errc::static_row_parsing_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 //
@@ -652,6 +680,32 @@ BOOST_AUTO_TEST_CASE(parse_empty_tuple)
     BOOST_TEST(err == error_code());
 }
 
+// field-by-field parsing
+static_assert(get_field_parse_fns<tempty>().size() == 0u, "");
+static_assert(get_field_parse_fns<t3>().size() == 3u, "");
+
+BOOST_AUTO_TEST_CASE(parse_fields)
+{
+    t3 value;
+    void* members[3]{};
+    get_member_addresses<t3>(value, members);
+    BOOST_TEST(members[0] == &std::get<0>(value));
+    BOOST_TEST(members[1] == &std::get<1>(value));
+    BOOST_TEST(members[2] == &std::get<2>(value));
+
+    // Fields can be parsed in any order
+    auto fns = get_field_parse_fns<t3>();
+    BOOST_TEST(fns[1](field_view(42), members[1]) == error_code());
+    BOOST_TEST(fns[0](field_view("abc"), members[0]) == error_code());
+    BOOST_TEST(fns[2](field_view(9.1), members[2]) == error_code());
+    BOOST_TEST(std::get<0>(value) == "abc");
+    BOOST_TEST(std::get<1>(value) == 42);
+    BOOST_TEST(std::get<2>(value) == 9.1);
+
+    // Errors are reported
+    BOOST_TEST(fns[2](field_view("abc"), members[2]) == client_errc::static_row_parsing_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 //
@@ -0,0 +1,321 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/arrow_c_data_interface.hpp>
+#include <boost/mysql/arrow_execution_state.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/field_kind.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/execution_processor/arrow_execution_state_impl.hpp>
+#include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+#include <boost/mysql/detail/resultset_encoding.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "execution_processor_helpers.hpp"
+#include "test_common/create_basic.hpp"
+#include "test_common/printing.hpp"
+#include "test_unit/create_execution_processor.hpp"
+#include "test_unit/create_meta.hpp"
+#include "test_unit/create_ok.hpp"
+#include "test_unit/create_row_message.hpp"
+#include "test_unit/printing.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+using boost::mysql::detail::arrow_execution_state_impl;
+using boost::mysql::detail::output_ref;
+using boost::mysql::detail::resultset_encoding;
+
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_arrow_execution_state_impl)
+
+// Values in Arrow buffers
+template <class T>
+T buffer_value(const ArrowArray& arr, std::size_t buffer, std::size_t i)
+{
+    return static_cast<const T*>(arr.buffers[buffer])[i];
+}
+
+string_view string_value(const ArrowArray& arr, std::size_t i)
+{
+    const auto* offsets = static_cast<const std::size_t*>(arr.buffers[1]);
+    const auto* data = static_cast<const char*>(arr.buffers[2]);
+    return string_view(data + offsets[i], offsets[i + 1] - offsets[i]);
+}
+
+bool is_valid(const ArrowArray& arr, std::size_t i)
+{
+    if (arr.buffers[0] == nullptr)
+        return true;
+    return static_cast<const std::uint8_t*>(arr.buffers[0])[i / 8u] & (1u << (i % 8u));
+}
+
+struct fixture
+{
+    diagnostics diag;
+    std::vector<field_view> fields;
+    arrow_execution_state_impl st{3};
+};
+
+BOOST_AUTO_TEST_CASE(get_arrow_format)
+{
+    string_view large_string = sizeof(std::size_t) == 8u ? "U" : "u";
+    string_view large_blob = sizeof(std::size_t) == 8u ? "Z" : "z";
+    BOOST_TEST(string_view(detail::get_arrow_format(field_kind::int64)) == "l");
+    BOOST_TEST(string_view(detail::get_arrow_format(field_kind::uint64)) == "L");
+    BOOST_TEST(string_view(detail::get_arrow_format(field_kind::float_)) == "f");
+    BOOST_TEST(string_view(detail::get_arrow_format(field_kind::double_)) == "g");
+    BOOST_TEST(string_view(detail::get_arrow_format(field_kind::date)) == "tdD");
+    BOOST_TEST(string_view(detail::get_arrow_format(field_kind::datetime)) == "tsu:");
+    BOOST_TEST(string_view(detail::get_arrow_format(field_kind::time)) == "tDu");
+    BOOST_TEST(string_view(detail::get_arrow_format(field_kind::string)) == large_string);
+    BOOST_TEST(string_view(detail::get_arrow_format(field_kind::blob)) == large_blob);
+}
+
+BOOST_FIXTURE_TEST_CASE(export_schema, fixture)
+{
+    exec_access(st)
+        .reset(resultset_encoding::text, metadata_mode::full)
+        .meta({
+            meta_builder().type(column_type::bigint).name("id").nullable(false).build_coldef(),
+            meta_builder().type(column_type::varchar).name("name").build_coldef(),
+            meta_builder().type(column_type::date).name("birth").nullable(false).build_coldef(),
+        });
+
+    ArrowSchema schema{};
+    st.export_schema(schema);
+
+    BOOST_TEST(string_view(schema.format) == "+s");
+    BOOST_TEST(string_view(schema.name) == "");
+    BOOST_TEST(schema.flags == 0);
+    BOOST_TEST(schema.dictionary == nullptr);
+    BOOST_TEST_REQUIRE(schema.n_children == 3);
+
+    const ArrowSchema& c0 = *schema.children[0];
+    BOOST_TEST(string_view(c0.format) == "l");
+    BOOST_TEST(string_view(c0.name) == "id");
+    BOOST_TEST(c0.flags == 0);
+    BOOST_TEST(c0.n_children == 0);
+
+    const ArrowSchema& c1 = *schema.children[1];
+    BOOST_TEST(string_view(c1.format) == (sizeof(std::size_t) == 8u ? "U" : "u"));
+    BOOST_TEST(string_view(c1.name) == "name");
+    BOOST_TEST(c1.flags == ARROW_FLAG_NULLABLE);
+
+    // Dates are always nullable, since invalid dates are exported as NULL
+    const ArrowSchema& c2 = *schema.children[2];
+    BOOST_TEST(string_view(c2.format) == "tdD");
+    BOOST_TEST(string_view(c2.name) == "birth");
+    BOOST_TEST(c2.flags == ARROW_FLAG_NULLABLE);
+
+    schema.release(&schema);
+    BOOST_TEST(schema.release == nullptr);
+}
+
+BOOST_FIXTURE_TEST_CASE(export_batch, fixture)
+{
+    exec_access(st)
+        .reset()
+        .meta({
+            meta_builder().type(column_type::bigint).build_coldef(),
+            meta_builder().type(column_type::varchar).build_coldef(),
+            meta_builder().type(column_type::date).build_coldef(),
+            meta_builder().type(column_type::datetime).build_coldef(),
+            meta_builder().type(column_type::time).build_coldef(),
+        })
+        .row(42, "abc", "1970-01-02", "1970-01-01 00:00:01", "01:00:00")
+        .row(nullptr, nullptr, "0000-00-00", nullptr, "-00:00:01");
+    BOOST_TEST(st.num_buffered_rows() == 2u);
+
+    ArrowArray arr{};
+    BOOST_TEST(st.export_batch(arr) == 2u);
+    BOOST_TEST(st.num_buffered_rows() == 0u);
+
+    // The top-level struct
+    BOOST_TEST(arr.length == 2);
+    BOOST_TEST(arr.null_count == 0);
+    BOOST_TEST(arr.offset == 0);
+    BOOST_TEST(arr.n_buffers == 1);
+    BOOST_TEST(arr.buffers[0] == nullptr);
+    BOOST_TEST_REQUIRE(arr.n_children == 5);
+
+    // Integers
+    const ArrowArray& c0 = *arr.children[0];
+    BOOST_TEST(c0.length == 2);
+    BOOST_TEST(c0.null_count == 1);
+    BOOST_TEST(c0.n_buffers == 2);
+    BOOST_TEST(is_valid(c0, 0));
+    BOOST_TEST(!is_valid(c0, 1));
+    BOOST_TEST(buffer_value<std::int64_t>(c0, 1, 0) == 42);
+
+    // Strings
+    const ArrowArray& c1 = *arr.children[1];
+    BOOST_TEST(c1.null_count == 1);
+    BOOST_TEST(c1.n_buffers == 3);
+    BOOST_TEST(string_value(c1, 0) == "abc");
+    BOOST_TEST(string_value(c1, 1) == "");
+    BOOST_TEST(!is_valid(c1, 1));
+
+    // Dates. Invalid dates become NULL
+    const ArrowArray& c2 = *arr.children[2];
+    BOOST_TEST(c2.null_count == 1);
+    BOOST_TEST(buffer_value<std::int32_t>(c2, 1, 0) == 1);
+    BOOST_TEST(is_valid(c2, 0));
+    BOOST_TEST(!is_valid(c2, 1));
+
+    // Datetimes
+    const ArrowArray& c3 = *arr.children[3];
+    BOOST_TEST(c3.null_count == 1);
+    BOOST_TEST(buffer_value<std::int64_t>(c3, 1, 0) == 1000000);
+
+    // Times. No NULLs, so there is no validity buffer
+    const ArrowArray& c4 = *arr.children[4];
+    BOOST_TEST(c4.null_count == 0);
+    BOOST_TEST(c4.buffers[0] == nullptr);
+    BOOST_TEST(buffer_value<std::int64_t>(c4, 1, 0) == 3600000000);
+    BOOST_TEST(buffer_value<std::int64_t>(c4, 1, 1) == -1000000);
+
+    arr.release(&arr);
+    BOOST_TEST(arr.release == nullptr);
+}
+
+BOOST_FIXTURE_TEST_CASE(batch_size, fixture)
+{
+    exec_access(st).reset().meta(create_meta_r2());
+    BOOST_TEST(st.make_output_ref().max_size() == 3u);
+
+    exec_access(st).row(1).row(2);
+    BOOST_TEST(st.make_output_ref().max_size() == 1u);
+
+    exec_access(st).row(3);
+    BOOST_TEST(st.make_output_ref().max_size() == 0u);
+
+    // Exporting starts a new batch
+    ArrowArray arr{};
+    BOOST_TEST(st.export_batch(arr) == 3u);
+    BOOST_TEST(st.make_output_ref().max_size() == 3u);
+    arr.release(&arr);
+
+    // New rows go to the new batch
+    exec_access(st).row(4).ok(create_ok_r2());
+    BOOST_TEST(st.is_complete());
+    BOOST_TEST(st.export_batch(arr) == 1u);
+    BOOST_TEST(arr.length == 1);
+    BOOST_TEST(buffer_value<std::int64_t>(*arr.children[0], 1, 0) == 4);
+    arr.release(&arr);
+
+    // Exporting an empty batch is allowed
+    BOOST_TEST(st.export_batch(arr) == 0u);
+    BOOST_TEST(arr.length == 0);
+    BOOST_TEST(arr.children[0]->length == 0);
+    arr.release(&arr);
+}
+
+// Consumers may move children out of the parent array
+BOOST_FIXTURE_TEST_CASE(move_child, fixture)
+{
+    exec_access(st).reset().meta(create_meta_r1()).row(42, "abc");
+
+    ArrowArray arr{};
+    st.export_batch(arr);
+
+    ArrowArray child = *arr.children[1];
+    arr.children[1]->release = nullptr;
+    arr.release(&arr);
+
+    BOOST_TEST(child.length == 1);
+    BOOST_TEST(string_value(child, 0) == "abc");
+    child.release(&child);
+    BOOST_TEST(child.release == nullptr);
+}
+
+BOOST_FIXTURE_TEST_CASE(two_resultsets, fixture)
+{
+    // First resultset. Unexported rows are discarded when a new resultset starts
+    exec_access(st).reset().meta(create_meta_r1()).row(42, "abc").ok(create_ok_r1(true));
+    BOOST_TEST(st.is_reading_first_subseq());
+    BOOST_TEST(st.num_buffered_rows() == 1u);
+    BOOST_TEST(st.get_affected_rows() == 1u);
+    BOOST_TEST(st.get_info() == "Information");
+
+    // Second resultset
+    exec_access(st).meta(create_meta_r2());
+    check_meta_r2(st.meta());
+    BOOST_TEST(st.num_buffered_rows() == 0u);
+    exec_access(st).row(70).ok(create_ok_r2());
+
+    BOOST_TEST(st.is_complete());
+    BOOST_TEST(st.get_affected_rows() == 5u);
+    BOOST_TEST(st.get_is_out_params());
+    ArrowArray arr{};
+    BOOST_TEST(st.export_batch(arr) == 1u);
+    BOOST_TEST(arr.n_children == 1);
+    BOOST_TEST(buffer_value<std::int64_t>(*arr.children[0], 1, 0) == 70);
+    arr.release(&arr);
+}
+
+BOOST_FIXTURE_TEST_CASE(error_deserializing_row, fixture)
+{
+    exec_access(st).reset().meta({column_type::varchar, column_type::bigint}).row("abc", 42);
+
+    auto bad_row = create_text_row_body("def", "bad");
+    st.on_row_batch_start();
+    auto err = st.on_row(bad_row, output_ref(), fields);
+    st.on_row_batch_finish();
+    BOOST_TEST(err == client_errc::protocol_value_error);
+    BOOST_TEST(st.num_buffered_rows() == 1u);
+
+    ArrowArray arr{};
+    st.export_batch(arr);
+    BOOST_TEST(arr.children[0]->length == 1);
+    BOOST_TEST(string_value(*arr.children[0], 0) == "abc");
+    BOOST_TEST(arr.children[1]->length == 1);
+    arr.release(&arr);
+}
+
+// The public interface
+BOOST_AUTO_TEST_CASE(public_interface)
+{
+    arrow_execution_state st(2);
+    BOOST_TEST(st.should_start_op());
+    BOOST_TEST(st.batch_size() == 2u);
+    BOOST_TEST(!st.batch_full());
+
+    exec_access(get_iface(st)).reset().meta(create_meta_r2()).row(1).row(2);
+    BOOST_TEST(st.should_read_rows());
+    BOOST_TEST(st.num_buffered_rows() == 2u);
+    BOOST_TEST(st.batch_full());
+    check_meta_r2(st.meta());
+
+    ArrowArray arr{};
+    BOOST_TEST(st.export_batch(arr) == 2u);
+    BOOST_TEST(!st.batch_full());
+    arr.release(&arr);
+
+    exec_access(get_iface(st)).ok(create_ok_r2());
+    BOOST_TEST(st.complete());
+    BOOST_TEST(st.affected_rows() == 5u);
+    BOOST_TEST(st.last_insert_id() == 6u);
+    BOOST_TEST(st.warning_count() == 8u);
+    BOOST_TEST(st.info() == "more_info");
+    BOOST_TEST(st.is_out_params());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
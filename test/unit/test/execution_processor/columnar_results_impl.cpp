@@ -0,0 +1,409 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/column_view.hpp>
+#include <boost/mysql/columnar_results.hpp>
+#include <boost/mysql/date.hpp>
+#include <boost/mysql/datetime.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/field_kind.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/string_view.hpp>
+#include <boost/mysql/throw_on_error.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/execution_processor/columnar_results_impl.hpp>
+#include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+#include <boost/mysql/detail/resultset_encoding.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "execution_processor_helpers.hpp"
+#include "test_common/create_basic.hpp"
+#include "test_common/printing.hpp"
+#include "test_unit/create_execution_processor.hpp"
+#include "test_unit/create_meta.hpp"
+#include "test_unit/create_ok.hpp"
+#include "test_unit/create_row_message.hpp"
+#include "test_unit/printing.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+using boost::mysql::detail::column_data;
+using boost::mysql::detail::columnar_results_impl;
+using boost::mysql::detail::output_ref;
+using boost::mysql::detail::resultset_encoding;
+
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_columnar_results_impl)
+
+// OK packet checking
+void check_ok_r1(const columnar_results_impl& st, std::size_t idx)
+{
+    BOOST_TEST(st.get_affected_rows(idx) == 1u);
+    BOOST_TEST(st.get_last_insert_id(idx) == 2u);
+    BOOST_TEST(st.get_warning_count(idx) == 4u);
+    BOOST_TEST(st.get_info(idx) == "Information");
+    BOOST_TEST(st.get_is_out_params(idx) == false);
+}
+
+void check_ok_r2(const columnar_results_impl& st, std::size_t idx)
+{
+    BOOST_TEST(st.get_affected_rows(idx) == 5u);
+    BOOST_TEST(st.get_last_insert_id(idx) == 6u);
+    BOOST_TEST(st.get_warning_count(idx) == 8u);
+    BOOST_TEST(st.get_info(idx) == "more_info");
+    BOOST_TEST(st.get_is_out_params(idx) == true);
+}
+
+std::vector<std::int64_t> int64_values(const column_data& col)
+{
+    return std::vector<std::int64_t>(col.int64_values.begin(), col.int64_values.end());
+}
+
+std::vector<std::size_t> offsets(const column_data& col)
+{
+    return std::vector<std::size_t>(col.offsets.begin(), col.offsets.end());
+}
+
+string_view bytes(const column_data& col)
+{
+    return string_view(reinterpret_cast<const char*>(col.bytes.data()), col.bytes.size());
+}
+
+BOOST_AUTO_TEST_SUITE(column_data_)
+BOOST_AUTO_TEST_CASE(append_int64)
+{
+    column_data col(field_kind::int64);
+    for (std::int64_t i = 0; i < 10; ++i)
+        col.append(i % 3 == 0 ? field_view() : field_view(i));
+
+    BOOST_TEST(col.size == 10u);
+    BOOST_TEST(col.null_count == 4u);
+    BOOST_TEST(int64_values(col) == (std::vector<std::int64_t>{0, 1, 2, 0, 4, 5, 0, 7, 8, 0}));
+    BOOST_TEST(col.validity == (std::vector<std::uint8_t>{0xb6, 0x01}));
+    BOOST_TEST(col.is_null(0));
+    BOOST_TEST(!col.is_null(1));
+    BOOST_TEST(col.is_null(9));
+}
+
+BOOST_AUTO_TEST_CASE(append_string)
+{
+    column_data col(field_kind::string);
+    BOOST_TEST(offsets(col) == (std::vector<std::size_t>{0u}));
+    col.append(field_view("abc"));
+    col.append(field_view());
+    col.append(field_view(""));
+    col.append(field_view("de"));
+
+    BOOST_TEST(col.size == 4u);
+    BOOST_TEST(col.null_count == 1u);
+    BOOST_TEST(offsets(col) == (std::vector<std::size_t>{0u, 3u, 3u, 3u, 5u}));
+    BOOST_TEST(bytes(col) == "abcde");
+    BOOST_TEST(col.validity == (std::vector<std::uint8_t>{0x0d}));
+}
+
+BOOST_AUTO_TEST_CASE(truncate)
+{
+    column_data col(field_kind::string);
+    for (int i = 0; i < 10; ++i)
+        col.append(i % 2 == 0 ? field_view() : field_view("ab"));
+
+    col.truncate(9);
+    BOOST_TEST(col.size == 9u);
+    BOOST_TEST(col.null_count == 5u);
+    BOOST_TEST(col.validity == (std::vector<std::uint8_t>{0xaa, 0x00}));
+    BOOST_TEST(bytes(col) == "abababab");
+
+    col.truncate(3);
+    BOOST_TEST(col.size == 3u);
+    BOOST_TEST(col.null_count == 2u);
+    BOOST_TEST(col.validity == (std::vector<std::uint8_t>{0x02}));
+    BOOST_TEST(offsets(col) == (std::vector<std::size_t>{0u, 0u, 2u, 2u}));
+    BOOST_TEST(bytes(col) == "ab");
+
+    col.truncate(0);
+    BOOST_TEST(col.size == 0u);
+    BOOST_TEST(col.null_count == 0u);
+    BOOST_TEST(col.validity.empty());
+    BOOST_TEST(offsets(col) == (std::vector<std::size_t>{0u}));
+}
+
+BOOST_AUTO_TEST_CASE(get_column_kind)
+{
+    struct
+    {
+        column_type type;
+        bool is_unsigned;
+        field_kind expected;
+    } test_cases[] = {
+        {column_type::tinyint,   false, field_kind::int64   },
+        {column_type::int_,      true,  field_kind::uint64  },
+        {column_type::bigint,    false, field_kind::int64   },
+        {column_type::year,      true,  field_kind::uint64  },
+        {column_type::bit,       true,  field_kind::uint64  },
+        {column_type::float_,    false, field_kind::float_  },
+        {column_type::double_,   false, field_kind::double_ },
+        {column_type::date,      false, field_kind::date    },
+        {column_type::datetime,  false, field_kind::datetime},
+        {column_type::timestamp, false, field_kind::datetime},
+        {column_type::time,      false, field_kind::time    },
+        {column_type::varchar,   false, field_kind::string  },
+        {column_type::decimal,   false, field_kind::string  },
+        {column_type::json,      false, field_kind::string  },
+        {column_type::varbinary, false, field_kind::blob    },
+        {column_type::geometry,  false, field_kind::blob    },
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.type)
+        {
+            auto meta = meta_builder().type(tc.type).unsigned_flag(tc.is_unsigned).build();
+            BOOST_TEST(detail::get_column_kind(meta) == tc.expected);
+        }
+    }
+}
+BOOST_AUTO_TEST_SUITE_END()
+
+struct fixture
+{
+    diagnostics diag;
+    std::vector<field_view> fields;
+    columnar_results_impl r;
+};
+
+BOOST_FIXTURE_TEST_CASE(one_resultset_data, fixture)
+{
+    // Initial. Check that we reset any previous state
+    exec_access(r)
+        .meta({column_type::geometry})
+        .row(makebv("\0\0"))
+        .ok(ok_builder().affected_rows(40).info("some_info").more_results(true).build())
+        .meta({column_type::varchar, column_type::mediumint})
+        .row("aaaa", 42)
+        .ok(ok_builder().info("more_info").more_results(true).build());
+    r.reset(resultset_encoding::text, metadata_mode::minimal);
+    BOOST_TEST(r.is_reading_first());
+
+    // Head indicates resultset with two columns
+    r.on_num_meta(2);
+    BOOST_TEST(r.is_reading_meta());
+
+    // Metadata
+    auto err = r.on_meta(create_meta_r1_0(), diag);
+    throw_on_error(err, diag);
+    err = r.on_meta(create_meta_r1_1(), diag);
+    throw_on_error(err, diag);
+    BOOST_TEST(r.is_reading_rows());
+
+    // Rows
+    auto r1 = create_text_row_body(42, "abc");
+    auto r2 = create_text_row_body(nullptr, "defg");
+    r.on_row_batch_start();
+    err = r.on_row(r1, output_ref(), fields);
+    throw_on_error(err, diag);
+    err = r.on_row(r2, output_ref(), fields);
+    throw_on_error(err, diag);
+    BOOST_TEST(r.is_reading_rows());
+
+    // End of resultset
+    err = r.on_row_ok_packet(create_ok_r1());
+    throw_on_error(err, diag);
+    r.on_row_batch_finish();
+
+    // Verify
+    BOOST_TEST(r.is_complete());
+    BOOST_TEST(r.num_resultsets() == 1u);
+    check_meta_r1(r.get_meta(0));
+    check_ok_r1(r, 0);
+    BOOST_TEST(r.get_num_rows(0) == 2u);
+    const auto& col0 = r.get_column(0, 0);
+    BOOST_TEST(col0.kind == field_kind::int64);
+    BOOST_TEST(int64_values(col0) == (std::vector<std::int64_t>{42, 0}));
+    BOOST_TEST(col0.null_count == 1u);
+    BOOST_TEST(col0.is_null(1));
+    const auto& col1 = r.get_column(0, 1);
+    BOOST_TEST(col1.kind == field_kind::string);
+    BOOST_TEST(offsets(col1) == (std::vector<std::size_t>{0u, 3u, 7u}));
+    BOOST_TEST(bytes(col1) == "abcdefg");
+    BOOST_TEST(fields.empty());  // unused
+}
+
+BOOST_FIXTURE_TEST_CASE(one_resultset_empty, fixture)
+{
+    auto err = r.on_head_ok_packet(create_ok_r1(), diag);
+    throw_on_error(err, diag);
+
+    BOOST_TEST(r.is_complete());
+    BOOST_TEST(r.num_resultsets() == 1u);
+    check_meta_empty(r.get_meta(0));
+    check_ok_r1(r, 0);
+    BOOST_TEST(r.get_num_rows(0) == 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(rows_accumulate_across_batches, fixture)
+{
+    exec_access(r).meta(create_meta_r2()).row(1).row(2);
+    BOOST_TEST(r.is_reading_rows());
+    BOOST_TEST(r.get_num_rows(0) == 2u);
+
+    exec_access(r).row(3).ok(create_ok_r2());
+
+    BOOST_TEST(r.is_complete());
+    BOOST_TEST(r.get_num_rows(0) == 3u);
+    BOOST_TEST(int64_values(r.get_column(0, 0)) == (std::vector<std::int64_t>{1, 2, 3}));
+}
+
+BOOST_FIXTURE_TEST_CASE(two_resultsets, fixture)
+{
+    // Resultset r1
+    exec_access(r).meta(create_meta_r1()).row(42, "abc").row(50, "def");
+    auto err = r.on_row_ok_packet(create_ok_r1(true));
+    throw_on_error(err, diag);
+    BOOST_TEST(r.is_reading_first_subseq());
+
+    // Resultset r2
+    exec_access(r).meta(create_meta_r2()).row(70).ok(create_ok_r2());
+
+    // Verify
+    BOOST_TEST(r.is_complete());
+    BOOST_TEST(r.num_resultsets() == 2u);
+    check_meta_r1(r.get_meta(0));
+    check_meta_r2(r.get_meta(1));
+    check_ok_r1(r, 0);
+    check_ok_r2(r, 1);
+    BOOST_TEST(r.get_num_rows(0) == 2u);
+    BOOST_TEST(r.get_num_rows(1) == 1u);
+    BOOST_TEST(int64_values(r.get_column(0, 0)) == (std::vector<std::int64_t>{42, 50}));
+    BOOST_TEST(bytes(r.get_column(0, 1)) == "abcdef");
+    BOOST_TEST(int64_values(r.get_column(1, 0)) == (std::vector<std::int64_t>{70}));
+}
+
+BOOST_FIXTURE_TEST_CASE(column_types, fixture)
+{
+    // clang-format off
+    exec_access(r)
+        .meta({
+            meta_builder().type(column_type::bigint).unsigned_flag(true).build_coldef(),
+            meta_builder().type(column_type::double_).build_coldef(),
+            meta_builder().type(column_type::date).build_coldef(),
+            meta_builder().type(column_type::datetime).build_coldef(),
+            meta_builder().type(column_type::blob).build_coldef(),
+        })
+        .row(10u, 4.2, "2020-01-02", "2021-03-04 10:20:30", makebv("\0\1"))
+        .row(nullptr, nullptr, nullptr, nullptr, nullptr)
+        .ok(create_ok_r1());
+    // clang-format on
+
+    BOOST_TEST(r.get_num_rows(0) == 2u);
+    const auto& c0 = r.get_column(0, 0);
+    BOOST_TEST(c0.kind == field_kind::uint64);
+    BOOST_TEST(c0.uint64_values == (std::vector<std::uint64_t>{10u, 0u}));
+    const auto& c1 = r.get_column(0, 1);
+    BOOST_TEST(c1.kind == field_kind::double_);
+    BOOST_TEST(c1.double_values == (std::vector<double>{4.2, 0.0}));
+    const auto& c2 = r.get_column(0, 2);
+    BOOST_TEST(c2.kind == field_kind::date);
+    BOOST_TEST(c2.date_values == (std::vector<date>{date(2020, 1, 2), date()}));
+    const auto& c3 = r.get_column(0, 3);
+    BOOST_TEST(c3.kind == field_kind::datetime);
+    BOOST_TEST(c3.datetime_values == (std::vector<datetime>{datetime(2021, 3, 4, 10, 20, 30), datetime()}));
+    const auto& c4 = r.get_column(0, 4);
+    BOOST_TEST(c4.kind == field_kind::blob);
+    BOOST_TEST(offsets(c4) == (std::vector<std::size_t>{0u, 2u, 2u}));
+    for (const auto* c : {&c0, &c1, &c2, &c3, &c4})
+    {
+        BOOST_TEST(c->null_count == 1u);
+        BOOST_TEST(c->validity == (std::vector<std::uint8_t>{0x01}));
+    }
+}
+
+// If a row fails to deserialize, values appended by the row are removed,
+// so all columns keep the same size
+BOOST_FIXTURE_TEST_CASE(error_deserializing_row, fixture)
+{
+    exec_access(r).meta({column_type::varchar, column_type::bigint}).row("abc", 42);
+
+    auto bad_row = create_text_row_body("def", "bad");
+    r.on_row_batch_start();
+    auto err = r.on_row(bad_row, output_ref(), fields);
+    r.on_row_batch_finish();
+
+    BOOST_TEST(err == client_errc::protocol_value_error);
+    BOOST_TEST(r.get_num_rows(0) == 1u);
+    BOOST_TEST(r.get_column(0, 0).size == 1u);
+    BOOST_TEST(offsets(r.get_column(0, 0)) == (std::vector<std::size_t>{0u, 3u}));
+    BOOST_TEST(bytes(r.get_column(0, 0)) == "abc");
+    BOOST_TEST(r.get_column(0, 1).size == 1u);
+    BOOST_TEST(int64_values(r.get_column(0, 1)) == (std::vector<std::int64_t>{42}));
+}
+
+// The public interface
+BOOST_AUTO_TEST_CASE(public_interface)
+{
+    columnar_results res;
+    BOOST_TEST(res.should_start_op());
+    BOOST_TEST(!res.has_value());
+
+    exec_access(get_iface(res))
+        .reset()
+        .meta({column_type::int_, column_type::varchar, column_type::varbinary})
+        .row(10, "abc", makebv("\1\2"))
+        .row(nullptr, nullptr, nullptr)
+        .ok(create_ok_r1());
+
+    BOOST_TEST(res.has_value());
+    BOOST_TEST(res.complete());
+    BOOST_TEST(res.size() == 1u);
+    BOOST_TEST(res.meta().size() == 3u);
+    BOOST_TEST(res.num_rows() == 2u);
+    BOOST_TEST(res.affected_rows() == 1u);
+    BOOST_TEST(res.last_insert_id() == 2u);
+    BOOST_TEST(res.warning_count() == 4u);
+    BOOST_TEST(res.info() == "Information");
+    BOOST_TEST(!res.is_out_params());
+
+    // Integer column
+    auto c0 = res.column(0);
+    BOOST_TEST(c0.kind() == field_kind::int64);
+    BOOST_TEST(c0.size() == 2u);
+    BOOST_TEST(c0.null_count() == 1u);
+    BOOST_TEST(c0.int64_values().size() == 2u);
+    BOOST_TEST(c0.int64_values()[0] == 10);
+    BOOST_TEST(!c0.is_null(0));
+    BOOST_TEST(c0.is_null(1));
+    BOOST_TEST(c0.validity_bitmap().size() == 1u);
+    BOOST_TEST(c0.at(0) == field_view(10));
+    BOOST_TEST(c0.at(1) == field_view());
+
+    // String column
+    auto c1 = res.column(1);
+    BOOST_TEST(c1.kind() == field_kind::string);
+    BOOST_TEST(c1.offsets().size() == 3u);
+    BOOST_TEST(c1.get_string(0) == "abc");
+    BOOST_TEST(c1.get_string(1) == "");
+    BOOST_TEST(c1.at(0) == field_view("abc"));
+    BOOST_TEST(c1.at(1) == field_view());
+
+    // Blob column
+    auto c2 = res.column(2);
+    BOOST_TEST(c2.kind() == field_kind::blob);
+    BOOST_TEST(c2.bytes().size() == 2u);
+    BOOST_TEST(c2.at(0) == field_view(makebv("\1\2")));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
@@ -11,6 +11,8 @@
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/session_track.hpp>
+#include <boost/mysql/session_track_view.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
@@ -339,6 +341,29 @@ BOOST_FIXTURE_TEST_CASE(info_string_ownserhip, fixture)
     BOOST_TEST(st.get_info() == "other info");
 }
 
+BOOST_FIXTURE_TEST_CASE(session_track_ownership, fixture)
+{
+    // OK packet received, doesn't own the data. A schema change item
+    std::string track("\x01\x05\x04" "mydb", 7);
+    auto err = st.on_head_ok_packet(ok_builder().more_results(true).session_state_info(track).build(), diag);
+    throw_on_error(err, diag);
+
+    // st does, so changing track doesn't affect
+    track = "abcdefg";
+    std::vector<session_track_item> items(st.get_session_track().begin(), st.get_session_track().end());
+    BOOST_TEST_REQUIRE(items.size() == 1u);
+    BOOST_TEST(items[0].type == session_track_type::schema);
+    BOOST_TEST(items[0].value == "mydb");
+
+    // A new resultset without session state information clears it
+    st.on_num_meta(1);
+    err = st.on_meta(meta_builder().build_coldef(), diag);
+    throw_on_error(err, diag);
+    err = st.on_row_ok_packet(ok_builder().build());
+    throw_on_error(err, diag);
+    BOOST_TEST(st.get_session_track().empty());
+}
+
 BOOST_FIXTURE_TEST_CASE(error_deserializing_row, fixture)
 {
     add_meta(st, create_meta_r1());
@@ -11,6 +11,8 @@
 #include <boost/mysql/metadata_mode.hpp>
 #include <boost/mysql/row_view.hpp>
 #include <boost/mysql/rows_view.hpp>
+#include <boost/mysql/session_track.hpp>
+#include <boost/mysql/session_track_view.hpp>
 #include <boost/mysql/string_view.hpp>
 #include <boost/mysql/throw_on_error.hpp>
 
@@ -502,6 +504,36 @@ BOOST_FIXTURE_TEST_CASE(info_string_ownserhip, fixture)
     BOOST_TEST(r.get_info(2) == "other info");
 }
 
+BOOST_FIXTURE_TEST_CASE(session_track_ownership, fixture)
+{
+    // Head OK packet. A schema change item
+    std::string track("\x01\x05\x04" "mydb", 7);
+    auto err = r.on_head_ok_packet(ok_builder().more_results(true).session_state_info(track).build(), diag);
+    throw_on_error(err, diag);
+
+    // OK packet without session state information
+    err = r.on_head_ok_packet(ok_builder().more_results(true).build(), diag);
+    throw_on_error(err, diag);
+
+    // Row OK packet
+    track = std::string("\x01\x04\x03" "db2", 6);
+    add_meta(r, create_meta_r2());
+    err = r.on_row_ok_packet(ok_builder().session_state_info(track).build());
+    throw_on_error(err, diag);
+    track = "abcdfefgh";
+
+    // r owns the data, so changing track doesn't affect it
+    BOOST_TEST_REQUIRE(r.num_resultsets() == 3u);
+    std::vector<session_track_item> items0(r.get_session_track(0).begin(), r.get_session_track(0).end());
+    BOOST_TEST_REQUIRE(items0.size() == 1u);
+    BOOST_TEST(items0[0].type == session_track_type::schema);
+    BOOST_TEST(items0[0].value == "mydb");
+    BOOST_TEST(r.get_session_track(1).empty());
+    std::vector<session_track_item> items2(r.get_session_track(2).begin(), r.get_session_track(2).end());
+    BOOST_TEST_REQUIRE(items2.size() == 1u);
+    BOOST_TEST(items2[0].value == "db2");
+}
+
 BOOST_FIXTURE_TEST_CASE(multiple_row_batches, fixture)
 {
     // Initial
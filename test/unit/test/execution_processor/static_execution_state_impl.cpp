@@ -414,7 +414,7 @@ BOOST_FIXTURE_TEST_CASE(repeated_row_types, fixture)
     BOOST_TEST((storage[0] == row1{"abc", 10}));
 }
 
-// Verify that we clear the fields before adding new ones
+// Rows are parsed directly into the output, without using the fields vector
 BOOST_FIXTURE_TEST_CASE(storage_reuse, fixture)
 {
     static_execst_t<row1> stp;
@@ -433,7 +433,7 @@ BOOST_FIXTURE_TEST_CASE(storage_reuse, fixture)
     // Verify results
     BOOST_TEST((storage[0] == row1{"abc", 42}));
     BOOST_TEST((storage[1] == row1{"def", 43}));
-    BOOST_TEST(fields.size() == 2u);
+    BOOST_TEST(fields.empty());
 }
 
 BOOST_FIXTURE_TEST_CASE(error_meta_mismatch, fixture)
@@ -492,6 +492,20 @@ BOOST_FIXTURE_TEST_CASE(error_parsing_row, fixture)
     BOOST_TEST(err == client_errc::static_row_parsing_error);
 }
 
+// Deserialization errors take precedence over parsing errors
+BOOST_FIXTURE_TEST_CASE(error_deserializing_and_parsing_row, fixture)
+{
+    static_execst_t<row1> stp;
+    auto& st = stp.get_interface();
+    add_meta(st, create_meta_r1());
+    auto bad_row = create_text_row_body(nullptr, "abc");  // should not be NULL
+    bad_row.push_back(0xff);
+
+    row1 storage[1]{};
+    auto err = st.on_row(bad_row, stp.make_output_ref(span<row1>(storage), 0), fields);
+    BOOST_TEST(err == client_errc::extra_bytes);
+}
+
 BOOST_FIXTURE_TEST_CASE(error_type_index_mismatch, fixture)
 {
     static_execst_t<row1, row2> stp;
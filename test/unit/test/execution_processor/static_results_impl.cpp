@@ -486,7 +486,7 @@ BOOST_FIXTURE_TEST_CASE(info_string_ownserhip, fixture)
     BOOST_TEST(r.get_info(2) == "other info");
 }
 
-// Verify that we clear the fields before adding new ones
+// Rows are parsed directly into the output, without using the fields vector
 BOOST_FIXTURE_TEST_CASE(storage_reuse, fixture)
 {
     static_res_t<row1> rt;
@@ -509,7 +509,7 @@ BOOST_FIXTURE_TEST_CASE(storage_reuse, fixture)
         {"abc", 42},
         {"def", 43},
     };
-    BOOST_TEST(fields.size() == 2u);
+    BOOST_TEST(fields.empty());
     check_rows(rt.get_rows<0>(), expected_r1);
 }
 
@@ -568,6 +568,19 @@ BOOST_FIXTURE_TEST_CASE(error_parsing_row, fixture)
     BOOST_TEST(err == client_errc::static_row_parsing_error);
 }
 
+// Deserialization errors take precedence over parsing errors
+BOOST_FIXTURE_TEST_CASE(error_deserializing_and_parsing_row, fixture)
+{
+    static_res_t<row1> rt;
+    auto& r = rt.get_interface();
+    add_meta(r, create_meta_r1());
+    auto bad_row = create_text_row_body(nullptr, "abc");  // should not be NULL
+    bad_row.push_back(0xff);
+
+    auto err = r.on_row(bad_row, output_ref(), fields);
+    BOOST_TEST(err == client_errc::extra_bytes);
+}
+
 BOOST_FIXTURE_TEST_CASE(error_too_few_resultsets_empty, fixture)
 {
     static_res_t<empty, row2> rt;
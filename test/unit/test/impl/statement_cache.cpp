@@ -0,0 +1,139 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/statement.hpp>
+
+#include <boost/mysql/impl/internal/statement_cache.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+#include "test_unit/create_statement.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+using detail::statement_cache;
+
+BOOST_AUTO_TEST_SUITE(test_statement_cache)
+
+BOOST_AUTO_TEST_CASE(get_put)
+{
+    statement_cache cache(3u);
+    BOOST_TEST(cache.capacity() == 3u);
+    BOOST_TEST(cache.size() == 0u);
+    BOOST_TEST(!cache.get("SELECT 1").valid());
+
+    cache.put("SELECT 1", statement_builder().id(1).num_params(0).build());
+    cache.put("SELECT ?", statement_builder().id(2).num_params(1).build());
+    BOOST_TEST(cache.size() == 2u);
+
+    auto stmt = cache.get("SELECT ?");
+    BOOST_TEST_REQUIRE(stmt.valid());
+    BOOST_TEST(stmt.id() == 2u);
+    BOOST_TEST(stmt.num_params() == 1u);
+    BOOST_TEST(cache.get("SELECT 1").id() == 1u);
+
+    // Lookups are exact
+    BOOST_TEST(!cache.get("SELECT").valid());
+    BOOST_TEST(!cache.get("SELECT 12").valid());
+    BOOST_TEST(!cache.get("").valid());
+}
+
+BOOST_AUTO_TEST_CASE(key_is_copied)
+{
+    statement_cache cache(3u);
+    std::string sql = "SELECT 1";
+    cache.put(sql, statement_builder().id(1).build());
+    sql = "SELECT 2";
+    BOOST_TEST(cache.get("SELECT 1").id() == 1u);
+    BOOST_TEST(!cache.get("SELECT 2").valid());
+}
+
+BOOST_AUTO_TEST_CASE(pop_lru_not_full)
+{
+    statement_cache cache(2u);
+    BOOST_TEST(!cache.pop_lru().valid());
+    cache.put("Q1", statement_builder().id(1).build());
+    BOOST_TEST(!cache.pop_lru().valid());
+    BOOST_TEST(cache.size() == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(pop_lru_insertion_order)
+{
+    statement_cache cache(3u);
+    cache.put("Q1", statement_builder().id(1).build());
+    cache.put("Q2", statement_builder().id(2).build());
+    cache.put("Q3", statement_builder().id(3).build());
+
+    // Without lookups, the oldest one is evicted
+    BOOST_TEST(cache.pop_lru().id() == 1u);
+    BOOST_TEST(cache.size() == 2u);
+    BOOST_TEST(!cache.get("Q1").valid());
+}
+
+BOOST_AUTO_TEST_CASE(pop_lru_get_updates_use)
+{
+    statement_cache cache(3u);
+    cache.put("Q1", statement_builder().id(1).build());
+    cache.put("Q2", statement_builder().id(2).build());
+    cache.put("Q3", statement_builder().id(3).build());
+
+    // Using statements makes them recent
+    cache.get("Q1");
+    cache.get("Q2");
+    BOOST_TEST(cache.pop_lru().id() == 3u);
+
+    // After eviction, the cache is usable
+    cache.put("Q4", statement_builder().id(4).build());
+    BOOST_TEST(cache.pop_lru().id() == 1u);
+    cache.put("Q5", statement_builder().id(5).build());
+    BOOST_TEST(cache.pop_lru().id() == 2u);
+    BOOST_TEST(cache.get("Q4").id() == 4u);
+    BOOST_TEST(cache.get("Q5").id() == 5u);
+}
+
+BOOST_AUTO_TEST_CASE(peek_lru)
+{
+    statement_cache cache(2u);
+    cache.put("Q1", statement_builder().id(1).build());
+    BOOST_TEST(!cache.peek_lru().valid());  // not full
+    cache.put("Q2", statement_builder().id(2).build());
+    cache.get("Q1");
+
+    // peek_lru returns the statement pop_lru would remove, without removing it
+    BOOST_TEST(cache.peek_lru().id() == 2u);
+    BOOST_TEST(cache.size() == 2u);
+    BOOST_TEST(cache.pop_lru().id() == 2u);
+}
+
+BOOST_AUTO_TEST_CASE(capacity_1)
+{
+    statement_cache cache(1u);
+    cache.put("Q1", statement_builder().id(1).build());
+    BOOST_TEST(cache.pop_lru().id() == 1u);
+    cache.put("Q2", statement_builder().id(2).build());
+    BOOST_TEST(cache.get("Q2").id() == 2u);
+    BOOST_TEST(cache.size() == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(clear)
+{
+    statement_cache cache(3u);
+    cache.put("Q1", statement_builder().id(1).build());
+    cache.put("Q2", statement_builder().id(2).build());
+    cache.clear();
+    BOOST_TEST(cache.size() == 0u);
+    BOOST_TEST(cache.capacity() == 3u);
+    BOOST_TEST(!cache.get("Q1").valid());
+
+    // Can be used normally after clearing
+    cache.put("Q1", statement_builder().id(10).build());
+    BOOST_TEST(cache.get("Q1").id() == 10u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
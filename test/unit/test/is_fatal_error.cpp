@@ -66,6 +66,10 @@ BOOST_AUTO_TEST_CASE(test_is_fatal_error)
         {"row_type_mismatch",               client_errc::row_type_mismatch,                                 true },
         {"static_row_parsing_error",        client_errc::static_row_parsing_error,                          true },
 
+        // Client errors leaving unread packets
+        {"batch_returned_rows",             client_errc::batch_returned_rows,                               true },
+        {"local_infile_in_pipeline",        client_errc::local_infile_in_pipeline,                          true },
+
         // Client errors representing cancellations
         {"client_timeout",                  client_errc::timeout,                                           true },
         {"client_cancelled",                client_errc::cancelled,                                         true },
@@ -87,6 +91,8 @@ BOOST_AUTO_TEST_CASE(test_is_fatal_error)
         {"format_string_invalid_specifier", client_errc::format_string_invalid_specifier,                   false},
         {"format_arg_not_found",            client_errc::format_arg_not_found,                              false},
         {"unknown_character_set",           client_errc::unknown_character_set,                             false},
+        {"local_infile_no_handler",         client_errc::local_infile_no_handler,                           false},
+        {"batch_with_long_data",            client_errc::batch_with_long_data,                              false},
 
         // Fatal server errors
         {"ER_UNKNOWN_COM_ERROR",            common_server_errc::er_unknown_com_error,                       true },
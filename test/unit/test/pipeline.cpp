@@ -10,6 +10,7 @@
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/error_with_diagnostics.hpp>
+#include <boost/mysql/execution_summary.hpp>
 #include <boost/mysql/pipeline.hpp>
 #include <boost/mysql/results.hpp>
 #include <boost/mysql/string_view.hpp>
@@ -25,6 +26,7 @@
 
 #include <cstdint>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -147,6 +149,46 @@ BOOST_AUTO_TEST_CASE(as_results_error)
     BOOST_CHECK_THROW(std::move(r).as_results(), std::invalid_argument);
 }
 
+BOOST_AUTO_TEST_CASE(underlying_summary)
+{
+    // Setup
+    execution_summary summary;
+    summary.affected_rows = 10u;
+    summary.last_insert_id = 42u;
+    summary.warning_count = 2u;
+    stage_response r;
+    detail::access::get_impl(r).set_summary(summary);
+
+    // Check
+    BOOST_TEST(r.has_summary());
+    BOOST_TEST(!r.has_results());
+    BOOST_TEST(!r.has_statement());
+    BOOST_TEST(r.as_summary().affected_rows == 10u);
+    BOOST_TEST(r.as_summary().last_insert_id == 42u);
+    BOOST_TEST(r.as_summary().warning_count == 2u);
+    BOOST_TEST(r.get_summary().affected_rows == 10u);
+
+    // error(), diag() can be called and return empty objects
+    BOOST_TEST(r.error() == error_code());
+    BOOST_TEST(r.diag() == diagnostics());
+    BOOST_TEST(std::move(r).diag() == diagnostics());
+}
+
+BOOST_AUTO_TEST_CASE(as_summary_error)
+{
+    // Empty error
+    stage_response r;
+    BOOST_CHECK_THROW(r.as_summary(), std::invalid_argument);
+
+    // Non-empty error
+    detail::access::get_impl(r).set_error(client_errc::extra_bytes, create_client_diag("my_msg"));
+    BOOST_CHECK_THROW(r.as_summary(), std::invalid_argument);
+
+    // results
+    detail::access::get_impl(r).emplace_results();
+    BOOST_CHECK_THROW(r.as_summary(), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_CASE(as_statement_error)
 {
     // Empty error
@@ -330,6 +372,75 @@ BOOST_AUTO_TEST_CASE(add_execute_statement_range_too_many_params)
     check_pipeline(req, {}, {});  // Request unmodified
 }
 
+// Statement, executed once per row of parameters
+BOOST_AUTO_TEST_CASE(add_execute_batch)
+{
+    pipeline_request req;
+    req.add_execute_batch(statement_builder().id(2).num_params(1).build(), make_fv_arr(42, nullptr));
+    check_pipeline_single(
+        req,
+        concat_copy(
+            create_frame(0, {0x17, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+                             0x01, 0x08, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}),
+            create_frame(0, {0x17, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+                             0x01, 0x06, 0x00})
+        ),
+        {pipeline_stage_kind::execute_batch, 1u, std::size_t(2)}
+    );
+}
+
+BOOST_AUTO_TEST_CASE(add_execute_batch_wrong_num_params)
+{
+    pipeline_request req;
+
+    // Not a multiple of the number of params
+    BOOST_CHECK_EXCEPTION(
+        req.add_execute_batch(statement_builder().num_params(2).build(), make_fv_arr(42, nullptr, "abc")),
+        std::invalid_argument,
+        stmt_exc_validator
+    );
+
+    // No params
+    BOOST_CHECK_EXCEPTION(
+        req.add_execute_batch(statement_builder().num_params(2).build(), {}),
+        std::invalid_argument,
+        stmt_exc_validator
+    );
+
+    // Statements without params can't be batched
+    BOOST_CHECK_EXCEPTION(
+        req.add_execute_batch(statement_builder().num_params(0).build(), {}),
+        std::invalid_argument,
+        stmt_exc_validator
+    );
+    check_pipeline(req, {}, {});  // Request unmodified
+}
+
+// All executions are read using the same sequence number, so each one must fit in a frame
+BOOST_AUTO_TEST_CASE(add_execute_batch_row_too_big)
+{
+    pipeline_request req;
+    req.add_reset_connection();
+
+    // The first row fits. The second one doesn't
+    const std::string big(0xffffff, 'a');
+    auto stmt = statement_builder().num_params(1).build();
+    BOOST_CHECK_EXCEPTION(
+        req.add_execute_batch(stmt, make_fv_arr("abc", string_view(big))),
+        std::invalid_argument,
+        [](const std::invalid_argument& exc) {
+            BOOST_TEST(
+                string_view(exc.what()) ==
+                "pipeline_request::add_execute_batch: parameters don't fit in a frame"
+            );
+            return true;
+        }
+    );
+
+    // The first row is removed, too
+    check_pipeline_single(req, create_frame(0, {0x1f}), {pipeline_stage_kind::reset_connection, 1u, {}});
+}
+
 // prepare statement
 BOOST_AUTO_TEST_CASE(add_prepare_statement)
 {
@@ -500,6 +611,28 @@ BOOST_AUTO_TEST_CASE(clear)
     );
 }
 
+BOOST_AUTO_TEST_CASE(response_mode)
+{
+    // Defaults to results
+    pipeline_request req;
+    BOOST_TEST((req.response_mode() == pipeline_response_mode::results));
+
+    // Can be changed
+    req.add_execute("SELECT 1").set_response_mode(pipeline_response_mode::summary);
+    BOOST_TEST((req.response_mode() == pipeline_response_mode::summary));
+
+    // Doesn't affect the stages
+    check_pipeline_single(
+        req,
+        create_query_frame(0, "SELECT 1"),
+        {pipeline_stage_kind::execute, 1u, resultset_encoding::text}
+    );
+
+    // Clearing the request doesn't reset it
+    req.clear();
+    BOOST_TEST((req.response_mode() == pipeline_response_mode::summary));
+}
+
 BOOST_AUTO_TEST_CASE(clear_empty)
 {
     // Clearing an empty pipeline is a no-op
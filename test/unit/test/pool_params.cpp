@@ -15,6 +15,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <stdexcept>
 
 using namespace boost::mysql;
@@ -50,6 +51,16 @@ BOOST_AUTO_TEST_CASE(invalid_params)
             [](pool_params& p) { p.max_size = 100; p.initial_size = 101; },
             "pool_params::max_size must be greater than pool_params::initial_size"
         },
+        {
+            "statement_cache_size 0",
+            [](pool_params& p) { p.statement_cache_size = 0; },
+            "pool_params::statement_cache_size must be greater than zero"
+        },
+        {
+            "min_idle > max_size",
+            [](pool_params& p) { p.min_idle = 200; },
+            "pool_params::max_size must be greater than pool_params::min_idle"
+        },
         {
             "connect_timeout < 0",
             [](pool_params& p) { p.connect_timeout = std::chrono::seconds(-1); },
@@ -95,6 +106,16 @@ BOOST_AUTO_TEST_CASE(invalid_params)
             [](pool_params& p) { p.ping_timeout = (std::chrono::steady_clock::duration::min)(); },
             "pool_params::ping_timeout must not be negative"
         },
+        {
+            "idle_timeout < 0",
+            [](pool_params& p) { p.idle_timeout = std::chrono::seconds(-1); },
+            "pool_params::idle_timeout must not be negative"
+        },
+        {
+            "max_lifetime < 0",
+            [](pool_params& p) { p.max_lifetime = std::chrono::seconds(-1); },
+            "pool_params::max_lifetime must not be negative"
+        },
   // clang-format on
     };
 
@@ -154,6 +175,14 @@ BOOST_AUTO_TEST_CASE(valid_params)
             "ping_timeout == max",
             [](pool_params& p) { p.ping_timeout = (std::chrono::steady_clock::duration::max)(); },
         },
+        {
+            "idle_timeout == max",
+            [](pool_params& p) { p.idle_timeout = (std::chrono::steady_clock::duration::max)(); },
+        },
+        {
+            "max_lifetime == max",
+            [](pool_params& p) { p.max_lifetime = (std::chrono::steady_clock::duration::max)(); },
+        },
   // clang-format on
     };
 
@@ -168,4 +197,39 @@ BOOST_AUTO_TEST_CASE(valid_params)
     }
 }
 
+BOOST_AUTO_TEST_CASE(make_shard_params_sizes)
+{
+    // Sizes are split between shards, and the remainder goes to the first shards
+    pool_params params;
+    params.initial_size = 4;
+    params.max_size = 11;
+    params.min_idle = 5;
+    params.username = "myuser";
+    auto internal_params = detail::make_internal_pool_params(std::move(params));
+
+    struct
+    {
+        std::size_t shard_index;
+        std::size_t expected_initial_size;
+        std::size_t expected_max_size;
+        std::size_t expected_min_idle;
+    } test_cases[] = {
+        {0, 2, 4, 2},
+        {1, 1, 4, 2},
+        {2, 1, 3, 1},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.shard_index)
+        {
+            auto shard_params = detail::make_shard_params(internal_params, 3, tc.shard_index);
+            BOOST_TEST(shard_params.initial_size == tc.expected_initial_size);
+            BOOST_TEST(shard_params.max_size == tc.expected_max_size);
+            BOOST_TEST(shard_params.min_idle == tc.expected_min_idle);
+            BOOST_TEST(shard_params.connect_config.username == "myuser");
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,312 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/compression_algorithm.hpp>
+#include <boost/mysql/error_code.hpp>
+
+#include <boost/mysql/impl/internal/protocol/capabilities.hpp>
+#include <boost/mysql/impl/internal/protocol/compression.hpp>
+
+#include <boost/core/span.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "serialization_test.hpp"
+#include "test_common/assert_buffer_equals.hpp"
+#include "test_common/buffer_concat.hpp"
+#include "test_unit/create_frame.hpp"
+#include "test_unit/printing.hpp"
+
+using namespace boost::mysql::detail;
+using namespace boost::mysql::test;
+using boost::span;
+using boost::mysql::client_errc;
+using boost::mysql::compression_algorithm;
+using boost::mysql::error_code;
+using u8vec = std::vector<std::uint8_t>;
+
+BOOST_AUTO_TEST_SUITE(test_compression)
+
+BOOST_AUTO_TEST_CASE(compressed_frame_header_)
+{
+    struct
+    {
+        const char* name;
+        compressed_frame_header header;
+        std::array<std::uint8_t, 7> serialized;
+    } test_cases[] = {
+        {"uncompressed",      {3, 0, 0},                   {{0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}}},
+        {"compressed",        {9, 2, 20},                  {{0x09, 0x00, 0x00, 0x02, 0x14, 0x00, 0x00}}},
+        {"big_sizes",         {0xcacbcc, 0xfa, 0xa1a2a3},  {{0xcc, 0xcb, 0xca, 0xfa, 0xa3, 0xa2, 0xa1}}},
+        {"max_sizes_seqnum",  {0xffffff, 0xff, 0xffffff},  {{0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}}},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name << " serialization")
+        {
+            std::unique_ptr<std::uint8_t[]> buff{new std::uint8_t[7]};
+            span<std::uint8_t, compressed_frame_header_size> buff_span(buff.get(), 7);
+            serialize_compressed_frame_header(buff_span, tc.header);
+            BOOST_MYSQL_ASSERT_BUFFER_EQUALS(buff_span, tc.serialized);
+        }
+        BOOST_TEST_CONTEXT(tc.name << " deserialization")
+        {
+            deserialization_buffer buffer(tc.serialized);
+            auto actual = deserialize_compressed_frame_header(
+                span<const std::uint8_t, compressed_frame_header_size>(buffer)
+            );
+            BOOST_TEST(actual.compressed_size == tc.header.compressed_size);
+            BOOST_TEST(actual.sequence_number == tc.header.sequence_number);
+            BOOST_TEST(actual.uncompressed_size == tc.header.uncompressed_size);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(get_uncompressed_size_)
+{
+    BOOST_TEST(get_uncompressed_size({10, 0, 0}) == 10u);
+    BOOST_TEST(get_uncompressed_size({10, 0, 200}) == 200u);
+}
+
+BOOST_AUTO_TEST_CASE(get_compression_algorithm_)
+{
+    BOOST_TEST((get_compression_algorithm(capabilities()) == compression_algorithm::none));
+    BOOST_TEST((get_compression_algorithm(capabilities(CLIENT_SSL)) == compression_algorithm::none));
+    BOOST_TEST((get_compression_algorithm(capabilities(CLIENT_COMPRESS)) == compression_algorithm::zlib));
+    BOOST_TEST(
+        (get_compression_algorithm(capabilities(CLIENT_ZSTD_COMPRESSION_ALGORITHM)) ==
+         compression_algorithm::zstd)
+    );
+}
+
+BOOST_AUTO_TEST_CASE(get_compression_capability_)
+{
+    BOOST_TEST(get_compression_capability(compression_algorithm::none) == capabilities());
+    BOOST_TEST(
+        get_compression_capability(compression_algorithm::zlib) ==
+        capabilities(is_compression_supported(compression_algorithm::zlib) ? CLIENT_COMPRESS : 0u)
+    );
+    BOOST_TEST(
+        get_compression_capability(compression_algorithm::zstd) ==
+        capabilities(
+            is_compression_supported(compression_algorithm::zstd) ? CLIENT_ZSTD_COMPRESSION_ALGORITHM : 0u
+        )
+    );
+}
+
+// serialize_compressed_frames: payloads under the threshold are sent uncompressed
+BOOST_AUTO_TEST_CASE(serialize_frames_below_threshold)
+{
+    const u8vec msg1{0x01, 0x02, 0x03};
+    const u8vec msg2{0x04, 0x05};
+
+    struct
+    {
+        const char* name;
+        u8vec frames;
+        u8vec expected;
+    } test_cases[] = {
+        {"empty", {}, {}},
+        {"one_message", create_frame(0, msg1), create_compressed_frame(0, create_frame(0, msg1))},
+        {"seqnum_not_zero", create_frame(5, msg1), create_compressed_frame(0, create_frame(5, msg1))},
+        {"empty_message", create_empty_frame(3), create_compressed_frame(0, create_empty_frame(3))},
+        {"several_messages",
+         concat_copy(create_frame(0, msg1), create_frame(0, msg2)),
+         concat_copy(
+             create_compressed_frame(0, create_frame(0, msg1)),
+             create_compressed_frame(0, create_frame(0, msg2))
+         )},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            u8vec buff{0xff};  // contents are kept
+            compressed_seqnum_tracker seqnums;
+            serialize_compressed_frames(compression_algorithm::zlib, 1024u, tc.frames, seqnums, buff);
+            BOOST_MYSQL_ASSERT_BUFFER_EQUALS(span<const std::uint8_t>(buff).subspan(1), tc.expected);
+            BOOST_TEST(buff[0] == 0xff);
+        }
+    }
+}
+
+// Messages spanning several frames are kept together
+BOOST_AUTO_TEST_CASE(serialize_frames_multiframe)
+{
+    const u8vec body1{0x01, 0x02, 0x03, 0x04};
+    const u8vec body2{0x05};
+    const u8vec msg2{0x06, 0x07};
+    auto msg1 = concat_copy(create_frame(2, body1), create_frame(3, body2));
+    auto frames = concat_copy(msg1, create_frame(0, msg2));
+
+    u8vec buff;
+    compressed_seqnum_tracker seqnums;
+    serialize_compressed_frames(compression_algorithm::zlib, 1024u, frames, seqnums, buff, 4u);
+
+    auto expected = concat_copy(
+        create_compressed_frame(0, msg1),
+        create_compressed_frame(0, create_frame(0, msg2))
+    );
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(buff, expected);
+}
+
+// If compression is not available, frames are sent uncompressed
+BOOST_AUTO_TEST_CASE(serialize_frames_unsupported)
+{
+    const u8vec msg(100, 0x01);
+    u8vec buff;
+    compressed_seqnum_tracker seqnums;
+    serialize_compressed_frames(compression_algorithm::none, 0u, create_frame(0, msg), seqnums, buff);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(buff, create_compressed_frame(0, create_frame(0, msg)));
+}
+
+// Commands restart the compressed sequence number, and the response continues it
+BOOST_AUTO_TEST_CASE(seqnums_command)
+{
+    const u8vec msg{0x01, 0x02, 0x03};
+    compressed_seqnum_tracker seqnums;
+    BOOST_TEST(seqnums.check_read(0u));  // some previous response
+
+    u8vec buff;
+    serialize_compressed_frames(compression_algorithm::zlib, 1024u, create_frame(0, msg), seqnums, buff);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(buff, create_compressed_frame(0, create_frame(0, msg)));
+
+    BOOST_TEST(seqnums.check_read(1u));
+    BOOST_TEST(seqnums.check_read(2u));
+    BOOST_TEST(!seqnums.check_read(4u));
+}
+
+// Messages that are not commands (e.g. LOCAL INFILE contents) continue the count
+BOOST_AUTO_TEST_CASE(seqnums_continuation)
+{
+    const u8vec msg{0x01, 0x02, 0x03};
+    compressed_seqnum_tracker seqnums;
+    u8vec buff;
+    serialize_compressed_frames(compression_algorithm::zlib, 1024u, create_frame(0, msg), seqnums, buff);
+    BOOST_TEST(seqnums.check_read(1u));
+
+    buff.clear();
+    serialize_compressed_frames(compression_algorithm::zlib, 1024u, create_frame(2, msg), seqnums, buff);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(buff, create_compressed_frame(2, create_frame(2, msg)));
+    BOOST_TEST(seqnums.check_read(3u));
+}
+
+// In a pipeline, each response restarts the count
+BOOST_AUTO_TEST_CASE(seqnums_pipeline)
+{
+    const u8vec msg1{0x01, 0x02, 0x03};
+    const u8vec msg2{0x04, 0x05};
+    auto frames = concat_copy(create_frame(0, msg1), create_frame(0, msg2), create_frame(0, msg1));
+    compressed_seqnum_tracker seqnums;
+    u8vec buff;
+    serialize_compressed_frames(compression_algorithm::zlib, 1024u, frames, seqnums, buff);
+
+    BOOST_TEST(seqnums.check_read(1u));  // response 1
+    BOOST_TEST(seqnums.check_read(2u));
+    BOOST_TEST(seqnums.check_read(1u));  // response 2
+    BOOST_TEST(seqnums.check_read(1u));  // response 3
+    BOOST_TEST(seqnums.check_read(2u));
+    BOOST_TEST(!seqnums.check_read(1u));  // no more responses
+}
+
+BOOST_AUTO_TEST_CASE(decompress_unsupported)
+{
+    const u8vec input{0x01, 0x02};
+    u8vec output(10);
+    auto ec = decompress_payload(compression_algorithm::none, input, output);
+    BOOST_TEST(ec == client_errc::protocol_value_error);
+}
+
+#ifdef BOOST_MYSQL_HAS_ZLIB
+BOOST_AUTO_TEST_CASE(zlib_roundtrip)
+{
+    // Highly compressible message
+    const u8vec msg(1000, 0x42);
+    auto frames = create_frame(0, msg);
+
+    u8vec buff;
+    compressed_seqnum_tracker seqnums;
+    serialize_compressed_frames(compression_algorithm::zlib, 50u, frames, seqnums, buff);
+
+    // Header
+    BOOST_TEST_REQUIRE(buff.size() > compressed_frame_header_size);
+    auto header = deserialize_compressed_frame_header(
+        span<const std::uint8_t, compressed_frame_header_size>(buff.data(), compressed_frame_header_size)
+    );
+    BOOST_TEST(header.sequence_number == 0u);
+    BOOST_TEST(header.uncompressed_size == frames.size());
+    BOOST_TEST(header.compressed_size == buff.size() - compressed_frame_header_size);
+    BOOST_TEST(header.compressed_size < frames.size());
+
+    // Decompress
+    u8vec output(header.uncompressed_size);
+    auto ec = decompress_payload(
+        compression_algorithm::zlib,
+        span<const std::uint8_t>(buff).subspan(compressed_frame_header_size),
+        output
+    );
+    BOOST_TEST(ec == error_code());
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(output, frames);
+}
+
+BOOST_AUTO_TEST_CASE(zlib_incompressible)
+{
+    // Payloads that don't get smaller are sent uncompressed
+    u8vec msg;
+    for (std::size_t i = 0; i < 60u; ++i)
+        msg.push_back(static_cast<std::uint8_t>(i * 37u + 11u));
+    u8vec buff;
+    compressed_seqnum_tracker seqnums;
+    serialize_compressed_frames(compression_algorithm::zlib, 0u, create_frame(0, msg), seqnums, buff);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(buff, create_compressed_frame(0, create_frame(0, msg)));
+}
+
+BOOST_AUTO_TEST_CASE(zlib_decompress_error)
+{
+    const u8vec input{0x01, 0x02, 0x03, 0x04};
+    u8vec output(10);
+    auto ec = decompress_payload(compression_algorithm::zlib, input, output);
+    BOOST_TEST(ec == client_errc::protocol_value_error);
+}
+#endif
+
+#ifdef BOOST_MYSQL_HAS_ZSTD
+BOOST_AUTO_TEST_CASE(zstd_roundtrip)
+{
+    const u8vec msg(1000, 0x42);
+    auto frames = create_frame(3, msg);
+
+    u8vec buff;
+    compressed_seqnum_tracker seqnums;
+    serialize_compressed_frames(compression_algorithm::zstd, 50u, frames, seqnums, buff);
+
+    BOOST_TEST_REQUIRE(buff.size() > compressed_frame_header_size);
+    auto header = deserialize_compressed_frame_header(
+        span<const std::uint8_t, compressed_frame_header_size>(buff.data(), compressed_frame_header_size)
+    );
+    BOOST_TEST(header.sequence_number == 0u);
+    BOOST_TEST(header.uncompressed_size == frames.size());
+
+    u8vec output(header.uncompressed_size);
+    auto ec = decompress_payload(
+        compression_algorithm::zstd,
+        span<const std::uint8_t>(buff).subspan(compressed_frame_header_size),
+        output
+    );
+    BOOST_TEST(ec == error_code());
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(output, frames);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
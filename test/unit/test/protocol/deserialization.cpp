@@ -107,6 +107,18 @@ BOOST_AUTO_TEST_CASE(ok_view_success)
                 .info("")
                 .build(),
             {0x00, 0x00, 0x02, 0x00, 0x00, 0x00},
+        },
+        {
+            "session_state_changed",
+            ok_builder()
+                .affected_rows(0)
+                .last_insert_id(0)
+                .flags(0x4002)
+                .warnings(0)
+                .info("")
+                .session_state_info(string_view("\x05\x02\x01\x31", 4))
+                .build(),
+            {0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x04, 0x05, 0x02, 0x01, 0x31},
         }
         // clang-format on
     };
@@ -127,6 +139,8 @@ BOOST_AUTO_TEST_CASE(ok_view_success)
             BOOST_TEST(actual.status_flags == tc.expected.status_flags);
             BOOST_TEST(actual.warnings == tc.expected.warnings);
             BOOST_TEST(actual.info == tc.expected.info);
+            BOOST_TEST(actual.session_state_changed() == tc.expected.session_state_changed());
+            BOOST_TEST(actual.session_state_info == tc.expected.session_state_info);
         }
     }
 }
@@ -863,6 +877,58 @@ BOOST_AUTO_TEST_CASE(deserialize_execute_response_error)
     }
 }
 
+//
+// local infile request
+//
+BOOST_AUTO_TEST_CASE(deserialize_local_infile_request_success)
+{
+    struct
+    {
+        const char* name;
+        deserialization_buffer serialized;
+        string_view expected_file_name;
+    } test_cases[] = {
+        {"regular", {0xfb, 0x61, 0x2e, 0x63, 0x73, 0x76}, "a.csv"},
+        {"empty",   {0xfb},                               ""     },
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            string_view file_name;
+            bool res = deserialize_local_infile_request(tc.serialized, file_name);
+            BOOST_TEST(res);
+            BOOST_TEST(file_name == tc.expected_file_name);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(deserialize_local_infile_request_other_messages)
+{
+    struct
+    {
+        const char* name;
+        deserialization_buffer serialized;
+    } test_cases[] = {
+        {"empty",      {}                    },
+        {"ok_packet",  {0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00}},
+        {"num_fields", {0xfc, 0xfb, 0x00}    },
+        {"error",      {0xff, 0x00}          },
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            string_view file_name = "abc";
+            bool res = deserialize_local_infile_request(tc.serialized, file_name);
+            BOOST_TEST(!res);
+            BOOST_TEST(file_name == "abc");
+        }
+    }
+}
+
 //
 // row message
 //
@@ -1279,10 +1345,42 @@ BOOST_AUTO_TEST_CASE(deserialize_server_hello_impl_success)
     BOOST_MYSQL_ASSERT_BUFFER_EQUALS(actual.auth_plugin_data.to_span(), auth_plugin_data);
     BOOST_TEST(actual.server_capabilities == capabilities(caps));
     BOOST_TEST(actual.auth_plugin_name == "mysql_native_password");
+    BOOST_TEST(actual.mariadb_ext_capabilities == 0u);
 
     // TODO: mysql8, mariadb, edge case where auth plugin length is < 13
 }
 
+// MariaDB servers don't set CLIENT_LONG_PASSWORD, and send extended capabilities in the reserved bytes
+BOOST_AUTO_TEST_CASE(deserialize_server_hello_impl_mariadb_ext_capabilities)
+{
+    // Data
+    constexpr std::uint8_t auth_plugin_data[] = {0x52, 0x1a, 0x50, 0x3a, 0x4b, 0x12, 0x70, 0x2f, 0x03, 0x5a,
+                                                 0x74, 0x05, 0x28, 0x2b, 0x7f, 0x21, 0x43, 0x4a, 0x21, 0x62};
+
+    deserialization_buffer serialized{0x35, 0x2e, 0x35, 0x2e, 0x35, 0x2d, 0x31, 0x30, 0x2e, 0x31, 0x31, 0x2e,
+                                      0x32, 0x2d, 0x4d, 0x61, 0x72, 0x69, 0x61, 0x44, 0x42, 0x00, 0x02, 0x00,
+                                      0x00, 0x00, 0x52, 0x1a, 0x50, 0x3a, 0x4b, 0x12, 0x70, 0x2f, 0x00, 0xfe,
+                                      0xf7, 0x08, 0x02, 0x00, 0xff, 0x81, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                      0x00, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x5a, 0x74, 0x05, 0x28, 0x2b, 0x7f,
+                                      0x21, 0x43, 0x4a, 0x21, 0x62, 0x00, 0x6d, 0x79, 0x73, 0x71, 0x6c, 0x5f,
+                                      0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5f, 0x70, 0x61, 0x73, 0x73, 0x77,
+                                      0x6f, 0x72, 0x64, 0x00};
+
+    // Deserialize
+    server_hello actual{};
+    auto err = deserialize_server_hello_impl(serialized, actual);
+
+    // No error
+    BOOST_TEST_REQUIRE(err == error_code());
+
+    // Actual value
+    BOOST_TEST(actual.server == db_flavor::mariadb);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(actual.auth_plugin_data.to_span(), auth_plugin_data);
+    BOOST_TEST(!actual.server_capabilities.has(CLIENT_LONG_PASSWORD));
+    BOOST_TEST(actual.mariadb_ext_capabilities == 0x1du);
+    BOOST_TEST(actual.auth_plugin_name == "mysql_native_password");
+}
+
 BOOST_AUTO_TEST_CASE(deserialize_server_hello_impl_error)
 {
     struct
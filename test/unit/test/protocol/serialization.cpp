@@ -226,12 +226,93 @@ BOOST_AUTO_TEST_CASE(execute_statement)
     {
         BOOST_TEST_CONTEXT(tc.name)
         {
-            execute_stmt_command cmd{tc.stmt_id, tc.params};
+            execute_stmt_command cmd{tc.stmt_id, tc.params, false, {}};
             do_serialize_test(cmd, tc.serialized);
         }
     }
 }
 
+BOOST_AUTO_TEST_CASE(execute_statement_cursor)
+{
+    // The flags byte is set to CURSOR_TYPE_READ_ONLY
+    const auto params = make_fv_vector(string_view("test"));
+    execute_stmt_command cmd{1, params, true, {}};
+    const std::uint8_t serialized[] = {0x17, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+                                       0x00, 0x01, 0xfe, 0x00, 0x04, 0x74, 0x65, 0x73, 0x74};
+    do_serialize_test(cmd, serialized);
+}
+
+// Values for parameters with long data are not sent. Records for other statements are ignored
+BOOST_AUTO_TEST_CASE(execute_statement_long_data)
+{
+    const auto params = make_fv_vector(string_view("test"), std::int64_t(42), string_view("abc"));
+    const long_data_param long_data[] = {
+        {1u, 0u},
+        {2u, 1u},
+        {1u, 2u}
+    };
+    execute_stmt_command cmd{1, params, false, long_data};
+    const std::uint8_t serialized[] = {0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+                                       0x00, 0x01, 0xfe, 0x00, 0x08, 0x00, 0xfe, 0x00, 0x2a, 0x00,
+                                       0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    do_serialize_test(cmd, serialized);
+}
+
+// Types are taken from the first non-NULL value. NULL values only send an indicator
+BOOST_AUTO_TEST_CASE(bulk_execute_statement)
+{
+    const auto params = make_fv_vector(
+        std::uint64_t(42),
+        nullptr,
+        string_view("ab"),
+        std::uint64_t(43),
+        nullptr,
+        nullptr
+    );
+    bulk_execute_stmt_command cmd{1, 3, params};
+    const std::uint8_t serialized[] = {0xfa, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x08, 0x80, 0x06, 0x00,
+                                       0xfe, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                       0x01, 0x00, 0x02, 0x61, 0x62, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00,
+                                       0x00, 0x00, 0x00, 0x01, 0x01};
+    do_serialize_test(cmd, serialized);
+}
+
+BOOST_AUTO_TEST_CASE(is_bulk_executable_)
+{
+    struct
+    {
+        const char* name;
+        std::vector<field_view> params;
+        bool expected;
+    } test_cases[] = {
+        {"same_types",       make_fv_vector(42, "abc", 43, "def"),                 true },
+        {"nulls",            make_fv_vector(nullptr, "abc", 43, nullptr, 44, "d"), true },
+        {"all_nulls",        make_fv_vector(nullptr, "abc", nullptr, "def"),       true },
+        {"mixed_types",      make_fv_vector(42, "abc", 43, 4.2),                   false},
+        {"mixed_signedness", make_fv_vector(42, "abc", 43u, "def"),                false},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name) { BOOST_TEST(is_bulk_executable(tc.params, 2u) == tc.expected); }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(send_long_data)
+{
+    const std::uint8_t data[] = {0x01, 0x02, 0x03};
+    send_long_data_command cmd{0x0a0b0c0d, 0x0102, data};
+    const std::uint8_t serialized[] = {0x18, 0x0d, 0x0c, 0x0b, 0x0a, 0x02, 0x01, 0x01, 0x02, 0x03};
+    do_serialize_test(cmd, serialized);
+}
+
+BOOST_AUTO_TEST_CASE(fetch_statement)
+{
+    fetch_stmt_command cmd{0x0a0b0c0d, 0x01020304};
+    const std::uint8_t serialized[] = {0x1c, 0x0d, 0x0c, 0x0b, 0x0a, 0x04, 0x03, 0x02, 0x01};
+    do_serialize_test(cmd, serialized);
+}
+
 BOOST_AUTO_TEST_CASE(close_statement)
 {
     close_stmt_command cmd{1};
@@ -291,6 +372,40 @@ BOOST_AUTO_TEST_CASE(login_request_)
              0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x00, 0x6d, 0x79, 0x73, 0x71, 0x6c, 0x5f, 0x6e, 0x61,
              0x74, 0x69, 0x76, 0x65, 0x5f, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x00},
          },
+        {
+         "with_zstd", {
+                capabilities(caps | CLIENT_ZSTD_COMPRESSION_ALGORITHM),
+                16777216,  // max packet size
+                collations::utf8_general_ci,
+                "root",  // username
+                auth_data,
+                "",                       // database; irrelevant, not using connect with DB capability
+                "mysql_native_password",  // auth plugin name
+                3,                        // zstd compression level
+            }, {0x85, 0xa6, 0xff, 0x05, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+             0x72, 0x6f, 0x6f, 0x74, 0x00, 0x14, 0xfe, 0xc6, 0x2c, 0x9f, 0xab, 0x43, 0x69, 0x46, 0xc5, 0x51,
+             0x35, 0xa5, 0xff, 0xdb, 0x3f, 0x48, 0xe6, 0xfc, 0x34, 0xc9, 0x6d, 0x79, 0x73, 0x71, 0x6c, 0x5f,
+             0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5f, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x00,
+             0x03},
+         },
+        {
+         "with_mariadb_ext_caps", {
+                capabilities(caps),
+                16777216,  // max packet size
+                collations::utf8_general_ci,
+                "root",  // username
+                auth_data,
+                "",                       // database; irrelevant, not using connect with DB capability
+                "mysql_native_password",  // auth plugin name
+                0,                        // zstd compression level; irrelevant
+                MARIADB_CLIENT_STMT_BULK_OPERATIONS,
+            }, {0x85, 0xa6, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+             0x72, 0x6f, 0x6f, 0x74, 0x00, 0x14, 0xfe, 0xc6, 0x2c, 0x9f, 0xab, 0x43, 0x69, 0x46, 0xc5, 0x51,
+             0x35, 0xa5, 0xff, 0xdb, 0x3f, 0x48, 0xe6, 0xfc, 0x34, 0xc9, 0x6d, 0x79, 0x73, 0x71, 0x6c, 0x5f,
+             0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5f, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x00},
+         },
     };
 
     // TODO: test case with collation > 0xff
@@ -324,6 +439,30 @@ BOOST_AUTO_TEST_CASE(ssl_request_)
     // TODO: test case with collation > 0xff
 }
 
+BOOST_AUTO_TEST_CASE(ssl_request_mariadb_ext_caps)
+{
+    constexpr std::uint32_t caps = CLIENT_LONG_FLAG | CLIENT_LOCAL_FILES | CLIENT_PROTOCOL_41 |
+                                   CLIENT_INTERACTIVE | CLIENT_SSL | CLIENT_TRANSACTIONS |
+                                   CLIENT_SECURE_CONNECTION | CLIENT_MULTI_STATEMENTS | CLIENT_MULTI_RESULTS |
+                                   CLIENT_PS_MULTI_RESULTS | CLIENT_PLUGIN_AUTH | CLIENT_CONNECT_ATTRS |
+                                   CLIENT_SESSION_TRACK | (1UL << 29);
+
+    // Data
+    ssl_request value{
+        capabilities(caps),
+        0x1000000,  // max packet size
+        collations::utf8mb4_general_ci,
+        MARIADB_CLIENT_STMT_BULK_OPERATIONS,
+    };
+
+    // The extended capabilities are sent in the last 4 bytes of the filler
+    const std::uint8_t serialized[] = {0x84, 0xae, 0x9f, 0x20, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x00, 0x00,
+                                       0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                       0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00};
+
+    do_serialize_test(value, serialized);
+}
+
 BOOST_AUTO_TEST_CASE(auth_switch_response_)
 {
     constexpr std::array<std::uint8_t, 20> auth_data{
@@ -160,6 +160,21 @@ void add_int_samples(std::vector<success_sample>& output)
         output
     );
 
+    // Different lengths, to cover all code paths of the fast integer parsing algorithm
+    auto bigint_meta = create_meta(column_type::bigint);
+    auto ubigint_meta = meta_builder().type(column_type::bigint).unsigned_flag(true).build();
+    output.emplace_back("digits_8", "12345678", std::int64_t(12345678), bigint_meta);
+    output.emplace_back("digits_9", "123456789", std::int64_t(123456789), bigint_meta);
+    output.emplace_back("digits_16", "1234567890123456", std::int64_t(1234567890123456), bigint_meta);
+    output.emplace_back("digits_17", "12345678901234567", std::int64_t(12345678901234567), bigint_meta);
+    output.emplace_back("digits_18", "123456789012345678", std::int64_t(123456789012345678), bigint_meta);
+    output.emplace_back("digits_19", "1234567890123456789", std::int64_t(1234567890123456789), bigint_meta);
+    output.emplace_back("digits_18_negative", "-999999999999999999", std::int64_t(-999999999999999999), bigint_meta);
+    output.emplace_back("digits_18_zeros", "000000000000000000", std::int64_t(0), bigint_meta);
+    output.emplace_back("negative_zero", "-0", std::int64_t(0), bigint_meta);
+    output.emplace_back("digits_18_unsigned", "999999999999999999", std::uint64_t(999999999999999999), ubigint_meta);
+    output.emplace_back("digits_19_unsigned", "9999999999999999999", std::uint64_t(9999999999999999999ULL), ubigint_meta);
+
     // YEAR
     auto year_meta = meta_builder().type(column_type::year).unsigned_flag(true).build();
     output.emplace_back("regular_value", "1999", std::uint64_t(1999), year_meta);
@@ -479,6 +494,20 @@ void add_int_samples(
     output.emplace_back("unsigned_exp", "2e10", meta_unsigned);
     output.emplace_back("unsigned_lt_min", "-18446744073709551616", meta_unsigned);
     output.emplace_back("unsigned_gt_max", "18446744073709551616", meta_unsigned);
+    output.emplace_back("unsigned_negative", "-1", meta_unsigned);
+
+    // Invalid characters in different positions, covering the fast integer parsing algorithm
+    output.emplace_back("signed_only_minus", "-", meta_signed);
+    output.emplace_back("signed_double_minus", "--1", meta_signed);
+    output.emplace_back("signed_plus", "+1", meta_signed);
+    output.emplace_back("signed_whitespace", " 1", meta_signed);
+    output.emplace_back("signed_invalid_head", "1a345678", meta_signed);
+    output.emplace_back("signed_invalid_group", "1234567/", meta_signed);
+    output.emplace_back("signed_invalid_group_2", "12345678:1234567", meta_signed);
+    output.emplace_back("signed_invalid_group_3", "1234567812345678\x01", meta_signed);
+    output.emplace_back("signed_null_char", makesv("1234\0005678"), meta_signed);
+    output.emplace_back("unsigned_invalid_group", "12345678:", meta_unsigned);
+    output.emplace_back("unsigned_trailing_minus", "1234567-", meta_unsigned);
 }
 
 void add_bit_samples(
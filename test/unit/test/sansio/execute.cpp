@@ -239,7 +239,7 @@ BOOST_AUTO_TEST_CASE(execute_error_num_params)
 {
     // Setup
     const auto params = make_fv_arr("test", nullptr, 42);  // too many params
-    execute_fixture fix(any_execution_request({std::uint32_t(1), std::uint16_t(2), params}));
+    execute_fixture fix(any_execution_request({std::uint32_t(1), std::uint16_t(2), params, 0u}));
 
     // Run the algo. Nothing should be written to the server
     algo_test().check(fix, client_errc::wrong_num_params);
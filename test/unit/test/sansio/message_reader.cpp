@@ -6,8 +6,10 @@
 //
 
 #include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/compression_algorithm.hpp>
 #include <boost/mysql/error_code.hpp>
 
+#include <boost/mysql/impl/internal/protocol/compression.hpp>
 #include <boost/mysql/impl/internal/sansio/message_reader.hpp>
 #include <boost/mysql/impl/internal/sansio/read_buffer.hpp>
 
@@ -58,15 +60,17 @@ public:
     }
 
     // Reads bytes until reader.done() or all bytes in contents have been read.
-    // Resizes the buffer as required
-    void read_until_completion()
+    // Resizes the buffer as required. Reads at most max_read bytes at a time
+    void read_until_completion(std::size_t max_read = static_cast<std::size_t>(-1))
     {
         while (!reader.done() && remaining_bytes())
         {
             auto ec = reader.prepare_buffer();
             BOOST_TEST(ec == error_code());
+            if (reader.done())  // may happen with compression
+                break;
             std::size_t bytes_to_copy = (std::min)(reader.buffer().size(), contents_.size() - bytes_written_);
-            read_bytes(bytes_to_copy);
+            read_bytes((std::min)(bytes_to_copy, max_read));
         }
         BOOST_TEST(reader.done());
         BOOST_TEST(remaining_bytes() == 0u);
@@ -248,6 +252,43 @@ BOOST_AUTO_TEST_CASE(long_read)
     fix.check_buffer_stability();
 }
 
+// Long read with a multi-frame message. Intermediate headers are removed
+// once the message is complete, without affecting the bytes that follow it
+BOOST_AUTO_TEST_CASE(long_read_multiframe)
+{
+    // message to be parsed
+    auto first_msg_body = buffer_builder().add(u8vec(64, 0x04)).add(u8vec(64, 0x05)).add({0x0a}).build();
+    std::vector<std::uint8_t> second_msg_body{0x01, 0x02, 0x03};
+    reader_fixture fix(buffer_builder()
+                           .add(create_frame(42, u8vec(64, 0x04)))
+                           .add(create_frame(43, u8vec(64, 0x05)))
+                           .add(create_frame(44, {0x0a}))
+                           .add(create_frame(45, second_msg_body))
+                           .build());
+
+    // The read yields the two messages at once
+    fix.reader.prepare_read(fix.seqnum);
+    fix.read_bytes(64 * 2 + 1 + 3 + 4 * 4);
+    auto msg = fix.check_message(first_msg_body);
+    BOOST_TEST(fix.seqnum == 45u);
+
+    // Header space has been moved to the reserved area.
+    // The message ends where the next message starts
+    BOOST_TEST(fix.reader.internal_buffer().reserved_size() == 4u * 3u);
+    BOOST_TEST(msg.data() + msg.size() == fix.reader.internal_buffer().pending_first());
+
+    // Each body, except for the last one, was moved exactly once
+    BOOST_TEST(fix.reader.bytes_moved() == 64u * 2u);
+
+    // We can read the 2nd message, too
+    fix.reader.prepare_read(fix.seqnum);
+    fix.check_message(second_msg_body);
+    BOOST_TEST(fix.seqnum == 46u);
+
+    // Buffer shouldn't reallocate
+    fix.check_buffer_stability();
+}
+
 // Short reads
 BOOST_AUTO_TEST_CASE(short_reads_multiple)
 {
@@ -630,4 +671,155 @@ BOOST_AUTO_TEST_CASE(reset_keep_state_true)
     BOOST_TEST(fix.seqnum == 21u);
 }
 
+//
+// Compression. Compressed frames with uncompressed payloads don't require any library
+//
+BOOST_AUTO_TEST_CASE(compression_single_frame)
+{
+    const u8vec msg{0x01, 0x02, 0x03};
+    reader_fixture fix(create_compressed_frame(0, create_frame(42, msg)));
+    fix.reader.set_compression(boost::mysql::compression_algorithm::zlib);
+    fix.reader.prepare_read(fix.seqnum);
+    fix.read_until_completion();
+    fix.check_message(msg);
+    fix.check_buffer_stability();
+    BOOST_TEST(fix.seqnum == 43u);
+}
+
+BOOST_AUTO_TEST_CASE(compression_message_split_between_frames)
+{
+    const u8vec msg{0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+    auto frame = create_frame(42, msg);
+    auto contents = concat_copy(
+        create_compressed_frame(0, span<const std::uint8_t>(frame).first(6)),
+        create_compressed_frame(1, span<const std::uint8_t>(frame).subspan(6))
+    );
+    reader_fixture fix(std::move(contents));
+    fix.reader.set_compression(boost::mysql::compression_algorithm::zlib);
+    fix.reader.prepare_read(fix.seqnum);
+    fix.read_until_completion();
+    fix.check_message(msg);
+    BOOST_TEST(fix.seqnum == 43u);
+}
+
+BOOST_AUTO_TEST_CASE(compression_several_messages_in_frame)
+{
+    const u8vec msg1{0x01, 0x02, 0x03};
+    const u8vec msg2{0x04, 0x05};
+    auto frames = concat_copy(create_frame(42, msg1), create_frame(43, msg2));
+    reader_fixture fix(create_compressed_frame(0, frames));
+    fix.reader.set_compression(boost::mysql::compression_algorithm::zlib);
+    fix.reader.prepare_read(fix.seqnum);
+    fix.read_until_completion();
+    fix.check_message(msg1);
+
+    // The second message is cached
+    fix.reader.prepare_read(fix.seqnum);
+    fix.check_message(msg2);
+    BOOST_TEST(fix.seqnum == 44u);
+}
+
+BOOST_AUTO_TEST_CASE(compression_short_reads)
+{
+    const u8vec msg{0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+    auto frame = create_frame(42, msg);
+    auto contents = concat_copy(
+        create_compressed_frame(0, span<const std::uint8_t>(frame).first(3)),
+        create_compressed_frame(1, span<const std::uint8_t>(frame).subspan(3))
+    );
+    reader_fixture fix(std::move(contents));
+    fix.reader.set_compression(boost::mysql::compression_algorithm::zlib);
+    fix.reader.prepare_read(fix.seqnum);
+    fix.read_until_completion(1u);
+    fix.check_message(msg);
+    BOOST_TEST(fix.seqnum == 43u);
+}
+
+BOOST_AUTO_TEST_CASE(compression_buffer_resizing)
+{
+    // Neither the compressed frame nor the decompressed message fit in the buffers
+    const u8vec msg(50, 0x01);
+    reader_fixture fix(create_compressed_frame(0, create_frame(42, msg)), 16u);
+    fix.reader.set_compression(boost::mysql::compression_algorithm::zlib);
+    fix.reader.prepare_read(fix.seqnum);
+    fix.read_until_completion();
+    fix.check_message(msg);
+    BOOST_TEST(fix.seqnum == 43u);
+}
+
+BOOST_AUTO_TEST_CASE(compression_max_buffer_size_exceeded)
+{
+    const u8vec msg(50, 0x01);
+    reader_fixture fix(create_compressed_frame(0, create_frame(42, msg)), 16u, 32u);
+    fix.reader.set_compression(boost::mysql::compression_algorithm::zlib);
+    fix.reader.prepare_read(fix.seqnum);
+    auto ec = fix.reader.prepare_buffer();
+    BOOST_TEST(ec == error_code());
+    fix.read_bytes(fix.reader.buffer().size());
+    ec = fix.reader.prepare_buffer();
+    BOOST_TEST(ec == client_errc::max_buffer_size_exceeded);
+}
+
+BOOST_AUTO_TEST_CASE(compression_seqnum_mismatch)
+{
+    // Compressed sequence numbers are checked, too
+    const u8vec msg{0x01, 0x02, 0x03};
+    auto frame = create_frame(42, msg);
+    auto contents = concat_copy(
+        create_compressed_frame(0, span<const std::uint8_t>(frame).first(6)),
+        create_compressed_frame(2, span<const std::uint8_t>(frame).subspan(6))
+    );
+    reader_fixture fix(std::move(contents));
+    fix.reader.set_compression(boost::mysql::compression_algorithm::zlib);
+    fix.reader.prepare_read(fix.seqnum);
+    fix.read_bytes(21u);
+    BOOST_TEST_REQUIRE(fix.reader.done());
+    BOOST_TEST(fix.reader.error() == client_errc::sequence_number_mismatch);
+}
+
+BOOST_AUTO_TEST_CASE(compression_reset)
+{
+    // Compression is disabled by reset
+    reader_fixture fix(create_compressed_frame(0, create_frame(42, {0x01})));
+    fix.reader.set_compression(boost::mysql::compression_algorithm::zlib);
+    fix.reader.reset();
+    BOOST_TEST((fix.reader.compression() == boost::mysql::compression_algorithm::none));
+
+    fix.set_contents(create_frame(20, {0x09, 0x0a}));
+    fix.seqnum = 20;
+    fix.reader.prepare_read(fix.seqnum);
+    fix.read_until_completion();
+    fix.check_message({0x09, 0x0a});
+}
+
+#ifdef BOOST_MYSQL_HAS_ZLIB
+BOOST_AUTO_TEST_CASE(compression_zlib)
+{
+    const u8vec msg(200, 0x01);
+    u8vec contents;
+    auto frame = create_frame(42, msg);
+    compressed_seqnum_tracker seqnums;
+    serialize_compressed_frames(boost::mysql::compression_algorithm::zlib, 50u, frame, seqnums, contents);
+    BOOST_TEST(contents.size() < msg.size());  // actually compressed
+    reader_fixture fix(std::move(contents));
+    fix.reader.set_compression(boost::mysql::compression_algorithm::zlib);
+    fix.reader.prepare_read(fix.seqnum);
+    fix.read_until_completion();
+    fix.check_message(msg);
+    BOOST_TEST(fix.seqnum == 43u);
+}
+
+BOOST_AUTO_TEST_CASE(compression_zlib_error)
+{
+    // A compressed frame with an invalid payload
+    u8vec contents{0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04};
+    reader_fixture fix(std::move(contents));
+    fix.reader.set_compression(boost::mysql::compression_algorithm::zlib);
+    fix.reader.prepare_read(fix.seqnum);
+    fix.read_bytes(11u);
+    BOOST_TEST_REQUIRE(fix.reader.done());
+    BOOST_TEST(fix.reader.error() == client_errc::protocol_value_error);
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
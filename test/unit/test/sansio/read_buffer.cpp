@@ -20,8 +20,10 @@
 
 #include "test_common/assert_buffer_equals.hpp"
 #include "test_common/printing.hpp"
+#include "test_unit/counting_memory_resource.hpp"
 
 using namespace boost::mysql::detail;
+using boost::mysql::test::counting_memory_resource;
 using boost::mysql::client_errc;
 using boost::mysql::error_code;
 
@@ -171,6 +173,51 @@ BOOST_AUTO_TEST_CASE(initial_size_eq_max_size)
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(memory_resource)
+
+BOOST_AUTO_TEST_CASE(allocations_use_resource)
+{
+    counting_memory_resource resource;
+    {
+        // Creating the buffer allocates from the resource
+        read_buffer buff(16, 1024, &resource);
+        check_buffer(buff, {}, {}, {}, 16);
+        BOOST_TEST(resource.num_allocations == 1u);
+        BOOST_TEST(resource.bytes_allocated == 16u);
+
+        // Growing, too
+        copy_to_free_area(buff, {0x01, 0x02, 0x03, 0x04});
+        buff.move_to_pending(4);
+        auto ec = buff.grow_to_fit(100);
+        BOOST_TEST(ec == error_code());
+        check_buffer(buff, {}, {}, {0x01, 0x02, 0x03, 0x04}, 100);
+        BOOST_TEST(resource.num_allocations == 2u);
+        BOOST_TEST(resource.num_deallocations == 1u);
+        BOOST_TEST(resource.bytes_allocated >= 104u);
+
+        // Shrinking, too
+        buff.shrink(8);
+        check_buffer(buff, {}, {}, {0x01, 0x02, 0x03, 0x04}, 4);
+        BOOST_TEST(resource.num_allocations == 3u);
+        BOOST_TEST(resource.num_deallocations == 2u);
+    }
+
+    // Destroying the buffer returns all memory
+    BOOST_TEST(resource.num_deallocations == 3u);
+    BOOST_TEST(resource.bytes_allocated == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(no_resource)
+{
+    // If no resource is passed, the buffer works normally
+    read_buffer buff(16, 1024, nullptr);
+    auto ec = buff.grow_to_fit(100);
+    BOOST_TEST(ec == error_code());
+    check_buffer(buff, {}, {}, {}, 100);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE(move_to_pending)
 
 BOOST_AUTO_TEST_CASE(some_bytes)
@@ -436,6 +483,134 @@ BOOST_AUTO_TEST_CASE(zero_bytes)
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(compact)
+
+BOOST_AUTO_TEST_CASE(reserved_gt_moved_bytes)
+{
+    // Moving the other areas is cheap, so we compact
+    read_buffer buff(16);
+    stability_checker checker(buff);
+    copy_to_free_area(buff, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08});
+    buff.move_to_pending(8);
+    buff.move_to_current_message(7);
+    buff.move_to_reserved(5);
+    buff.compact(0);
+
+    check_buffer(buff, {}, {0x06, 0x07}, {0x08}, 13);
+    checker.check_stability();
+}
+
+BOOST_AUTO_TEST_CASE(reserved_eq_moved_bytes)
+{
+    read_buffer buff(16);
+    stability_checker checker(buff);
+    copy_to_free_area(buff, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06});
+    buff.move_to_pending(6);
+    buff.move_to_current_message(4);
+    buff.move_to_reserved(3);
+    buff.compact(0);
+
+    check_buffer(buff, {}, {0x04}, {0x05, 0x06}, 13);
+    checker.check_stability();
+}
+
+BOOST_AUTO_TEST_CASE(reserved_lt_moved_bytes)
+{
+    // Moving the other areas is expensive, and we have enough space, so we don't compact
+    read_buffer buff(16);
+    stability_checker checker(buff);
+    copy_to_free_area(buff, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06});
+    buff.move_to_pending(6);
+    buff.move_to_current_message(4);
+    buff.move_to_reserved(2);
+    buff.compact(10);
+
+    check_buffer(buff, {0x01, 0x02}, {0x03, 0x04}, {0x05, 0x06}, 10);
+    checker.check_stability();
+}
+
+BOOST_AUTO_TEST_CASE(free_size_lt_required)
+{
+    // Compacting is expensive, but required to fit the bytes
+    read_buffer buff(16);
+    stability_checker checker(buff);
+    copy_to_free_area(buff, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06});
+    buff.move_to_pending(6);
+    buff.move_to_current_message(4);
+    buff.move_to_reserved(2);
+    buff.compact(11);
+
+    check_buffer(buff, {}, {0x03, 0x04}, {0x05, 0x06}, 12);
+    checker.check_stability();
+}
+
+BOOST_AUTO_TEST_CASE(free_size_lt_reserved)
+{
+    // Compacting is expensive, but it would reclaim more space than the one we have
+    read_buffer buff(8);
+    stability_checker checker(buff);
+    copy_to_free_area(buff, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07});
+    buff.move_to_pending(7);
+    buff.move_to_current_message(6);
+    buff.move_to_reserved(2);
+    buff.compact(1);
+
+    check_buffer(buff, {}, {0x03, 0x04, 0x05, 0x06}, {0x07}, 3);
+    checker.check_stability();
+}
+
+BOOST_AUTO_TEST_CASE(zero_bytes)
+{
+    read_buffer buff(16);
+    stability_checker checker(buff);
+    copy_to_free_area(buff, {0x01, 0x02, 0x03, 0x04});
+    buff.move_to_pending(4);
+    buff.move_to_current_message(3);
+    buff.compact(12);
+
+    check_buffer(buff, {}, {0x01, 0x02, 0x03}, {0x04}, 12);
+    checker.check_stability();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(shrink)
+
+BOOST_AUTO_TEST_CASE(empty_buffer)
+{
+    read_buffer buff(512);
+    buff.shrink(16);
+    check_buffer(buff, {}, {}, {}, 16);
+}
+
+BOOST_AUTO_TEST_CASE(with_other_areas)
+{
+    // Reserved is removed, and the other areas are kept
+    read_buffer buff(512);
+    copy_to_free_area(buff, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08});
+    buff.move_to_pending(8);
+    buff.move_to_current_message(6);
+    buff.move_to_reserved(2);
+    buff.shrink(16);
+
+    check_buffer(buff, {}, {0x03, 0x04, 0x05, 0x06}, {0x07, 0x08}, 10);
+}
+
+BOOST_AUTO_TEST_CASE(target_lt_used_size)
+{
+    // We never discard message or pending bytes
+    read_buffer buff(512);
+    copy_to_free_area(buff, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08});
+    buff.move_to_pending(8);
+    buff.move_to_current_message(6);
+    buff.move_to_reserved(1);
+    buff.shrink(4);
+
+    check_buffer(buff, {}, {0x02, 0x03, 0x04, 0x05, 0x06}, {0x07, 0x08}, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE(grow_to_fit)
 
 BOOST_AUTO_TEST_CASE(not_enough_space)
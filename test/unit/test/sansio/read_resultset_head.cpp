@@ -15,6 +15,7 @@
 #include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
 #include <boost/mysql/impl/internal/sansio/read_resultset_head.hpp>
 
+#include <boost/core/span.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include "test_common/buffer_concat.hpp"
@@ -30,6 +31,12 @@
 #include "test_unit/create_row_message.hpp"
 #include "test_unit/mock_execution_processor.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
 using namespace boost::mysql;
 using namespace boost::mysql::test;
 
@@ -252,6 +259,180 @@ BOOST_AUTO_TEST_CASE(error_on_meta)
     fix.proc.num_calls().on_num_meta(1).on_meta(1).validate();
 }
 
+// LOAD DATA LOCAL INFILE requests are only recognized if the capability was negotiated
+struct local_infile_fixture : fixture
+{
+    local_infile_fixture() { st.current_capabilities = detail::capabilities(detail::CLIENT_LOCAL_FILES); }
+};
+
+// LOAD DATA LOCAL INFILE: the server requests a file before sending the actual response
+BOOST_AUTO_TEST_CASE(local_infile_success)
+{
+    // Setup
+    local_infile_fixture fix;
+    std::vector<std::string> file_names;
+    std::vector<std::size_t> buffer_sizes;
+    std::vector<std::string> chunks{"abc", "de"};
+    fix.st.local_infile = [&](string_view file_name, boost::span<std::uint8_t> buff, error_code&) {
+        file_names.emplace_back(file_name);
+        buffer_sizes.push_back(buff.size());
+        if (file_names.size() > chunks.size())
+            return std::size_t(0);
+        const auto& chunk = chunks[file_names.size() - 1u];
+        std::copy(chunk.begin(), chunk.end(), buff.begin());
+        return chunk.size();
+    };
+
+    // Run the algo. Each chunk is sent as a packet, followed by an empty packet
+    algo_test()
+        .expect_read(create_frame(1, {0xfb, 'f', '.', 'c', 's', 'v'}))
+        .expect_write(create_frame(2, {'a', 'b', 'c'}))
+        .expect_write(create_frame(3, {'d', 'e'}))
+        .expect_write(create_empty_frame(4))
+        .expect_read(create_ok_frame(5, ok_builder().affected_rows(2).build()))
+        .check(fix);
+
+    // Verify
+    fix.proc.num_calls().on_head_ok_packet(1).validate();
+    BOOST_TEST(fix.proc.is_complete());
+    BOOST_TEST(fix.proc.affected_rows() == 2u);
+    BOOST_TEST(fix.proc.sequence_number() == 6u);
+    const std::vector<std::string> expected_names{"f.csv", "f.csv", "f.csv"};
+    BOOST_TEST(file_names == expected_names, boost::test_tools::per_element());
+
+    // The chunk size is limited by the max buffer size (1024 in the fixture), minus the frame header
+    const std::vector<std::size_t> expected_sizes{1020u, 1020u, 1020u};
+    BOOST_TEST(buffer_sizes == expected_sizes, boost::test_tools::per_element());
+}
+
+// If no handler is set, the server is told that the file is empty,
+// and the response is read to keep the connection usable
+BOOST_AUTO_TEST_CASE(local_infile_no_handler)
+{
+    // Setup
+    local_infile_fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_read(create_frame(1, {0xfb, 'f'}))
+        .expect_write(create_empty_frame(2))
+        .expect_read(create_ok_frame(3, ok_builder().build()))
+        .check(fix, client_errc::local_infile_no_handler);
+
+    // Verify
+    fix.proc.num_calls().on_head_ok_packet(1).validate();
+    BOOST_TEST(fix.proc.sequence_number() == 4u);
+}
+
+BOOST_AUTO_TEST_CASE(local_infile_handler_error)
+{
+    // Setup
+    local_infile_fixture fix;
+    int num_calls = 0;
+    fix.st.local_infile = [&](string_view, boost::span<std::uint8_t> buff, error_code& ec) {
+        if (++num_calls > 1)
+        {
+            ec = client_errc::wrong_num_params;
+            return std::size_t(0);
+        }
+        buff[0] = 'a';
+        return std::size_t(1);
+    };
+
+    // Run the algo
+    algo_test()
+        .expect_read(create_frame(1, {0xfb, 'f'}))
+        .expect_write(create_frame(2, {'a'}))
+        .expect_write(create_empty_frame(3))
+        .expect_read(create_ok_frame(4, ok_builder().build()))
+        .check(fix, client_errc::wrong_num_params);
+
+    // Verify
+    fix.proc.num_calls().on_head_ok_packet(1).validate();
+    BOOST_TEST(num_calls == 2);
+}
+
+// Server errors take precedence over handler errors
+BOOST_AUTO_TEST_CASE(local_infile_server_error)
+{
+    // Setup
+    local_infile_fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_read(create_frame(1, {0xfb, 'f'}))
+        .expect_write(create_empty_frame(2))
+        .expect_read(
+            err_builder().seqnum(3).code(common_server_errc::er_bad_db_error).message("no_db").build_frame()
+        )
+        .check(fix, common_server_errc::er_bad_db_error, create_server_diag("no_db"));
+}
+
+// In multi-statement queries, the remaining resultsets are read before reporting the handler error
+BOOST_AUTO_TEST_CASE(local_infile_error_more_results)
+{
+    // Setup
+    local_infile_fixture fix;
+
+    // Run the algo. The server keeps executing statements, so no error is reported yet
+    algo_test()
+        .expect_read(create_frame(1, {0xfb, 'f'}))
+        .expect_write(create_empty_frame(2))
+        .expect_read(create_ok_frame(3, ok_builder().more_results(true).build()))
+        .check(fix);
+
+    // Verify
+    fix.proc.num_calls().on_head_ok_packet(1).validate();
+    BOOST_TEST(fix.proc.is_reading_head());
+    BOOST_TEST(fix.st.local_infile_err == client_errc::local_infile_no_handler);
+
+    // Read the last resultset. The error is reported now
+    fix.algo.reset();
+    algo_test()
+        .expect_read(create_ok_frame(4, ok_builder().build()))
+        .check(fix, client_errc::local_infile_no_handler);
+
+    // Verify
+    fix.proc.num_calls().on_head_ok_packet(2).validate();
+    BOOST_TEST(fix.proc.is_complete());
+    BOOST_TEST(fix.st.local_infile_err == error_code());
+    BOOST_TEST(!fix.st.execution_in_progress);
+}
+
+// In a pipeline, the requests following the LOAD DATA statement have already been sent
+// and would be interpreted as file contents. Fail without invoking the handler
+struct pipeline_local_infile_fixture : algo_fixture_base
+{
+    mock_execution_processor proc;
+    detail::read_resultset_head_algo algo{diag, {&proc}, true};
+
+    pipeline_local_infile_fixture()
+    {
+        st.current_capabilities = detail::capabilities(detail::CLIENT_LOCAL_FILES);
+        proc.sequence_number() = 1;
+    }
+};
+
+BOOST_AUTO_TEST_CASE(local_infile_in_pipeline)
+{
+    // Setup
+    pipeline_local_infile_fixture fix;
+    int num_calls = 0;
+    fix.st.local_infile = [&](string_view, boost::span<std::uint8_t>, error_code&) {
+        ++num_calls;
+        return std::size_t(0);
+    };
+
+    // Run the algo. Nothing is written
+    algo_test()
+        .expect_read(create_frame(1, {0xfb, 'f'}))
+        .check(fix, client_errc::local_infile_in_pipeline);
+
+    // Verify
+    fix.proc.num_calls().validate();
+    BOOST_TEST(num_calls == 0);
+}
+
 BOOST_AUTO_TEST_CASE(reset)
 {
     // Setup
@@ -22,6 +22,7 @@
 #include "test_unit/algo_test.hpp"
 #include "test_unit/create_err.hpp"
 #include "test_unit/create_execution_processor.hpp"
+#include "test_unit/create_frame.hpp"
 #include "test_unit/create_meta.hpp"
 #include "test_unit/create_ok.hpp"
 #include "test_unit/create_ok_frame.hpp"
@@ -57,6 +58,7 @@ struct fixture : algo_fixture_base
         );
         proc.sequence_number() = 42;
         st.backslash_escapes = false;
+        st.execution_in_progress = true;
     }
 
     void validate_refs(std::size_t num_rows)
@@ -86,6 +88,7 @@ BOOST_AUTO_TEST_CASE(eof)
     BOOST_TEST(fix.proc.affected_rows() == 1u);
     BOOST_TEST(fix.proc.info() == "1st");
     BOOST_TEST(fix.st.backslash_escapes);
+    BOOST_TEST(fix.st.execution_in_progress);  // more resultsets follow
 }
 
 BOOST_AUTO_TEST_CASE(eof_no_backslash_escapes)
@@ -307,6 +310,100 @@ BOOST_AUTO_TEST_CASE(state_reading_head)
     fix.proc.num_calls().on_num_meta(1).on_meta(1).on_row_ok_packet(1).validate();
 }
 
+// read_some_rows is a no-op if there is no space for rows
+BOOST_AUTO_TEST_CASE(no_space)
+{
+    // Setup
+    fixture fix;
+    fix.algo = detail::read_some_rows_algo(fix.diag, {&fix.proc, output_ref(span<fixture::row1>(), 0)});
+
+    // Run the algo
+    algo_test().check(fix);
+
+    // Validate
+    BOOST_TEST(fix.result() == 0u);  // num read rows
+    BOOST_TEST(fix.proc.is_reading_rows());
+    fix.proc.num_calls().on_num_meta(1).on_meta(1).validate();
+}
+
+// Server-side cursors: when the fetched rows run out, a fetch command is sent
+BOOST_AUTO_TEST_CASE(cursor)
+{
+    // Setup
+    fixture fix;
+    fix.st.cursor = {3u, 2u, false};
+
+    // Run the algo. The cursor was just opened, so the first message
+    // is the OK packet signaling the end of the (empty) batch
+    auto fetch_frame = create_frame(0, {0x1c, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00});
+    algo_test()
+        .expect_read(create_eof_frame(42, ok_builder().cursor_exists(true).build()))
+        .expect_write(fetch_frame)
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(1, "abc"))
+                         .add(create_text_row_message(2, "von"))
+                         .add(create_eof_frame(3, ok_builder().cursor_exists(true).build()))
+                         .build())
+        .check(fix);
+
+    // Validate. The batch end is not the end of the resultset
+    BOOST_TEST(fix.result() == 2u);  // num read rows
+    BOOST_TEST(fix.proc.is_reading_rows());
+    BOOST_TEST(fix.st.cursor.fetch_pending);
+    BOOST_TEST(fix.st.execution_in_progress);
+    fix.validate_refs(2);
+    fix.proc.num_calls()
+        .on_num_meta(1)
+        .on_meta(1)
+        .on_row_batch_start(2)
+        .on_row(2)
+        .on_row_batch_finish(2)
+        .validate();
+
+    // Run the algo again. The server sends the last row
+    fix.algo.reset();
+    algo_test()
+        .expect_write(fetch_frame)
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(1, "aaa"))
+                         .add(create_eof_frame(
+                             2,
+                             ok_builder().cursor_exists(true).last_row_sent(true).info("1st").build()
+                         ))
+                         .build())
+        .check(fix);
+
+    // Validate
+    BOOST_TEST(fix.result() == 1u);  // num read rows
+    BOOST_TEST(fix.proc.is_complete());
+    BOOST_TEST(!fix.st.cursor.fetch_pending);
+    BOOST_TEST(!fix.st.execution_in_progress);
+    BOOST_TEST(fix.proc.info() == "1st");
+    fix.proc.num_calls()
+        .on_num_meta(1)
+        .on_meta(1)
+        .on_row_batch_start(3)
+        .on_row(3)
+        .on_row_batch_finish(3)
+        .on_row_ok_packet(1)
+        .validate();
+}
+
+// If we didn't request a cursor, OK packets are always the end of the resultset
+BOOST_AUTO_TEST_CASE(cursor_flag_no_cursor)
+{
+    // Setup
+    fixture fix;
+
+    // Run the algo
+    algo_test().expect_read(create_eof_frame(42, ok_builder().cursor_exists(true).build())).check(fix);
+
+    // Validate
+    BOOST_TEST(fix.result() == 0u);  // num read rows
+    BOOST_TEST(fix.proc.is_complete());
+    BOOST_TEST(!fix.st.cursor.fetch_pending);
+}
+
 BOOST_AUTO_TEST_CASE(error_network_error)
 {
     algo_test().expect_read(create_text_row_message(42, "aaa")).check_network_errors<fixture>();
@@ -11,6 +11,7 @@
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 
+#include <boost/mysql/impl/internal/protocol/capabilities.hpp>
 #include <boost/mysql/impl/internal/sansio/reset_connection.hpp>
 #include <boost/mysql/impl/internal/sansio/run_pipeline.hpp>
 
@@ -22,6 +23,7 @@
 #include "test_unit/create_frame.hpp"
 #include "test_unit/create_ok.hpp"
 #include "test_unit/create_ok_frame.hpp"
+#include "test_unit/create_statement.hpp"
 
 using namespace boost::mysql::test;
 using namespace boost::mysql;
@@ -53,6 +55,37 @@ BOOST_AUTO_TEST_CASE(read_response_success)
     BOOST_TEST(fix.st.current_charset == character_set());
 }
 
+// The session was set back to the server's defaults, undoing any setup
+// performed after connecting, so it's no longer clean
+BOOST_AUTO_TEST_CASE(read_response_session_state_changed)
+{
+    // Setup
+    read_response_fixture fix;
+    fix.st.current_capabilities = detail::capabilities(detail::CLIENT_SESSION_TRACK);
+
+    // Run the algo
+    algo_test().expect_read(create_ok_frame(11, ok_builder().build())).check(fix);
+
+    // A pool reset is required to restore the setup
+    BOOST_TEST(fix.st.session_state_changed);
+    BOOST_TEST(fix.st.session_reset_required());
+}
+
+BOOST_AUTO_TEST_CASE(read_response_clears_statement_cache)
+{
+    // Setup
+    read_response_fixture fix;
+    fix.st.stmt_cache.put("SELECT 1", statement_builder().id(1).build());
+    fix.st.long_data_params.push_back({1u, 0u});
+
+    // Run the algo
+    algo_test().expect_read(create_ok_frame(11, ok_builder().build())).check(fix);
+
+    // The server deallocated all statements
+    BOOST_TEST(fix.st.stmt_cache.size() == 0u);
+    BOOST_TEST(fix.st.long_data_params.empty());
+}
+
 BOOST_AUTO_TEST_CASE(read_response_success_no_backslash_escapes)
 {
     // Setup
@@ -79,6 +112,7 @@ BOOST_AUTO_TEST_CASE(read_response_error_packet)
     // Setup
     read_response_fixture fix;
     fix.st.current_charset = utf8mb4_charset;
+    fix.st.stmt_cache.put("SELECT 1", statement_builder().id(1).build());
 
     // Run the algo
     algo_test()
@@ -89,8 +123,65 @@ BOOST_AUTO_TEST_CASE(read_response_error_packet)
                          .build_frame())
         .check(fix, common_server_errc::er_bad_db_error, create_server_diag("my_message"));
 
-    // The charset was not updated
+    // The charset and the statement cache were not updated
     BOOST_TEST(fix.st.current_charset == utf8mb4_charset);
+    BOOST_TEST(fix.st.stmt_cache.size() == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(read_response_shrinks_buffers)
+{
+    // Setup. Buffers are bigger than the threshold
+    read_response_fixture fix;
+    fix.st.initial_read_buffer_size = 16u;
+    fix.st.buffer_shrink_threshold = 512u;
+    fix.st.write_buffer.reserve(2048u);
+    BOOST_TEST(fix.st.reader.internal_buffer().size() == 1024u);
+
+    // Run the algo
+    algo_test().expect_read(create_ok_frame(11, ok_builder().build())).check(fix);
+
+    // Buffers went back to their initial size
+    BOOST_TEST(fix.st.reader.internal_buffer().size() == 16u);
+    BOOST_TEST(fix.st.write_buffer.capacity() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(read_response_buffers_below_threshold)
+{
+    // Setup. Buffers are not bigger than the threshold
+    read_response_fixture fix;
+    fix.st.initial_read_buffer_size = 16u;
+    fix.st.buffer_shrink_threshold = 1024u;
+    fix.st.write_buffer.reserve(1024u);
+    auto* read_buffer_first = fix.st.reader.internal_buffer().first();
+    auto* write_buffer_first = fix.st.write_buffer.data();
+
+    // Run the algo
+    algo_test().expect_read(create_ok_frame(11, ok_builder().build())).check(fix);
+
+    // Buffers were not touched
+    BOOST_TEST(fix.st.reader.internal_buffer().size() == 1024u);
+    BOOST_TEST(fix.st.reader.internal_buffer().first() == read_buffer_first);
+    BOOST_TEST(fix.st.write_buffer.data() == write_buffer_first);
+}
+
+BOOST_AUTO_TEST_CASE(read_response_error_no_shrink)
+{
+    // Setup
+    read_response_fixture fix;
+    fix.st.initial_read_buffer_size = 16u;
+    fix.st.buffer_shrink_threshold = 512u;
+
+    // Run the algo
+    algo_test()
+        .expect_read(err_builder()
+                         .seqnum(11)
+                         .code(common_server_errc::er_bad_db_error)
+                         .message("my_message")
+                         .build_frame())
+        .check(fix, common_server_errc::er_bad_db_error, create_server_diag("my_message"));
+
+    // The session wasn't reset, so buffers are not shrunk
+    BOOST_TEST(fix.st.reader.internal_buffer().size() == 1024u);
 }
 
 //
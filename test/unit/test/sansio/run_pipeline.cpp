@@ -12,12 +12,14 @@
 #include <boost/mysql/error_with_diagnostics.hpp>
 #include <boost/mysql/pipeline.hpp>
 #include <boost/mysql/statement.hpp>
+#include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/algo_params.hpp>
 #include <boost/mysql/detail/pipeline.hpp>
 #include <boost/mysql/detail/resultset_encoding.hpp>
 
+#include <boost/mysql/impl/internal/protocol/capabilities.hpp>
 #include <boost/mysql/impl/internal/sansio/run_pipeline.hpp>
 
 #include <boost/asio/error.hpp>
@@ -65,9 +67,10 @@ struct fixture_base : algo_fixture_base
     fixture_base(
         span<const pipeline_request_stage> stages,
         span<const std::uint8_t> req_buffer = mock_request,
-        std::vector<stage_response>* response = nullptr
+        std::vector<stage_response>* response = nullptr,
+        bool execution_summaries = false
     )
-        : algo(diag, {req_buffer, stages, response})
+        : algo(diag, {req_buffer, stages, response, execution_summaries})
     {
     }
 };
@@ -76,8 +79,12 @@ struct fixture : fixture_base
 {
     std::vector<stage_response> resp;
 
-    fixture(span<const pipeline_request_stage> stages, span<const std::uint8_t> req_buffer = mock_request)
-        : fixture_base(stages, req_buffer, &resp)
+    fixture(
+        span<const pipeline_request_stage> stages,
+        span<const std::uint8_t> req_buffer = mock_request,
+        bool execution_summaries = false
+    )
+        : fixture_base(stages, req_buffer, &resp, execution_summaries)
     {
     }
 
@@ -140,6 +147,39 @@ BOOST_AUTO_TEST_CASE(execute_success)
     BOOST_TEST(detail::access::get_impl(res1).encoding() == resultset_encoding::text);
 }
 
+// A cursor left open by a previous execution doesn't cause fetch requests to be issued
+BOOST_AUTO_TEST_CASE(execute_after_partially_read_cursor)
+{
+    // Setup
+    const std::array<pipeline_request_stage, 1> stages{
+        {
+         {pipeline_stage_kind::execute, 1u, resultset_encoding::text},
+         }
+    };
+    fixture fix(stages);
+    fix.st.cursor = {3u, 10u, true};
+
+    // Run the test. No fetch request is written
+    algo_test()
+        .expect_write(mock_request)
+        .expect_read(create_frame(1, {0x01}))
+        .expect_read(create_coldef_frame(2, meta_builder().type(column_type::tinyint).build_coldef()))
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(3, 42))
+                         .add(create_eof_frame(4, ok_builder().build()))
+                         .build())
+        .check(fix);
+
+    // The stage succeeded
+    BOOST_TEST_REQUIRE(fix.resp.size() == stages.size());
+    fix.check_all_stages_succeeded();
+    BOOST_TEST(fix.resp.at(0).as_results().rows() == makerows(1, 42), per_element());
+
+    // The cursor state was cleared
+    BOOST_TEST(fix.st.cursor.fetch_size == 0u);
+    BOOST_TEST(!fix.st.cursor.fetch_pending);
+}
+
 BOOST_AUTO_TEST_CASE(prepare_statement_success)
 {
     // Setup
@@ -192,6 +232,9 @@ BOOST_AUTO_TEST_CASE(close_statement_success)
     // All stages succeeded
     BOOST_TEST_REQUIRE(fix.resp.size() == stages.size());
     fix.check_all_stages_succeeded();
+
+    // Closing statements changes the session state. The server doesn't report it
+    BOOST_TEST(fix.st.session_state_changed);
 }
 
 BOOST_AUTO_TEST_CASE(reset_connection)
@@ -261,6 +304,188 @@ BOOST_AUTO_TEST_CASE(ping)
     BOOST_TEST(fix.st.backslash_escapes == false);
 }
 
+BOOST_AUTO_TEST_CASE(execute_batch_success)
+{
+    // Setup
+    const std::array<pipeline_request_stage, 2> stages{
+        {
+         {pipeline_stage_kind::execute_batch, 1u, std::size_t(3)},
+         {pipeline_stage_kind::ping, 1u, {}},
+         }
+    };
+    fixture fix(stages);
+
+    // Run the test. Every response uses the same sequence number
+    algo_test()
+        .expect_write(mock_request)
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(2).warnings(1).build()))
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(1).last_insert_id(10).build()))
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(4).last_insert_id(12).warnings(2).build()))
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .check(fix);
+
+    // All stages succeeded
+    BOOST_TEST_REQUIRE(fix.resp.size() == stages.size());
+    fix.check_all_stages_succeeded();
+
+    // Counters were aggregated
+    auto summary = fix.resp.at(0).as_summary();
+    BOOST_TEST(summary.affected_rows == 7u);
+    BOOST_TEST(summary.last_insert_id == 10u);
+    BOOST_TEST(summary.warning_count == 3u);
+}
+
+// Summaries hold the sum of all warning counts, even if it doesn't fit in an OK packet
+BOOST_AUTO_TEST_CASE(execute_batch_warnings)
+{
+    // Setup
+    const std::array<pipeline_request_stage, 1> stages{
+        {
+         {pipeline_stage_kind::execute_batch, 1u, std::size_t(2)},
+         }
+    };
+    fixture fix(stages);
+
+    // Run the test
+    algo_test()
+        .expect_write(mock_request)
+        .expect_read(create_ok_frame(1, ok_builder().warnings(0xfff0).build()))
+        .expect_read(create_ok_frame(1, ok_builder().warnings(0x20).build()))
+        .check(fix);
+
+    // The sum was not truncated
+    BOOST_TEST_REQUIRE(fix.resp.size() == stages.size());
+    BOOST_TEST(fix.resp.at(0).as_summary().warning_count == 0x10010u);
+}
+
+BOOST_AUTO_TEST_CASE(execute_batch_error)
+{
+    // Setup
+    const std::array<pipeline_request_stage, 2> stages{
+        {
+         {pipeline_stage_kind::execute_batch, 1u, std::size_t(3)},
+         {pipeline_stage_kind::ping, 1u, {}},
+         }
+    };
+    fixture fix(stages);
+
+    // Run the test. Errors don't prevent reading the remaining responses,
+    // and only the first one is reported
+    algo_test()
+        .expect_write(mock_request)
+        .expect_read(err_builder()
+                         .seqnum(1)
+                         .code(common_server_errc::er_dup_entry)
+                         .message("duplicate")
+                         .build_frame())
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(1).build()))
+        .expect_read(err_builder().seqnum(1).code(common_server_errc::er_bad_db_error).build_frame())
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .check(fix, common_server_errc::er_dup_entry, create_server_diag("duplicate"));
+
+    // Stage results
+    BOOST_TEST_REQUIRE(fix.resp.size() == stages.size());
+    fix.check_stage_error(0, common_server_errc::er_dup_entry, create_server_diag("duplicate"));
+    fix.check_stage_error(1, {}, {});
+}
+
+BOOST_AUTO_TEST_CASE(execute_batch_returned_rows)
+{
+    // Setup
+    const std::array<pipeline_request_stage, 2> stages{
+        {
+         {pipeline_stage_kind::execute_batch, 1u, std::size_t(2)},
+         {pipeline_stage_kind::ping, 1u, {}},
+         }
+    };
+    fixture fix(stages);
+
+    // Run the test. Statements returning rows can't be handled, and the error is fatal
+    algo_test()
+        .expect_write(mock_request)
+        .expect_read(create_frame(1, {0x01}))
+        .check(fix, client_errc::batch_returned_rows);
+
+    // Stage results
+    BOOST_TEST_REQUIRE(fix.resp.size() == stages.size());
+    fix.check_stage_error(0, client_errc::batch_returned_rows, {});
+    fix.check_stage_error(1, client_errc::batch_returned_rows, {});
+}
+
+// Execution stages can generate summaries instead of results
+BOOST_AUTO_TEST_CASE(execute_summary_success)
+{
+    // Setup
+    const std::array<pipeline_request_stage, 3> stages{
+        {
+         {pipeline_stage_kind::execute, 42u, resultset_encoding::binary},
+         {pipeline_stage_kind::execute, 11u, resultset_encoding::text},
+         {pipeline_stage_kind::prepare_statement, 5u, {}},
+         }
+    };
+    fixture fix(stages, mock_request, true);
+
+    // Run the test. The 2nd stage returns rows and multiple resultsets
+    algo_test()
+        .expect_write(mock_request)
+        .expect_read(create_ok_frame(42, ok_builder().affected_rows(4).last_insert_id(2).build()))
+        .expect_read(create_frame(11, {0x01}))
+        .expect_read(create_coldef_frame(12, meta_builder().type(column_type::tinyint).build_coldef()))
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(13, 42))
+                         .add(create_eof_frame(14, ok_builder().warnings(1).more_results(true).build()))
+                         .build())
+        .expect_read(create_ok_frame(15, ok_builder().affected_rows(2).last_insert_id(7).warnings(2).build()))
+        .expect_read(prepare_stmt_response_builder().seqnum(5).id(3).num_columns(0).num_params(0).build())
+        .check(fix);
+
+    // All stages succeeded
+    BOOST_TEST_REQUIRE(fix.resp.size() == stages.size());
+    fix.check_all_stages_succeeded();
+
+    // Check summaries
+    auto summary0 = fix.resp.at(0).as_summary();
+    BOOST_TEST(summary0.affected_rows == 4u);
+    BOOST_TEST(summary0.last_insert_id == 2u);
+    BOOST_TEST(summary0.warning_count == 0u);
+
+    auto summary1 = fix.resp.at(1).as_summary();
+    BOOST_TEST(summary1.affected_rows == 2u);
+    BOOST_TEST(summary1.last_insert_id == 7u);
+    BOOST_TEST(summary1.warning_count == 3u);
+
+    // Other stage kinds are not affected
+    BOOST_TEST(fix.resp.at(2).as_statement().id() == 3u);
+}
+
+BOOST_AUTO_TEST_CASE(execute_summary_error)
+{
+    // Setup
+    const std::array<pipeline_request_stage, 2> stages{
+        {
+         {pipeline_stage_kind::execute, 42u, resultset_encoding::binary},
+         {pipeline_stage_kind::execute, 11u, resultset_encoding::text},
+         }
+    };
+    fixture fix(stages, mock_request, true);
+
+    // Run the test
+    algo_test()
+        .expect_write(mock_request)
+        .expect_read(err_builder()
+                         .seqnum(42)
+                         .code(common_server_errc::er_bad_field_error)
+                         .message("bad field")
+                         .build_frame())
+        .expect_read(create_ok_frame(11, ok_builder().affected_rows(1).build()))
+        .check(fix, common_server_errc::er_bad_field_error, create_server_diag("bad field"));
+
+    // Stage results
+    BOOST_TEST_REQUIRE(fix.resp.size() == stages.size());
+    fix.check_stage_error(0, common_server_errc::er_bad_field_error, create_server_diag("bad field"));
+    BOOST_TEST(fix.resp.at(1).as_summary().affected_rows == 1u);
+}
+
 BOOST_AUTO_TEST_CASE(combination)
 {
     // Setup. Typical connection setup pipeline, where we reset, set names,
@@ -298,6 +523,9 @@ BOOST_AUTO_TEST_CASE(combination)
     BOOST_TEST(fix.st.current_charset == utf8mb4_charset);
     BOOST_TEST(fix.resp.at(3).as_statement().id() == 3u);
     BOOST_TEST(fix.resp.at(4).as_statement().id() == 1u);
+
+    // All responses were read, so no data is pending
+    BOOST_TEST(!fix.st.execution_in_progress);
 }
 
 BOOST_AUTO_TEST_CASE(no_requests)
@@ -433,6 +661,37 @@ BOOST_AUTO_TEST_CASE(fatal_error_first)
     fix.check_stage_error(2, asio::error::network_reset, {});
 }
 
+// LOAD DATA LOCAL INFILE is not supported in pipelines. The handler is not invoked
+BOOST_AUTO_TEST_CASE(local_infile_request)
+{
+    // Setup
+    const std::array<pipeline_request_stage, 2> stages{
+        {
+         {pipeline_stage_kind::execute, 10u, resultset_encoding::text},
+         {pipeline_stage_kind::ping, 32u, {}},
+         }
+    };
+    fixture fix(stages);
+    fix.st.current_capabilities = detail::capabilities(detail::CLIENT_LOCAL_FILES);
+    int num_calls = 0;
+    fix.st.local_infile = [&](string_view, span<std::uint8_t>, error_code&) {
+        ++num_calls;
+        return std::size_t(0);
+    };
+
+    // Run the test. Nothing is written after the pipeline request
+    algo_test()
+        .expect_write(mock_request)
+        .expect_read(create_frame(10, {0xfb, 'f'}))
+        .check(fix, client_errc::local_infile_in_pipeline);
+
+    // The error is fatal, so subsequent stages are failed
+    BOOST_TEST(fix.resp.size() == stages.size());
+    fix.check_stage_error(0, client_errc::local_infile_in_pipeline, {});
+    fix.check_stage_error(1, client_errc::local_infile_in_pipeline, {});
+    BOOST_TEST(num_calls == 0);
+}
+
 BOOST_AUTO_TEST_CASE(fatal_error_middle)
 {
     // Setup
@@ -457,6 +716,9 @@ BOOST_AUTO_TEST_CASE(fatal_error_middle)
     fix.check_stage_error(0, {}, {});
     fix.check_stage_error(1, asio::error::network_reset, {});
     fix.check_stage_error(2, asio::error::network_reset, {});
+
+    // Responses were left unread
+    BOOST_TEST(fix.st.execution_in_progress);
 }
 
 // If there are fatal and non-fatal errors, the fatal one is the result of the operation
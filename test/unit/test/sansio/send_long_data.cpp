@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+
+#include <boost/mysql/impl/internal/sansio/send_long_data.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "test_common/create_diagnostics.hpp"
+#include "test_unit/algo_test.hpp"
+#include "test_unit/create_frame.hpp"
+
+using namespace boost::mysql::test;
+using namespace boost::mysql;
+
+BOOST_AUTO_TEST_SUITE(test_send_long_data)
+
+struct fixture : algo_fixture_base
+{
+    std::vector<std::uint8_t> data;
+    detail::send_long_data_algo algo;
+
+    fixture(
+        std::vector<std::uint8_t> data_arg = {0x01, 0x02, 0x03},
+        std::uint16_t param_index = 1u,
+        std::size_t max_bufsize = default_max_buffsize
+    )
+        : algo_fixture_base(create_server_diag("Diagnostics not cleared"), max_bufsize),
+          data(std::move(data_arg)),
+          algo(diag, {std::uint32_t(3u), std::uint16_t(2u), param_index, data})
+    {
+    }
+
+    void check_long_data_params(const std::vector<detail::long_data_param>& expected) const
+    {
+        BOOST_TEST_REQUIRE(st.long_data_params.size() == expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            BOOST_TEST(st.long_data_params[i].statement_id == expected[i].statement_id);
+            BOOST_TEST(st.long_data_params[i].param_index == expected[i].param_index);
+        }
+    }
+};
+
+BOOST_AUTO_TEST_CASE(success)
+{
+    // Setup
+    fixture fix;
+
+    // Run the algo. There is no response
+    algo_test()
+        .expect_write(create_frame(0, {0x18, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x03}))
+        .check(fix);
+
+    // The parameter was recorded, so the next execution doesn't send its value
+    fix.check_long_data_params({
+        {3u, 1u}
+    });
+}
+
+BOOST_AUTO_TEST_CASE(success_empty_data)
+{
+    // Setup
+    fixture fix({}, 0u);
+
+    // Run the algo
+    algo_test().expect_write(create_frame(0, {0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00})).check(fix);
+
+    // The parameter was recorded
+    fix.check_long_data_params({
+        {3u, 0u}
+    });
+}
+
+// Sending data for the same parameter several times doesn't duplicate records
+BOOST_AUTO_TEST_CASE(success_param_already_recorded)
+{
+    // Setup
+    fixture fix({0x01});
+    fix.st.long_data_params.push_back({3u, 1u});
+    fix.st.long_data_params.push_back({3u, 0u});
+
+    // Run the algo
+    algo_test()
+        .expect_write(create_frame(0, {0x18, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01}))
+        .check(fix);
+
+    // Nothing changed
+    fix.check_long_data_params({
+        {3u, 1u},
+        {3u, 0u}
+    });
+}
+
+BOOST_AUTO_TEST_CASE(error_param_index)
+{
+    // Setup
+    fixture fix({0x01}, 2u);
+
+    // Run the algo. Nothing is written
+    algo_test().check(fix, client_errc::wrong_num_params);
+    BOOST_TEST(fix.st.long_data_params.empty());
+}
+
+BOOST_AUTO_TEST_CASE(error_max_buffer_size)
+{
+    // Setup. The message is 7 bytes, plus the data
+    fixture fix(std::vector<std::uint8_t>(30, 0x01), 1u, 32u);
+
+    // Run the algo
+    algo_test().check(fix, client_errc::max_buffer_size_exceeded);
+    BOOST_TEST(fix.st.long_data_params.empty());
+}
+
+BOOST_AUTO_TEST_CASE(error_network)
+{
+    algo_test()
+        .expect_write(create_frame(0, {0x18, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x03}))
+        .check_network_errors<fixture>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
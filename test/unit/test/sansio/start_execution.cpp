@@ -8,30 +8,43 @@
 #include <boost/mysql/character_set.hpp>
 #include <boost/mysql/client_errc.hpp>
 #include <boost/mysql/column_type.hpp>
+#include <boost/mysql/common_server_errc.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
 #include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/any_execution_request.hpp>
+#include <boost/mysql/detail/flags.hpp>
 #include <boost/mysql/detail/resultset_encoding.hpp>
 
+#include <boost/mysql/impl/internal/protocol/capabilities.hpp>
+#include <boost/mysql/impl/internal/protocol/db_flavor.hpp>
 #include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
 #include <boost/mysql/impl/internal/sansio/start_execution.hpp>
 
+#include <boost/core/span.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include <array>
 #include <string>
+#include <vector>
 
+#include "test_common/buffer_concat.hpp"
 #include "test_common/check_meta.hpp"
 #include "test_common/create_basic.hpp"
+#include "test_common/create_diagnostics.hpp"
 #include "test_unit/algo_test.hpp"
 #include "test_unit/create_coldef_frame.hpp"
+#include "test_unit/create_err.hpp"
 #include "test_unit/create_frame.hpp"
 #include "test_unit/create_meta.hpp"
 #include "test_unit/create_ok.hpp"
 #include "test_unit/create_ok_frame.hpp"
+#include "test_unit/create_prepare_statement_response.hpp"
 #include "test_unit/create_query_frame.hpp"
+#include "test_unit/create_statement.hpp"
 #include "test_unit/mock_execution_processor.hpp"
 #include "test_unit/printing.hpp"
 
@@ -80,7 +93,7 @@ BOOST_AUTO_TEST_CASE(stmt_success)
 {
     // Setup
     const auto params = make_fv_arr("test", nullptr);
-    fixture fix(any_execution_request({std::uint32_t(1u), std::uint16_t(2u), params}));
+    fixture fix(any_execution_request({std::uint32_t(1u), std::uint16_t(2u), params, 0u}));
 
     // Run the algo
     algo_test()
@@ -103,14 +116,128 @@ BOOST_AUTO_TEST_CASE(stmt_success)
     fix.proc.num_calls().reset(1).on_num_meta(1).on_meta(1).validate();
 }
 
+BOOST_AUTO_TEST_CASE(stmt_cursor)
+{
+    // Setup
+    const auto params = make_fv_arr("test", nullptr);
+    fixture fix(any_execution_request({std::uint32_t(1u), std::uint16_t(2u), params, 20u}));
+    fix.st.cursor = {5u, 10u, true};  // a previous execution's cursor
+
+    // Run the algo. The flags byte is set to CURSOR_TYPE_READ_ONLY
+    algo_test()
+        .expect_write(create_frame(
+            0,
+            {
+                0x17, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02,
+                0x01, 0xfe, 0x00, 0x06, 0x00, 0x04, 0x74, 0x65, 0x73, 0x74,
+            }
+        ))
+        .expect_read(create_frame(1, {0x01}))
+        .expect_read(create_coldef_frame(2, meta_builder().type(column_type::varchar).build_coldef()))
+        .check(fix);
+
+    // Verify. Rows will be fetched as required
+    BOOST_TEST(fix.proc.is_reading_rows());
+    BOOST_TEST(fix.st.cursor.stmt_id == 1u);
+    BOOST_TEST(fix.st.cursor.fetch_size == 20u);
+    BOOST_TEST(!fix.st.cursor.fetch_pending);
+}
+
+// Values for parameters with long data are not sent, and their records are discarded
+BOOST_AUTO_TEST_CASE(stmt_long_data)
+{
+    // Setup
+    const auto params = make_fv_arr("test", 42);
+    fixture fix(any_execution_request({std::uint32_t(1u), std::uint16_t(2u), params, 0u}));
+    fix.st.long_data_params.push_back({1u, 0u});
+    fix.st.long_data_params.push_back({7u, 1u});
+
+    // Run the algo
+    algo_test()
+        .expect_write(create_frame(
+            0,
+            {
+                0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+                0xfe, 0x00, 0x08, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            }
+        ))
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .check(fix);
+
+    // Only the records for other statements remain
+    BOOST_TEST_REQUIRE(fix.st.long_data_params.size() == 1u);
+    BOOST_TEST(fix.st.long_data_params[0].statement_id == 7u);
+    BOOST_TEST(fix.st.long_data_params[0].param_index == 1u);
+}
+
 BOOST_AUTO_TEST_CASE(stmt_error_num_params)
 {
     // Setup
     const auto params = make_fv_arr("test", nullptr, 42);  // too many params
-    fixture fix(any_execution_request({std::uint32_t(1u), std::uint16_t(2u), params}));
+    fixture fix(any_execution_request({std::uint32_t(1u), std::uint16_t(2u), params, 0u}));
 
     // Run the algo. Nothing should be written to the server
     algo_test().check(fix, client_errc::wrong_num_params);
+
+    // No data is pending
+    BOOST_TEST(!fix.st.execution_in_progress);
+}
+
+// Until the final OK packet is read, the connection has pending data, and requires a reset
+BOOST_AUTO_TEST_CASE(execution_in_progress_rows_pending)
+{
+    // Setup
+    fixture fix;
+    fix.st.current_capabilities = detail::capabilities(detail::CLIENT_SESSION_TRACK);
+
+    // Run the algo
+    algo_test()
+        .expect_write(create_frame(0, {0x03, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x31}))
+        .expect_read(create_frame(1, {0x01}))
+        .expect_read(create_coldef_frame(2, meta_builder().type(column_type::varchar).build_coldef()))
+        .check(fix);
+
+    // Verify
+    BOOST_TEST(fix.proc.is_reading_rows());
+    BOOST_TEST(fix.st.execution_in_progress);
+    BOOST_TEST(fix.st.session_reset_required());
+}
+
+BOOST_AUTO_TEST_CASE(execution_in_progress_ok_packet)
+{
+    // Setup
+    fixture fix;
+    fix.st.current_capabilities = detail::capabilities(detail::CLIENT_SESSION_TRACK);
+
+    // Run the algo
+    algo_test()
+        .expect_write(create_frame(0, {0x03, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x31}))
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .check(fix);
+
+    // Verify
+    BOOST_TEST(fix.proc.is_complete());
+    BOOST_TEST(!fix.st.execution_in_progress);
+    BOOST_TEST(!fix.st.session_reset_required());
+}
+
+BOOST_AUTO_TEST_CASE(execution_in_progress_error_packet)
+{
+    // Setup
+    fixture fix;
+    fix.st.current_capabilities = detail::capabilities(detail::CLIENT_SESSION_TRACK);
+
+    // Run the algo
+    algo_test()
+        .expect_write(create_frame(0, {0x03, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x31}))
+        .expect_read(
+            err_builder().seqnum(1).code(common_server_errc::er_parse_error).message("bad").build_frame()
+        )
+        .check(fix, common_server_errc::er_parse_error, create_server_diag("bad"));
+
+    // Verify. Error packets end the execution
+    BOOST_TEST(!fix.st.execution_in_progress);
+    BOOST_TEST(!fix.st.session_reset_required());
 }
 
 BOOST_AUTO_TEST_CASE(with_params_success)
@@ -159,6 +286,402 @@ BOOST_AUTO_TEST_CASE(with_params_error_formatting)
     algo_test().check(fix, client_errc::format_arg_not_found);
 }
 
+//
+// Cached statements
+//
+struct cached_fixture : fixture
+{
+    // A statement with a single parameter
+    static constexpr std::uint8_t param_bytes[] = {0x00, 0x01, 0xfe, 0x00, 0x03, 0x61, 0x62, 0x63};
+    const std::array<field_view, 1> params{{field_view("abc")}};
+
+    cached_fixture(string_view sql = "Q1")
+        : fixture(any_execution_request(any_execution_request::data_t::cached_stmt_t{sql, params}))
+    {
+    }
+
+    // COM_STMT_PREPARE for Q1
+    static std::vector<std::uint8_t> prepare_frame() { return create_frame(0, {0x16, 0x51, 0x31}); }
+
+    // COM_STMT_EXECUTE for the given statement ID
+    static std::vector<std::uint8_t> execute_frame(std::uint8_t stmt_id)
+    {
+        return create_frame(
+            0,
+            concat_copy(
+                std::vector<std::uint8_t>{0x17, stmt_id, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00},
+                std::vector<std::uint8_t>(std::begin(param_bytes), std::end(param_bytes))
+            )
+        );
+    }
+
+    // Prepare response for a statement without columns
+    static std::vector<std::uint8_t> prepare_response(std::uint32_t stmt_id, std::uint16_t num_params = 1u)
+    {
+        auto res = prepare_stmt_response_builder().seqnum(1).id(stmt_id).num_params(num_params).build();
+        for (std::uint16_t i = 0; i < num_params; ++i)
+        {
+            auto seqnum = static_cast<std::uint8_t>(2 + i);
+            res = concat_copy(res, create_coldef_frame(seqnum, meta_builder().build_coldef()));
+        }
+        return res;
+    }
+};
+constexpr std::uint8_t cached_fixture::param_bytes[];
+
+BOOST_AUTO_TEST_CASE(cached_stmt_miss)
+{
+    // Setup
+    cached_fixture fix;
+
+    // Run the algo. The statement is prepared, then executed
+    algo_test()
+        .expect_write(cached_fixture::prepare_frame())
+        .expect_read(cached_fixture::prepare_response(7u))
+        .expect_write(cached_fixture::execute_frame(7u))
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(1).build()))
+        .check(fix);
+
+    // Verify
+    BOOST_TEST(fix.proc.encoding() == resultset_encoding::binary);
+    BOOST_TEST(fix.proc.is_complete());
+    BOOST_TEST(fix.proc.affected_rows() == 1u);
+    BOOST_TEST(fix.st.stmt_cache.size() == 1u);
+    BOOST_TEST(fix.st.stmt_cache.get("Q1").id() == 7u);
+}
+
+BOOST_AUTO_TEST_CASE(cached_stmt_hit)
+{
+    // Setup
+    cached_fixture fix;
+    fix.st.stmt_cache.put("Q1", statement_builder().id(7).num_params(1).build());
+
+    // Run the algo. No round-trip to prepare the statement is required
+    algo_test()
+        .expect_write(cached_fixture::execute_frame(7u))
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(1).build()))
+        .check(fix);
+
+    // Verify
+    BOOST_TEST(fix.proc.is_complete());
+    BOOST_TEST(fix.st.stmt_cache.size() == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(cached_stmt_evict)
+{
+    // Setup
+    cached_fixture fix;
+    fix.st.stmt_cache = detail::statement_cache(1u);
+    fix.st.stmt_cache.put("Q0", statement_builder().id(3).num_params(1).build());
+
+    // Run the algo. The least recently used statement is closed in the same write as the prepare
+    algo_test()
+        .expect_write(
+            concat_copy(create_frame(0, {0x19, 0x03, 0x00, 0x00, 0x00}), cached_fixture::prepare_frame())
+        )
+        .expect_read(cached_fixture::prepare_response(8u))
+        .expect_write(cached_fixture::execute_frame(8u))
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .check(fix);
+
+    // Verify
+    BOOST_TEST(fix.st.stmt_cache.size() == 1u);
+    BOOST_TEST(!fix.st.stmt_cache.get("Q0").valid());
+    BOOST_TEST(fix.st.stmt_cache.get("Q1").id() == 8u);
+}
+
+BOOST_AUTO_TEST_CASE(cached_stmt_error_prepare)
+{
+    // Setup
+    cached_fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_write(cached_fixture::prepare_frame())
+        .expect_read(
+            err_builder().seqnum(1).code(common_server_errc::er_parse_error).message("bad").build_frame()
+        )
+        .check(fix, common_server_errc::er_parse_error, create_server_diag("bad"));
+
+    // Nothing was cached. The error response was read, so no data is pending
+    BOOST_TEST(fix.st.stmt_cache.size() == 0u);
+    BOOST_TEST(!fix.st.execution_in_progress);
+}
+
+// If the prepare request can't be serialized, nothing is written and
+// the statement that would have been evicted is kept in the cache
+BOOST_AUTO_TEST_CASE(cached_stmt_evict_error_max_buffer_size)
+{
+    // Setup
+    std::string sql(2048, 'a');
+    cached_fixture fix(sql);
+    fix.st.stmt_cache = detail::statement_cache(1u);
+    fix.st.stmt_cache.put("Q0", statement_builder().id(3).num_params(1).build());
+
+    // Run the algo
+    algo_test().check(fix, client_errc::max_buffer_size_exceeded);
+
+    // Verify
+    BOOST_TEST(fix.st.stmt_cache.size() == 1u);
+    BOOST_TEST(fix.st.stmt_cache.get("Q0").id() == 3u);
+    BOOST_TEST(!fix.st.execution_in_progress);
+}
+
+BOOST_AUTO_TEST_CASE(cached_stmt_error_num_params)
+{
+    // Setup
+    cached_fixture fix;
+
+    // Run the algo. The statement has 2 params, but we supplied only 1
+    algo_test()
+        .expect_write(cached_fixture::prepare_frame())
+        .expect_read(cached_fixture::prepare_response(7u, 2u))
+        .check(fix, client_errc::wrong_num_params);
+
+    // The statement was prepared successfully, so it's cached
+    BOOST_TEST(fix.st.stmt_cache.get("Q1").id() == 7u);
+}
+
+//
+// Batches
+//
+any_execution_request batch_request(boost::span<const field_view> params)
+{
+    return any_execution_request(any_execution_request::data_t::stmt_batch_t{1u, 2u, params});
+}
+
+const auto batch_params = make_fv_arr(42, "ab", 43, "c");
+
+struct batch_fixture : fixture
+{
+    batch_fixture(boost::span<const field_view> params = batch_params) : fixture(batch_request(params)) {}
+};
+
+// The execution requests for batch_params, as written when not using bulk execution
+std::vector<std::uint8_t> batch_execute_frames()
+{
+    return buffer_builder()
+        .add(create_frame(0, {0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+                              0x01, 0x08, 0x00, 0xfe, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00,
+                              0x00, 0x00, 0x02, 0x61, 0x62}))
+        .add(create_frame(0, {0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+                              0x01, 0x08, 0x00, 0xfe, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00,
+                              0x00, 0x00, 0x01, 0x63}))
+        .build();
+}
+
+// With MySQL, one execution request per row is written at once, and results are aggregated
+BOOST_AUTO_TEST_CASE(stmt_batch_pipelined)
+{
+    // Setup
+    batch_fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_write(batch_execute_frames())
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(1).last_insert_id(10).build()))
+        .expect_read(create_ok_frame(
+            1,
+            ok_builder().affected_rows(2).last_insert_id(11).flags(detail::status_flags::in_trans).build()
+        ))
+        .check(fix);
+
+    // Verify
+    BOOST_TEST(fix.proc.encoding() == resultset_encoding::binary);
+    BOOST_TEST(fix.proc.is_complete());
+    BOOST_TEST(fix.proc.affected_rows() == 3u);
+    BOOST_TEST(fix.proc.last_insert_id() == 10u);
+    BOOST_TEST(fix.st.in_transaction);
+    BOOST_TEST(!fix.st.execution_in_progress);
+    fix.proc.num_calls().reset(1).on_head_ok_packet(1).validate();
+}
+
+// The processor gets the sum of all warning counts, saturated to fit in an OK packet
+BOOST_AUTO_TEST_CASE(stmt_batch_pipelined_warnings)
+{
+    // Setup
+    batch_fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_write(batch_execute_frames())
+        .expect_read(create_ok_frame(1, ok_builder().warnings(0xfff0).build()))
+        .expect_read(create_ok_frame(1, ok_builder().warnings(0x20).build()))
+        .check(fix);
+
+    // Verify
+    BOOST_TEST(fix.proc.is_complete());
+    BOOST_TEST(fix.proc.warning_count() == 0xffffu);
+}
+
+// All responses are read, and the first error is reported
+BOOST_AUTO_TEST_CASE(stmt_batch_pipelined_error)
+{
+    // Setup
+    const auto params = make_fv_arr(42, "ab", 43, "c", 44, "d");
+    batch_fixture fix(params);
+
+    // Run the algo
+    algo_test()
+        .expect_write(buffer_builder()
+                          .add(batch_execute_frames())
+                          .add(create_frame(0, {0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+                                                0x00, 0x00, 0x01, 0x08, 0x00, 0xfe, 0x00, 0x2c, 0x00,
+                                                0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x64}))
+                          .build())
+        .expect_read(
+            err_builder().seqnum(1).code(common_server_errc::er_dup_entry).message("first").build_frame()
+        )
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(1).build()))
+        .expect_read(
+            err_builder()
+                .seqnum(1)
+                .code(common_server_errc::er_bad_null_error)
+                .message("second")
+                .build_frame()
+        )
+        .check(fix, common_server_errc::er_dup_entry, create_server_diag("first"));
+
+    // The processor is not notified
+    fix.proc.num_calls().reset(1).validate();
+}
+
+BOOST_AUTO_TEST_CASE(stmt_batch_pipelined_error_returned_rows)
+{
+    // Setup
+    batch_fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_write(batch_execute_frames())
+        .expect_read(create_frame(1, {0x01}))
+        .check(fix, client_errc::batch_returned_rows);
+}
+
+// With MariaDB, a single bulk execution request is used
+BOOST_AUTO_TEST_CASE(stmt_batch_bulk)
+{
+    // Setup
+    const auto params = make_fv_arr(42, "ab", nullptr, "c");
+    batch_fixture fix(params);
+    fix.st.flavor = detail::db_flavor::mariadb;
+    fix.st.mariadb_ext_capabilities = detail::MARIADB_CLIENT_STMT_BULK_OPERATIONS;
+
+    // Run the algo
+    algo_test()
+        .expect_write(create_frame(
+            0,
+            {
+                0xfa, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x08, 0x00, 0xfe, 0x00, 0x00, 0x2a, 0x00,
+                0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x61, 0x62, 0x01, 0x00, 0x01, 0x63,
+            }
+        ))
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(2).build()))
+        .check(fix);
+
+    // Verify
+    BOOST_TEST(fix.proc.is_complete());
+    BOOST_TEST(fix.proc.affected_rows() == 2u);
+    fix.proc.num_calls().reset(1).on_head_ok_packet(1).validate();
+}
+
+// Bulk executions returning rows are rejected, as happens with pipelined requests
+BOOST_AUTO_TEST_CASE(stmt_batch_bulk_error_returned_rows)
+{
+    // Setup
+    const auto params = make_fv_arr(42, "ab", nullptr, "c");
+    batch_fixture fix(params);
+    fix.st.flavor = detail::db_flavor::mariadb;
+    fix.st.mariadb_ext_capabilities = detail::MARIADB_CLIENT_STMT_BULK_OPERATIONS;
+
+    // Run the algo
+    algo_test()
+        .expect_write(create_frame(
+            0,
+            {
+                0xfa, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x08, 0x00, 0xfe, 0x00, 0x00, 0x2a, 0x00,
+                0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x61, 0x62, 0x01, 0x00, 0x01, 0x63,
+            }
+        ))
+        .expect_read(create_frame(1, {0x01}))
+        .check(fix, client_errc::batch_returned_rows);
+}
+
+// If a parameter has values of different types, bulk execution can't be used
+BOOST_AUTO_TEST_CASE(stmt_batch_bulk_mixed_types)
+{
+    // Setup
+    const auto params = make_fv_arr(42, "ab", "abc", "c");
+    batch_fixture fix(params);
+    fix.st.flavor = detail::db_flavor::mariadb;
+    fix.st.mariadb_ext_capabilities = detail::MARIADB_CLIENT_STMT_BULK_OPERATIONS;
+
+    // Run the algo
+    algo_test()
+        .expect_write(buffer_builder()
+                          .add(create_frame(0, {0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+                                                0x00, 0x01, 0x08, 0x00, 0xfe, 0x00, 0x2a, 0x00, 0x00, 0x00,
+                                                0x00, 0x00, 0x00, 0x00, 0x02, 0x61, 0x62}))
+                          .add(create_frame(0, {0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+                                                0x00, 0x01, 0xfe, 0x00, 0xfe, 0x00, 0x03, 0x61, 0x62, 0x63,
+                                                0x01, 0x63}))
+                          .build())
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(1).build()))
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(1).build()))
+        .check(fix);
+
+    // Verify
+    BOOST_TEST(fix.proc.affected_rows() == 2u);
+}
+
+BOOST_AUTO_TEST_CASE(stmt_batch_error_num_params)
+{
+    struct
+    {
+        const char* name;
+        std::vector<field_view> params;
+    } test_cases[] = {
+        {"empty",        {}                                                    },
+        {"not_multiple", {field_view(42), field_view("ab"), field_view(43)}},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            // Setup
+            batch_fixture fix(tc.params);
+
+            // Run the algo. Nothing should be written to the server
+            algo_test().check(fix, client_errc::wrong_num_params);
+        }
+    }
+}
+
+// Long data would only be used by the first execution, so batches reject it
+BOOST_AUTO_TEST_CASE(stmt_batch_error_long_data)
+{
+    // Setup
+    batch_fixture fix;
+    fix.st.long_data_params.push_back({1u, 0u});
+
+    // Run the algo. Nothing should be written to the server
+    algo_test().check(fix, client_errc::batch_with_long_data);
+
+    // Long data is kept for the next execution
+    BOOST_TEST(fix.st.long_data_params.size() == 1u);
+    BOOST_TEST(!fix.st.execution_in_progress);
+}
+
+BOOST_AUTO_TEST_CASE(stmt_batch_error_network)
+{
+    algo_test()
+        .expect_write(batch_execute_frames())
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(1).build()))
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(1).build()))
+        .check_network_errors<batch_fixture>();
+}
+
 // This covers errors in both writing the request and calling read_resultset_head
 BOOST_AUTO_TEST_CASE(error_network_error)
 {
@@ -6,6 +6,7 @@
 //
 
 #include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/compression_algorithm.hpp>
 #include <boost/mysql/error_code.hpp>
 
 #include <boost/mysql/detail/next_action.hpp>
@@ -403,6 +404,57 @@ BOOST_AUTO_TEST_CASE(write_ssl_active)
     BOOST_TEST(act.write_args().use_ssl);
 }
 
+BOOST_AUTO_TEST_CASE(compression)
+{
+    struct mock_algo
+    {
+        coroutine coro;
+        std::uint8_t seqnum{};
+
+        next_action resume(connection_state_data& st, error_code ec)
+        {
+            BOOST_ASIO_CORO_REENTER(coro)
+            {
+                BOOST_TEST(ec == error_code());
+                BOOST_ASIO_CORO_YIELD return st.write(mock_message{msg1}, seqnum);
+                BOOST_TEST(ec == error_code());
+                BOOST_ASIO_CORO_YIELD return st.read(seqnum);
+                BOOST_TEST(ec == error_code());
+                BOOST_TEST(seqnum == 2u);
+                BOOST_MYSQL_ASSERT_BUFFER_EQUALS(st.reader.message(), msg2);
+            }
+            return next_action();
+        }
+    };
+
+    // Uncompressed payloads are used, since they don't require any library
+    connection_state_data st(16);
+    st.reader.set_compression(boost::mysql::compression_algorithm::zlib);
+    st.compression_threshold = 1024u;
+    top_level_algo<mock_algo> algo(st);
+
+    // Writes are wrapped in compressed frames
+    auto act = algo.resume(error_code(), 0);
+    BOOST_TEST(act.type() == next_action_type::write);
+    auto expected_write = create_compressed_frame(0, create_frame(0, msg1));
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(act.write_args().buffer, expected_write);
+    act = algo.resume(error_code(), act.write_args().buffer.size());
+
+    // Reads go to the compressed buffer
+    BOOST_TEST(act.type() == next_action_type::read);
+    BOOST_TEST(act.read_args().buffer.data() == st.reader.buffer().data());
+    auto bytes = create_compressed_frame(1, create_frame(1, msg2));
+    transfer(act.read_args().buffer, span<const std::uint8_t>(bytes.data(), 16));
+    act = algo.resume(error_code(), 16);
+
+    // The compressed frame is completed. The decompressed message doesn't fit
+    // in the buffer, so it's decompressed when preparing the next read, without issuing it
+    BOOST_TEST(act.type() == next_action_type::read);
+    transfer(act.read_args().buffer, span<const std::uint8_t>(bytes.data() + 16, bytes.size() - 16));
+    act = algo.resume(error_code(), bytes.size() - 16);
+    BOOST_TEST(act.success());
+}
+
 BOOST_AUTO_TEST_CASE(ssl_handshake)
 {
     struct mock_algo
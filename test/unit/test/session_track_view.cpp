@@ -0,0 +1,172 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/session_track.hpp>
+#include <boost/mysql/session_track_view.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+
+#include <boost/mysql/impl/internal/protocol/impl/protocol_types.hpp>
+#include <boost/mysql/impl/internal/protocol/impl/serialization_context.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "test_common/buffer_concat.hpp"
+#include "test_unit/printing.hpp"
+#include "test_unit/serialize_to_vector.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_session_track_view)
+
+string_view to_sv(const std::vector<std::uint8_t>& buff)
+{
+    return string_view(reinterpret_cast<const char*>(buff.data()), buff.size());
+}
+
+// Serializes a length-encoded string
+std::vector<std::uint8_t> create_lenenc(string_view value)
+{
+    return serialize_to_vector([value](detail::serialization_context& ctx) {
+        detail::string_lenenc{value}.serialize(ctx);
+    });
+}
+
+// Serializes a session state item, as sent by the server
+std::vector<std::uint8_t> create_item(std::uint8_t type, const std::vector<std::uint8_t>& data)
+{
+    return serialize_to_vector([type, &data](detail::serialization_context& ctx) {
+        ctx.serialize(detail::int1{type}, detail::string_lenenc{to_sv(data)});
+    });
+}
+
+session_track_view make_view(const std::vector<std::uint8_t>& buff)
+{
+    return detail::access::construct<session_track_view>(buff.data(), buff.size());
+}
+
+void check_item(
+    const session_track_item& item,
+    session_track_type expected_type,
+    string_view expected_name,
+    string_view expected_value
+)
+{
+    BOOST_TEST(item.type == expected_type);
+    BOOST_TEST(item.name == expected_name);
+    BOOST_TEST(item.value == expected_value);
+}
+
+BOOST_AUTO_TEST_CASE(default_ctor)
+{
+    session_track_view v;
+    BOOST_TEST(v.empty());
+    BOOST_TEST((v.begin() == v.end()));
+}
+
+BOOST_AUTO_TEST_CASE(all_types)
+{
+    // Setup
+    const char* gtids = "3E11FA47-71CA-11E1-9E33-C80AA9429562:23";
+    auto var_data = concat_copy(create_lenenc("autocommit"), create_lenenc("OFF"));
+    auto gtids_data = concat_copy({0x00}, create_lenenc(gtids));  // encoding specification + GTIDs
+    auto buff = buffer_builder()
+                    .add(create_item(0, var_data))
+                    .add(create_item(1, create_lenenc("mydb")))
+                    .add(create_item(2, create_lenenc("1")))
+                    .add(create_item(3, gtids_data))
+                    .add(create_item(4, create_lenenc("START TRANSACTION READ ONLY;")))
+                    .add(create_item(5, create_lenenc("T_____S_")))
+                    .build();
+    auto v = make_view(buff);
+
+    // Check
+    BOOST_TEST(!v.empty());
+    std::vector<session_track_item> items(v.begin(), v.end());
+    BOOST_TEST_REQUIRE(items.size() == 6u);
+    check_item(items[0], session_track_type::system_variable, "autocommit", "OFF");
+    check_item(items[1], session_track_type::schema, "", "mydb");
+    check_item(items[2], session_track_type::state_change, "", "1");
+    check_item(items[3], session_track_type::gtids, "", gtids);
+    check_item(items[4], session_track_type::transaction_characteristics, "", "START TRANSACTION READ ONLY;");
+    check_item(items[5], session_track_type::transaction_state, "", "T_____S_");
+}
+
+BOOST_AUTO_TEST_CASE(iterator_operations)
+{
+    auto buff = buffer_builder()
+                    .add(create_item(1, create_lenenc("db1")))
+                    .add(create_item(1, create_lenenc("db2")))
+                    .build();
+    auto v = make_view(buff);
+
+    auto it = v.begin();
+    BOOST_TEST(it->value == "db1");
+    auto it2 = it++;
+    BOOST_TEST(it2->value == "db1");
+    BOOST_TEST((*it).value == "db2");
+    BOOST_TEST((it != it2));
+    ++it;
+    BOOST_TEST((it == v.end()));
+}
+
+BOOST_AUTO_TEST_CASE(unknown_type)
+{
+    // Unknown types are exposed as raw data
+    auto buff = create_item(42, {0x01, 0x02, 0x03});
+    auto v = make_view(buff);
+
+    std::vector<session_track_item> items(v.begin(), v.end());
+    BOOST_TEST_REQUIRE(items.size() == 1u);
+    BOOST_TEST(static_cast<int>(items[0].type) == 42);
+    BOOST_TEST(items[0].name == "");
+    BOOST_TEST(items[0].value == "\1\2\3");
+}
+
+BOOST_AUTO_TEST_CASE(malformed_data)
+{
+    // Data that doesn't have the expected format for its type is exposed as raw data
+    auto schema_data = concat_copy(create_lenenc("mydb"), {0xab});
+    auto var_data = create_lenenc("autocommit");
+    auto buff = buffer_builder()
+                    .add(create_item(1, schema_data))
+                    .add(create_item(0, var_data))
+                    .add(create_item(2, {}))
+                    .build();
+    auto v = make_view(buff);
+
+    std::vector<session_track_item> items(v.begin(), v.end());
+    BOOST_TEST_REQUIRE(items.size() == 3u);
+    check_item(items[0], session_track_type::schema, "", to_sv(schema_data));
+    check_item(items[1], session_track_type::system_variable, "", to_sv(var_data));
+    check_item(items[2], session_track_type::state_change, "", "");
+}
+
+BOOST_AUTO_TEST_CASE(truncated_item)
+{
+    // Iteration stops at the first item that can't be parsed
+    auto buff = buffer_builder()
+                    .add(create_item(1, create_lenenc("mydb")))
+                    .add(std::vector<std::uint8_t>{0x02, 0x05, 0x01})  // Data length exceeds the buffer
+                    .build();
+    auto v = make_view(buff);
+
+    std::vector<session_track_item> items(v.begin(), v.end());
+    BOOST_TEST_REQUIRE(items.size() == 1u);
+    check_item(items[0], session_track_type::schema, "", "mydb");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
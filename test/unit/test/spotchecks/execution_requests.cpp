@@ -9,6 +9,7 @@
 // that span over multiple messages, we test the complete multifn fllow in this unit tests.
 
 #include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/cached_statement.hpp>
 #include <boost/mysql/character_set.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
@@ -17,6 +18,7 @@
 #include <boost/mysql/rows_view.hpp>
 #include <boost/mysql/string_view.hpp>
 #include <boost/mysql/tcp.hpp>
+#include <boost/mysql/with_cursor.hpp>
 #include <boost/mysql/with_params.hpp>
 
 #include <boost/mysql/detail/access.hpp>
@@ -28,6 +30,8 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <vector>
@@ -35,8 +39,11 @@
 #include "test_common/assert_buffer_equals.hpp"
 #include "test_common/network_result.hpp"
 #include "test_common/tracker_executor.hpp"
+#include "test_unit/create_coldef_frame.hpp"
+#include "test_unit/create_meta.hpp"
 #include "test_unit/create_ok.hpp"
 #include "test_unit/create_ok_frame.hpp"
+#include "test_unit/create_prepare_statement_response.hpp"
 #include "test_unit/create_query_frame.hpp"
 #include "test_unit/create_statement.hpp"
 #include "test_unit/test_any_connection.hpp"
@@ -625,4 +632,93 @@ BOOST_AUTO_TEST_CASE(async_execute_deferred_lifetimes)
     BOOST_MYSQL_ASSERT_BUFFER_EQUALS(get_stream(conn).bytes_written(), expected_msg);
 }
 
+BOOST_AUTO_TEST_CASE(cached_statement_types)
+{
+    // Params are decay-copied, unless std::ref is used
+    {
+        std::string s = "abc";
+        auto st = cached_statement("SELECT ?, ?", s, 42);
+        static_assert(std::is_same<decltype(st), cached_statement_t<std::string, int>>::value, "");
+    }
+    {
+        const std::string s = "abc";
+        auto st = cached_statement("SELECT ?", std::ref(s));
+        static_assert(std::is_same<decltype(st), cached_statement_t<const std::string&>>::value, "");
+    }
+}
+
+// Cached statements are prepared once, and then reused
+BOOST_AUTO_TEST_CASE(cached_statement_reuse)
+{
+    // Setup
+    const std::vector<std::uint8_t> execute_msg{
+        0x17, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0x08, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    };
+    results result;
+    auto conn = create_test_any_connection();
+    get_stream(conn)
+        .add_bytes(prepare_stmt_response_builder().seqnum(1).id(7).num_params(1).build())
+        .add_bytes(create_coldef_frame(2, meta_builder().build_coldef()))
+        .add_bytes(create_ok_frame(1, ok_builder().affected_rows(1).build()))
+        .add_bytes(create_ok_frame(1, ok_builder().affected_rows(2).build()));
+
+    // Execute the same statement twice
+    conn.execute(cached_statement("Q1", 42), result);
+    BOOST_TEST(result.affected_rows() == 1u);
+    conn.async_execute(cached_statement("Q1", 42), result, as_netresult).validate_no_error();
+    BOOST_TEST(result.affected_rows() == 2u);
+
+    // The statement was only prepared once
+    auto expected = concat_copy(
+        concat_copy(create_frame(0, {0x16, 0x51, 0x31}), create_frame(0, execute_msg)),
+        create_frame(0, execute_msg)
+    );
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(get_stream(conn).bytes_written(), expected);
+}
+
+// with_cursor works with both bound statement types, and stores them by value
+BOOST_AUTO_TEST_CASE(with_cursor_)
+{
+    // Setup
+    constexpr std::uint8_t expected_msg[] = {
+        0x15, 0x00, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+        0x00, 0x02, 0x01, 0xfe, 0x00, 0x06, 0x00, 0x04, 0x74, 0x65, 0x73, 0x74,
+    };
+    const field_view params[] = {field_view("test"), field_view()};
+    auto stmt = statement_builder().id(1).num_params(2).build();
+
+    struct
+    {
+        const char* name;
+        std::function<void(any_connection&, results&)> fn;
+    } test_cases[] = {
+        {"tuple",
+         [&](any_connection& conn, results& r) {
+             auto req = with_cursor(stmt.bind(std::string("test"), nullptr), 10u);
+             auto op = conn.async_execute(req, r, asio::deferred);
+             req.stmt = stmt.bind(std::string("other"), nullptr);  // the op holds a copy
+             std::move(op)(as_netresult).validate_no_error();
+         }},
+        {"iterator_range",
+         [&](any_connection& conn, results& r) {
+             conn.execute(with_cursor(stmt.bind(std::begin(params), std::end(params)), 10u), r);
+         }},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            results result;
+            auto conn = create_test_any_connection();
+            get_stream(conn).add_bytes(create_ok_frame(1, ok_builder().build()));
+
+            tc.fn(conn, result);
+
+            BOOST_MYSQL_ASSERT_BUFFER_EQUALS(get_stream(conn).bytes_written(), expected_msg);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()